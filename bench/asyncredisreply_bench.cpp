@@ -0,0 +1,47 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include "private/bench/benchmark.hpp"
+#include "private/bench/fakehiredissystem.hpp"
+#include "private/redis/asyncredisreply.hpp"
+
+using namespace shareddatalayer;
+using namespace shareddatalayer::redis;
+
+SHAREDDATALAYER_BENCHMARK(AsyncRedisReplyStatus)
+{
+    const bench::CannedReply cannedReply("OK");
+    for (std::size_t i(0); i < state.getIterations(); ++i)
+    {
+        const AsyncRedisReply reply(cannedReply.get());
+        bench::doNotOptimize(reply.getType());
+    }
+}
+
+SHAREDDATALAYER_BENCHMARK(AsyncRedisReplyArray10)
+{
+    const bench::CannedReply cannedReply(10, std::string(100, 'x'));
+    for (std::size_t i(0); i < state.getIterations(); ++i)
+    {
+        const AsyncRedisReply reply(cannedReply.get());
+        bench::doNotOptimize(reply.getArray()->size());
+    }
+}
@@ -0,0 +1,173 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <arpa/inet.h>
+#include "private/bench/benchmark.hpp"
+#include "private/bench/fakehiredissystem.hpp"
+#include "private/engineimpl.hpp"
+#include "private/hostandport.hpp"
+#include "private/namespaceconfigurationsimpl.hpp"
+#include "private/redis/asyncdatabasediscovery.hpp"
+#include "private/redis/asynchirediscommanddispatcher.hpp"
+#include "private/redis/asyncredisstorage.hpp"
+#include "private/redis/contentsbuilder.hpp"
+#include "private/redis/databaseinfo.hpp"
+
+using namespace shareddatalayer;
+using namespace shareddatalayer::bench;
+using namespace shareddatalayer::redis;
+
+namespace
+{
+    class FixedDatabaseDiscovery: public AsyncDatabaseDiscovery
+    {
+    public:
+        explicit FixedDatabaseDiscovery(Engine& engine):
+            engine(engine)
+        {
+        }
+
+        void setStateChangedCb(const StateChangedCb& stateChangedCb) override
+        {
+            const DatabaseInfo databaseInfo { { HostAndPort("localhost", htons(6379)) },
+                                              DatabaseInfo::Type::SINGLE,
+                                              boost::none,
+                                              DatabaseInfo::Discovery::HIREDIS };
+            engine.postCallback(std::bind(stateChangedCb, databaseInfo));
+        }
+
+        void clearStateChangedCb() override
+        {
+        }
+
+    private:
+        Engine& engine;
+    };
+
+    /* The whole AsyncRedisStorage -> AsyncHiredisCommandDispatcher stack on top of FakeHiredisSystem. */
+    class Storage
+    {
+    public:
+        Storage():
+            engine(std::make_shared<EngineImpl>()),
+            logger(std::make_shared<NullLogger>()),
+            storage(engine,
+                    std::make_shared<FixedDatabaseDiscovery>(*engine),
+                    boost::none,
+                    std::make_shared<NamespaceConfigurationsImpl>(),
+                    std::bind(&Storage::createDispatcher,
+                              this,
+                              std::placeholders::_1,
+                              std::placeholders::_2,
+                              std::placeholders::_3,
+                              std::placeholders::_4,
+                              std::placeholders::_5),
+                    std::make_shared<ContentsBuilder>(AsyncStorage::SEPARATOR),
+                    logger)
+        {
+            engine->handleEvents();
+            /* Connection is completed without the hiredis connect callback, which logs the
+             * connection through the process logger and would mix with the results.
+             */
+            dispatcher->verifyConnection();
+        }
+
+        std::shared_ptr<EngineImpl> engine;
+        std::shared_ptr<Logger> logger;
+        FakeHiredisSystem hiredisSystem;
+        AsyncRedisStorage storage;
+
+    private:
+        std::shared_ptr<AsyncHiredisCommandDispatcher> dispatcher;
+
+        std::shared_ptr<AsyncCommandDispatcher> createDispatcher(Engine& engine,
+                                                                 const DatabaseInfo&,
+                                                                 std::shared_ptr<ContentsBuilder> contentsBuilder,
+                                                                 std::shared_ptr<Logger> logger,
+                                                                 bool usePermanentCommandCallbacks)
+        {
+            /* Connection is handled like a sentinel connection, which skips the query
+             * of the Redis module commands.
+             */
+            dispatcher = std::make_shared<AsyncHiredisCommandDispatcher>(engine,
+                                                                       "localhost",
+                                                                       htons(6379),
+                                                                       contentsBuilder,
+                                                                       usePermanentCommandCallbacks,
+                                                                       hiredisSystem,
+                                                                       std::make_shared<NullEpollAdapter>(engine, hiredisSystem),
+                                                                       logger,
+                                                                       true);
+            return dispatcher;
+        }
+    };
+
+    AsyncStorage::DataMap buildDataMap(std::size_t size)
+    {
+        AsyncStorage::DataMap dataMap;
+        for (std::size_t i(0); i < size; ++i)
+            dataMap.emplace("key" + std::to_string(i), AsyncStorage::Data(100, 0xab));
+        return dataMap;
+    }
+}
+
+SHAREDDATALAYER_BENCHMARK(AsyncRedisStorageGet10)
+{
+    Storage storage;
+    const CannedReply reply(10, std::string(100, 'x'));
+    storage.hiredisSystem.setReply(reply);
+    AsyncStorage::Keys keys;
+    for (const auto& i : buildDataMap(10))
+        keys.insert(i.first);
+    std::size_t received(0);
+    state.startMeasurement();
+    for (std::size_t i(0); i < state.getIterations(); ++i)
+    {
+        storage.storage.getAsync("namespace",
+                                 keys,
+                                 [&received](const std::error_code&, const AsyncStorage::DataMap& dataMap)
+                                 {
+                                     received += dataMap.size();
+                                 });
+        storage.hiredisSystem.replyAll();
+    }
+    state.stopMeasurement();
+    bench::doNotOptimize(received);
+}
+
+SHAREDDATALAYER_BENCHMARK(AsyncRedisStorageSet10)
+{
+    Storage storage;
+    const CannedReply reply("OK");
+    storage.hiredisSystem.setReply(reply);
+    const auto dataMap(buildDataMap(10));
+    std::size_t acked(0);
+    state.startMeasurement();
+    for (std::size_t i(0); i < state.getIterations(); ++i)
+    {
+        storage.storage.setAsync("namespace",
+                                 dataMap,
+                                 [&acked](const std::error_code&) { ++acked; });
+        storage.hiredisSystem.replyAll();
+    }
+    state.stopMeasurement();
+    bench::doNotOptimize(acked);
+}
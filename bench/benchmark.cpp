@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include "private/bench/benchmark.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+
+using namespace shareddatalayer::bench;
+
+namespace
+{
+    /* Each benchmark is run long enough to make the timer resolution and the
+     * setup done outside of the measurement insignificant.
+     */
+    const std::chrono::milliseconds CALIBRATION_TIME(100);
+    const std::chrono::milliseconds MEASUREMENT_TIME(500);
+    const std::size_t MAX_ITERATIONS(1000000000);
+
+    std::map<std::string, BenchmarkFunction>& getBenchmarks()
+    {
+        static std::map<std::string, BenchmarkFunction> benchmarks;
+        return benchmarks;
+    }
+
+    std::chrono::steady_clock::duration run(const BenchmarkFunction& benchmarkFunction,
+                                            std::size_t iterations,
+                                            std::size_t& allocations)
+    {
+        State state(iterations);
+        benchmarkFunction(state);
+        state.stopMeasurement();
+        allocations = state.getAllocations();
+        return state.getElapsed();
+    }
+
+    std::size_t calibrate(const BenchmarkFunction& benchmarkFunction)
+    {
+        std::size_t iterations(1);
+        std::size_t allocations;
+        while (iterations < MAX_ITERATIONS)
+        {
+            const auto elapsed(run(benchmarkFunction, iterations, allocations));
+            if (elapsed >= CALIBRATION_TIME)
+            {
+                const auto scaled(iterations * MEASUREMENT_TIME / elapsed);
+                return std::max<std::size_t>(1, std::min<std::size_t>(scaled, MAX_ITERATIONS));
+            }
+            iterations *= 10;
+        }
+        return MAX_ITERATIONS;
+    }
+}
+
+State::State(std::size_t iterations):
+    iterations(iterations),
+    stopped(false)
+{
+    startMeasurement();
+}
+
+void State::startMeasurement()
+{
+    startAllocations = getAllocationCount();
+    startTime = std::chrono::steady_clock::now();
+    stopped = false;
+}
+
+void State::stopMeasurement()
+{
+    if (stopped)
+        return;
+    stopTime = std::chrono::steady_clock::now();
+    stopAllocations = getAllocationCount();
+    stopped = true;
+}
+
+std::chrono::steady_clock::duration State::getElapsed() const
+{
+    return stopTime - startTime;
+}
+
+std::size_t State::getAllocations() const
+{
+    return stopAllocations - startAllocations;
+}
+
+BenchmarkRegistration::BenchmarkRegistration(const std::string& name, const BenchmarkFunction& benchmarkFunction)
+{
+    getBenchmarks().emplace(name, benchmarkFunction);
+}
+
+int shareddatalayer::bench::runBenchmarks(int argc, char** argv)
+{
+    const std::string filter(argc > 1 ? argv[1] : "");
+    std::cout << std::left << std::setw(48) << "benchmark"
+              << std::right << std::setw(14) << "iterations"
+              << std::setw(14) << "ns/op"
+              << std::setw(14) << "allocs/op" << std::endl;
+    for (const auto& i : getBenchmarks())
+    {
+        if (i.first.find(filter) == std::string::npos)
+            continue;
+        const auto iterations(calibrate(i.second));
+        std::size_t allocations;
+        const auto elapsed(run(i.second, iterations, allocations));
+        const auto nanoseconds(std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(elapsed));
+        std::cout << std::left << std::setw(48) << i.first
+                  << std::right << std::setw(14) << iterations
+                  << std::setw(14) << std::fixed << std::setprecision(1) << nanoseconds.count() / iterations
+                  << std::setw(14) << std::setprecision(2) << static_cast<double>(allocations) / iterations
+                  << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
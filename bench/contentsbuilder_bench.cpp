@@ -0,0 +1,70 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include "private/bench/benchmark.hpp"
+#include "private/redis/contents.hpp"
+#include "private/redis/contentsbuilder.hpp"
+
+using namespace shareddatalayer;
+using namespace shareddatalayer::redis;
+
+namespace
+{
+    AsyncConnection::DataMap buildDataMap(std::size_t size)
+    {
+        AsyncConnection::DataMap dataMap;
+        for (std::size_t i(0); i < size; ++i)
+            dataMap.emplace("key" + std::to_string(i), AsyncConnection::Data(100, 0xab));
+        return dataMap;
+    }
+
+    AsyncConnection::Keys buildKeys(std::size_t size)
+    {
+        AsyncConnection::Keys keys;
+        for (std::size_t i(0); i < size; ++i)
+            keys.insert("key" + std::to_string(i));
+        return keys;
+    }
+}
+
+SHAREDDATALAYER_BENCHMARK(ContentsBuilderBuildMset10)
+{
+    const ContentsBuilder contentsBuilder(',');
+    const auto dataMap(buildDataMap(10));
+    state.startMeasurement();
+    for (std::size_t i(0); i < state.getIterations(); ++i)
+    {
+        const auto contents(contentsBuilder.build("MSET", "namespace", dataMap));
+        bench::doNotOptimize(contents.stack.data());
+    }
+}
+
+SHAREDDATALAYER_BENCHMARK(ContentsBuilderBuildMget10)
+{
+    const ContentsBuilder contentsBuilder(',');
+    const auto keys(buildKeys(10));
+    state.startMeasurement();
+    for (std::size_t i(0); i < state.getIterations(); ++i)
+    {
+        const auto contents(contentsBuilder.build("MGET", "namespace", keys));
+        bench::doNotOptimize(contents.stack.data());
+    }
+}
@@ -0,0 +1,44 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include "private/bench/benchmark.hpp"
+#include "private/engineimpl.hpp"
+#include "private/eventfd.hpp"
+
+using namespace shareddatalayer;
+
+SHAREDDATALAYER_BENCHMARK(EventFDPost)
+{
+    EngineImpl engine;
+    EventFD eventFD(engine);
+    std::size_t executed(0);
+    state.startMeasurement();
+    for (std::size_t i(0); i < state.getIterations(); ++i)
+    {
+        eventFD.post([&executed]() { ++executed; });
+        /* Posted callbacks are executed in batches like in a busy event loop. */
+        if ((i % 1000) == 999)
+            engine.handleEvents();
+    }
+    engine.handleEvents();
+    state.stopMeasurement();
+    bench::doNotOptimize(executed);
+}
@@ -0,0 +1,112 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include "private/bench/fakehiredissystem.hpp"
+#include <cstring>
+
+using namespace shareddatalayer;
+using namespace shareddatalayer::bench;
+
+CannedReply::CannedReply(const std::string& status):
+    string(status),
+    reply()
+{
+    reply.type = REDIS_REPLY_STATUS;
+    reply.str = &string[0];
+    reply.len = string.size();
+}
+
+CannedReply::CannedReply(std::size_t elements, const std::string& string):
+    string(string),
+    elements(elements),
+    reply()
+{
+    for (auto& i : this->elements)
+    {
+        std::memset(&i, 0, sizeof(i));
+        i.type = REDIS_REPLY_STRING;
+        i.str = &this->string[0];
+        i.len = this->string.size();
+        elementPointers.push_back(&i);
+    }
+    reply.type = REDIS_REPLY_ARRAY;
+    reply.elements = elements;
+    reply.element = elementPointers.data();
+}
+
+FakeHiredisSystem::FakeHiredisSystem():
+    context(),
+    reply(nullptr)
+{
+}
+
+void FakeHiredisSystem::setReply(const CannedReply& cannedReply)
+{
+    reply = &cannedReply.get();
+}
+
+void FakeHiredisSystem::replyAll()
+{
+    /* Callbacks may dispatch new commands, those are replied on the next call. */
+    replying.swap(pending);
+    for (const auto& i : replying)
+        i.fn(&context, const_cast<redisReply*>(reply), i.privdata);
+    replying.clear();
+}
+
+redisAsyncContext* FakeHiredisSystem::redisAsyncConnect(const char*, int)
+{
+    return &context;
+}
+
+int FakeHiredisSystem::redisAsyncSetConnectCallback(redisAsyncContext*, redisConnectCallback*)
+{
+    return REDIS_OK;
+}
+
+int FakeHiredisSystem::redisAsyncSetDisconnectCallback(redisAsyncContext*, redisDisconnectCallback*)
+{
+    return REDIS_OK;
+}
+
+int FakeHiredisSystem::redisAsyncCommandArgv(redisAsyncContext*,
+                                             redisCallbackFn* fn,
+                                             void* privdata,
+                                             int,
+                                             const char**,
+                                             const size_t*)
+{
+    pending.push_back({ fn, privdata });
+    return REDIS_OK;
+}
+
+void FakeHiredisSystem::redisAsyncDisconnect(redisAsyncContext*)
+{
+}
+
+void FakeHiredisSystem::redisAsyncFree(redisAsyncContext*)
+{
+}
+
+NullEpollAdapter::NullEpollAdapter(Engine& engine, redis::HiredisSystem& hiredisSystem):
+    HiredisEpollAdapter(engine, hiredisSystem)
+{
+}
@@ -0,0 +1,63 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "private/bench/benchmark.hpp"
+
+namespace
+{
+    std::atomic<std::size_t> allocationCount(0);
+}
+
+/* Replacing the global allocation functions counts also the allocations done
+ * inside the SDL library.
+ */
+void* operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+#if defined(__cpp_sized_deallocation)
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+#endif
+
+std::size_t shareddatalayer::bench::getAllocationCount()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+int main(int argc, char** argv)
+{
+    return shareddatalayer::bench::runBenchmarks(argc, argv);
+}
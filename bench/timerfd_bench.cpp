@@ -0,0 +1,49 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include "private/bench/benchmark.hpp"
+#include "private/engineimpl.hpp"
+#include "private/timer.hpp"
+
+using namespace shareddatalayer;
+
+SHAREDDATALAYER_BENCHMARK(TimerFDArmAndDisarm)
+{
+    EngineImpl engine;
+    Timer timer(engine);
+    state.startMeasurement();
+    for (std::size_t i(0); i < state.getIterations(); ++i)
+    {
+        timer.arm(std::chrono::seconds(1), []() { });
+        timer.disarm();
+    }
+}
+
+SHAREDDATALAYER_BENCHMARK(TimerFDRearm)
+{
+    /* Operation deadlines re-arm the same timer for every operation. */
+    EngineImpl engine;
+    Timer timer(engine);
+    state.startMeasurement();
+    for (std::size_t i(0); i < state.getIterations(); ++i)
+        timer.arm(std::chrono::seconds(1), []() { });
+    state.stopMeasurement();
+}
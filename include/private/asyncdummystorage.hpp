@@ -23,6 +23,7 @@
 #define SHAREDDATALAYER_ASYNCDUMMYSTORAGE_HPP_
 
 #include <sdl/asyncstorage.hpp>
+#include "private/inlinefunction.hpp"
 
 namespace shareddatalayer
 {
@@ -55,6 +56,10 @@ namespace shareddatalayer
 
         void getAsync(const Namespace& ns, const Keys& keys, const GetAck& getAck) override;
 
+        void getViewsAsync(const Namespace& ns, const Keys& keys, const GetViewsAck& getViewsAck) override;
+
+        void getViewsAsync(const Namespace& ns, const Keys& keys, const DataVisitor& dataVisitor, const GetVisitAck& getVisitAck) override;
+
         void removeAsync(const Namespace& ns, const Keys& keys, const ModifyAck& modifyAck) override;
 
         void removeIfAsync(const Namespace& ns, const Key& key, const Data& data, const ModifyIfAck& modifyIfAck) override;
@@ -63,14 +68,34 @@ namespace shareddatalayer
 
         void listKeys(const Namespace& ns, const std::string& pattern, const FindKeysAck& findKeysAck) override;
 
+        void scanKeysAsync(const Namespace& ns, const std::string& pattern, std::size_t countHint, const ScanKeysAck& scanKeysAck) override;
+
         void removeAllAsync(const Namespace& ns, const ModifyAck& modifyAck) override;
 
+        void removeByPrefixAsync(const Namespace& ns, const std::string& keyPrefix, const ModifyAck& modifyAck) override;
+
+        void subscribeChannelAsync(const Namespace& ns, const Channels& channels, const NotificationCb& notificationCb, const ModifyAck& subscribeAck) override;
+
+        void unsubscribeChannelAsync(const Namespace& ns, const Channels& channels, const ModifyAck& unsubscribeAck) override;
+
+        void publishAsync(const Namespace& ns, const Channel& channel, const std::string& message, const ModifyAck& modifyAck) override;
+
+        void getBatchAsync(const NamespaceKeys& namespaceKeys, const GetBatchAck& getBatchAck) override;
+
+        void setBatchAsync(const NamespaceDataMaps& namespaceDataMaps, const ModifyAck& modifyAck) override;
+
+        void writeBatchAsync(const Namespace& ns, const WriteBatch& writeBatch, const WriteBatchAck& writeBatchAck) override;
+
+        void getStatisticsAsync(const GetStatisticsAck& getStatisticsAck) override;
+
+        void setOperationTimeout(const std::chrono::steady_clock::duration& timeout) override;
+
     private:
-        using Callback = std::function<void()>;
+        using Callback = InlineFunction<void(), 96>;
 
         std::shared_ptr<Engine> engine;
 
-        void postCallback(const Callback& callback);
+        void postCallback(Callback callback);
     };
 }
 
@@ -0,0 +1,184 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_ASYNCLOGWRITER_HPP_
+#define SHAREDDATALAYER_ASYNCLOGWRITER_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace shareddatalayer
+{
+    /**
+     * Moves the formatting of log messages out of the threads writing them. Messages are
+     * copied to a bounded lock-free ring, and a background flusher thread passes them to
+     * the output function. Writing never blocks: if the ring is full, the message is
+     * dropped and counted, and the flusher reports the number of dropped messages.
+     *
+     * The flusher passes at most RATE_LIMIT_BURST messages of one message site per
+     * RATE_LIMIT_INTERVAL to the output and reports the number of suppressed ones when the
+     * interval ends. Loggers are stream based and do not know their call sites, thus a
+     * message site is identified by the severity and the message text with digits ignored.
+     *
+     * Messages of severity LOG_CRIT and higher, and all messages after the writer has been
+     * stopped, are passed to the output function synchronously, thus the output function
+     * must be thread safe. Messages already in the ring are flushed before a synchronous
+     * LOG_CRIT message, so that it does not overtake them.
+     *
+     * Messages longer than MAX_MESSAGE_LENGTH are cut and end with a truncation marker.
+     */
+    class AsyncLogWriter
+    {
+    public:
+        using Output = std::function<void(int level, const char* text, std::size_t length)>;
+
+        static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+        static constexpr std::size_t MAX_MESSAGE_LENGTH = 512;
+        static constexpr unsigned int RATE_LIMIT_BURST = 10;
+        static const std::chrono::steady_clock::duration RATE_LIMIT_INTERVAL;
+        static const std::chrono::steady_clock::duration FLUSH_INTERVAL;
+
+        AsyncLogWriter(const std::string& prefix, const Output& output);
+
+        AsyncLogWriter(const std::string& prefix, const Output& output, std::size_t capacity);
+
+        ~AsyncLogWriter();
+
+        AsyncLogWriter(const AsyncLogWriter&) = delete;
+
+        AsyncLogWriter& operator = (const AsyncLogWriter&) = delete;
+
+        /**
+         * Creates a started writer shared by the loggers of the process. The writer is never
+         * destroyed, so that static objects can log while the process exits, but it is stopped
+         * at exit to write the remaining messages. In a child process created with fork the
+         * writer writes synchronously.
+         */
+        static AsyncLogWriter& createProcessWriter(const std::string& prefix, const Output& output);
+
+        /**
+         * Starts the flusher thread, which flushes the ring when woken up by a write, and at
+         * least every FLUSH_INTERVAL. Returns false if the thread cannot be created.
+         */
+        bool start();
+
+        /**
+         * Stops the flusher thread and flushes the remaining messages. After that all
+         * messages are passed to the output function synchronously.
+         */
+        void stop();
+
+        /**
+         * Called in the child process after fork, where the flusher thread does not exist.
+         * Switches to synchronous writing without touching the state of the flusher.
+         */
+        void stopAfterFork();
+
+        /**
+         * Writes one message, prefixed with the given logger prefix. Can be called from any thread.
+         * Returns false if the message was dropped because the ring is full.
+         */
+        bool write(int level, const std::string& loggerPrefix, const char* s, std::size_t n) noexcept;
+
+        /**
+         * Waits until the flusher has written the messages written before the call, but at
+         * most the given time.
+         */
+        void waitFlushed(const std::chrono::steady_clock::duration& timeout);
+
+        /**
+         * Passes the messages in the ring to the output and reports the dropped and the
+         * suppressed messages. Called by the flusher thread, or directly if the flusher thread
+         * has not been started.
+         */
+        void flush(const std::chrono::steady_clock::time_point& now);
+
+        std::uint64_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+        std::uint64_t getSuppressedCount() const { return suppressed.load(std::memory_order_relaxed); }
+
+    private:
+        struct Slot
+        {
+            std::atomic<std::size_t> sequence;
+            int level;
+            std::chrono::steady_clock::time_point time;
+            std::size_t prefixLength;
+            std::size_t length;
+            char text[MAX_MESSAGE_LENGTH];
+        };
+
+        struct Site
+        {
+            std::chrono::steady_clock::time_point windowStart;
+            unsigned int count;
+            std::uint64_t suppressed;
+            int level;
+            std::string prefix;
+            std::string message;
+        };
+
+        const std::string prefix;
+        const Output output;
+        const std::size_t capacity;
+        std::unique_ptr<Slot[]> slots;
+        std::atomic<std::size_t> writePosition;
+        std::atomic<std::size_t> readPosition;
+        std::atomic<std::uint64_t> dropped;
+        std::atomic<std::uint64_t> suppressed;
+        std::uint64_t reportedDropped;
+        std::unordered_map<std::string, Site> sites;
+        std::atomic<bool> stopped;
+        /* Serializes reading the ring, which is done by the flusher and by critical writes. */
+        std::mutex flushMutex;
+        std::mutex mutex;
+        std::condition_variable wakeup;
+        std::condition_variable flushed;
+        std::thread thread;
+        AsyncLogWriter* nextProcessWriter;
+
+        static void stopProcessWriters();
+
+        static void stopProcessWritersAfterFork();
+
+        void run();
+
+        void flushLocked(const std::chrono::steady_clock::time_point& now);
+
+        bool isEmpty() const;
+
+        void pass(const Slot& slot);
+
+        void reportSuppressed(const Site& site);
+
+        void expireSites(const std::chrono::steady_clock::time_point& now);
+    };
+}
+
+#endif
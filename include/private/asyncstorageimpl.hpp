@@ -29,11 +29,13 @@
 #include "private/databaseconfigurationimpl.hpp"
 #include "private/logger.hpp"
 #include "private/namespaceconfigurationsimpl.hpp"
+#include "private/statisticscollector.hpp"
 #include "private/redis/asyncdatabasediscovery.hpp"
 #include "private/redis/asyncredisstorage.hpp"
 
 namespace shareddatalayer
 {
+    class AsyncDummyStorage;
     class Engine;
 
     class AsyncStorageImpl: public AsyncStorage
@@ -63,7 +65,8 @@ namespace shareddatalayer
                          std::shared_ptr<DatabaseConfiguration> databaseConfiguration,
                          std::shared_ptr<NamespaceConfigurations> namespaceConfigurations,
                          std::shared_ptr<Logger> logger,
-                         const AsyncDatabaseDiscoveryCreator& asyncDatabaseDiscoveryCreator);
+                         const AsyncDatabaseDiscoveryCreator& asyncDatabaseDiscoveryCreator,
+                         const StatisticsConfiguration& statisticsConfiguration);
 
         int fd() const override;
 
@@ -79,6 +82,10 @@ namespace shareddatalayer
 
         void getAsync(const Namespace& ns, const Keys& keys, const GetAck& getAck) override;
 
+        void getViewsAsync(const Namespace& ns, const Keys& keys, const GetViewsAck& getViewsAck) override;
+
+        void getViewsAsync(const Namespace& ns, const Keys& keys, const DataVisitor& dataVisitor, const GetVisitAck& getVisitAck) override;
+
         void removeAsync(const Namespace& ns, const Keys& keys, const ModifyAck& modifyAck) override;
 
         void removeIfAsync(const Namespace& ns, const Key& key, const Data& data, const ModifyIfAck& modifyIfAck) override;
@@ -87,8 +94,28 @@ namespace shareddatalayer
 
         void listKeys(const Namespace& ns, const std::string& pattern, const FindKeysAck& findKeysAck) override;
 
+        void scanKeysAsync(const Namespace& ns, const std::string& pattern, std::size_t countHint, const ScanKeysAck& scanKeysAck) override;
+
         void removeAllAsync(const Namespace& ns, const ModifyAck& modifyAck) override;
 
+        void removeByPrefixAsync(const Namespace& ns, const std::string& keyPrefix, const ModifyAck& modifyAck) override;
+
+        void subscribeChannelAsync(const Namespace& ns, const Channels& channels, const NotificationCb& notificationCb, const ModifyAck& subscribeAck) override;
+
+        void unsubscribeChannelAsync(const Namespace& ns, const Channels& channels, const ModifyAck& unsubscribeAck) override;
+
+        void publishAsync(const Namespace& ns, const Channel& channel, const std::string& message, const ModifyAck& modifyAck) override;
+
+        void getBatchAsync(const NamespaceKeys& namespaceKeys, const GetBatchAck& getBatchAck) override;
+
+        void setBatchAsync(const NamespaceDataMaps& namespaceDataMaps, const ModifyAck& modifyAck) override;
+
+        void writeBatchAsync(const Namespace& ns, const WriteBatch& writeBatch, const WriteBatchAck& writeBatchAck) override;
+
+        void getStatisticsAsync(const GetStatisticsAck& getStatisticsAck) override;
+
+        void setOperationTimeout(const std::chrono::steady_clock::duration& timeout) override;
+
         //public for UT
         AsyncStorage& getOperationHandler(const std::string& ns);
     private:
@@ -98,8 +125,11 @@ namespace shareddatalayer
         const boost::optional<PublisherId> publisherId;
         std::shared_ptr<Logger> logger;
         AsyncDatabaseDiscoveryCreator asyncDatabaseDiscoveryCreator;
+        std::chrono::steady_clock::duration operationTimeout;
 
         std::vector<std::shared_ptr<AsyncRedisStorage>> asyncStorages;
+        std::shared_ptr<AsyncDummyStorage> dummyStorage;
+        StatisticsCollector statisticsCollector;
 
         AsyncStorage& getRedisHandler(const std::string& ns);
         AsyncStorage& getDummyHandler();
@@ -107,6 +137,9 @@ namespace shareddatalayer
         void setAsyncRedisStorageHandlers(const std::string& ns);
         void setAsyncRedisStorageHandlersForCluster(const std::string& ns);
         AsyncStorage& getAsyncRedisStorageHandler(const std::string& ns);
+        std::size_t getAsyncRedisStorageHandlerIndex(const std::string& ns);
+        std::string getConnection(const std::string& ns);
+        bool isMeasured(const Namespace& ns) const;
     };
 }
 
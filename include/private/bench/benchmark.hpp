@@ -0,0 +1,95 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_BENCH_BENCHMARK_HPP_
+#define SHAREDDATALAYER_BENCH_BENCHMARK_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace shareddatalayer
+{
+    namespace bench
+    {
+        /*
+         * Measurement of one benchmark run. The measurement starts when the state is
+         * created, thus a benchmark doing setup before its measured loop calls
+         * startMeasurement() after the setup and stopMeasurement() before the teardown.
+         */
+        class State
+        {
+        public:
+            explicit State(std::size_t iterations);
+
+            State(const State&) = delete;
+
+            State& operator = (const State&) = delete;
+
+            std::size_t getIterations() const { return iterations; }
+
+            void startMeasurement();
+
+            void stopMeasurement();
+
+            std::chrono::steady_clock::duration getElapsed() const;
+
+            std::size_t getAllocations() const;
+
+        private:
+            const std::size_t iterations;
+            std::chrono::steady_clock::time_point startTime;
+            std::chrono::steady_clock::time_point stopTime;
+            std::size_t startAllocations;
+            std::size_t stopAllocations;
+            bool stopped;
+        };
+
+        using BenchmarkFunction = std::function<void(State& state)>;
+
+        class BenchmarkRegistration
+        {
+        public:
+            BenchmarkRegistration(const std::string& name, const BenchmarkFunction& benchmarkFunction);
+        };
+
+        /* Number of allocations done with operator new by the whole process so far. */
+        std::size_t getAllocationCount();
+
+        /* Runs the registered benchmarks whose name contains the first argument, or all. */
+        int runBenchmarks(int argc, char** argv);
+
+        /* Prevents the compiler from optimizing away the computation of the value. */
+        template <typename T>
+        void doNotOptimize(const T& value)
+        {
+            asm volatile("" : : "r,m"(value) : "memory");
+        }
+    }
+}
+
+#define SHAREDDATALAYER_BENCHMARK(name) \
+    static void name##Benchmark(::shareddatalayer::bench::State& state); \
+    static const ::shareddatalayer::bench::BenchmarkRegistration name##Registration(#name, name##Benchmark); \
+    static void name##Benchmark(::shareddatalayer::bench::State& state)
+
+#endif
@@ -0,0 +1,148 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_BENCH_FAKEHIREDISSYSTEM_HPP_
+#define SHAREDDATALAYER_BENCH_FAKEHIREDISSYSTEM_HPP_
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include "private/logger.hpp"
+#include "private/redis/hiredisepolladapter.hpp"
+#include "private/redis/hiredissystem.hpp"
+
+namespace shareddatalayer
+{
+    namespace bench
+    {
+        /* Status reply or an array reply of identical string elements. */
+        class CannedReply
+        {
+        public:
+            explicit CannedReply(const std::string& status);
+
+            CannedReply(std::size_t elements, const std::string& string);
+
+            CannedReply(const CannedReply&) = delete;
+
+            CannedReply& operator = (const CannedReply&) = delete;
+
+            const redisReply& get() const { return reply; }
+
+        private:
+            std::string string;
+            std::vector<redisReply> elements;
+            std::vector<redisReply*> elementPointers;
+            redisReply reply;
+        };
+
+        /*
+         * In-process stand-in for hiredis. Commands are not formatted nor sent anywhere,
+         * each dispatched command is answered with the current canned reply when
+         * replyAll() is called, thus the measured cost is the cost of SDL alone.
+         */
+        class FakeHiredisSystem: public redis::HiredisSystem
+        {
+        public:
+            FakeHiredisSystem();
+
+            void setReply(const CannedReply& cannedReply);
+
+            void replyAll();
+
+            redisAsyncContext* redisAsyncConnect(const char* ip, int port) override;
+
+            int redisAsyncSetConnectCallback(redisAsyncContext* ac, redisConnectCallback* fn) override;
+
+            int redisAsyncSetDisconnectCallback(redisAsyncContext* ac, redisDisconnectCallback* fn) override;
+
+            int redisAsyncCommandArgv(redisAsyncContext* ac,
+                                      redisCallbackFn* fn,
+                                      void* privdata,
+                                      int argc,
+                                      const char** argv,
+                                      const size_t* argvlen) override;
+
+            void redisAsyncDisconnect(redisAsyncContext* ac) override;
+
+            void redisAsyncFree(redisAsyncContext* ac) override;
+
+        private:
+            struct Command
+            {
+                redisCallbackFn* fn;
+                void* privdata;
+            };
+
+            redisAsyncContext context;
+            const redisReply* reply;
+            std::vector<Command> pending;
+            std::vector<Command> replying;
+        };
+
+        /* Epoll adapter which monitors nothing, the fake connection has no file descriptor. */
+        class NullEpollAdapter: public redis::HiredisEpollAdapter
+        {
+        public:
+            NullEpollAdapter(Engine& engine, redis::HiredisSystem& hiredisSystem);
+
+            void attach(redisAsyncContext*) override { }
+
+            void addRead() override { }
+
+            void delRead() override { }
+
+            void addWrite() override { }
+
+            void delWrite() override { }
+
+            void cleanUp() override { }
+        };
+
+        /* Logger which discards everything, keeps the benchmark output readable. */
+        class NullLogger: public Logger
+        {
+        public:
+            NullLogger(): os(nullptr) { }
+
+            std::ostream& emerg() override { return os; }
+
+            std::ostream& alert() override { return os; }
+
+            std::ostream& crit() override { return os; }
+
+            std::ostream& error() override { return os; }
+
+            std::ostream& warning() override { return os; }
+
+            std::ostream& notice() override { return os; }
+
+            std::ostream& info() override { return os; }
+
+            std::ostream& debug() override { return os; }
+
+        private:
+            std::ostream os;
+        };
+    }
+}
+
+#endif
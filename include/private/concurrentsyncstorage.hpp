@@ -0,0 +1,130 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_CONCURRENTSYNCSTORAGE_HPP_
+#define SHAREDDATALAYER_CONCURRENTSYNCSTORAGE_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <sdl/asyncstorage.hpp>
+#include <sdl/syncstorage.hpp>
+
+namespace shareddatalayer
+{
+    class System;
+
+    /**
+     * SyncStorage implementation which can be shared between threads.
+     *
+     * All threads use the same AsyncStorage instance, thus the same engine and backend
+     * connections. Each call has its own completion slot, so the operations of several
+     * threads are pipelined over the connection. While operations are pending, one of
+     * the waiting threads polls the AsyncStorage file descriptor and handles the events
+     * on behalf of all of them, the others sleep until their own operation completes.
+     */
+    class ConcurrentSyncStorage: public SyncStorage
+    {
+    public:
+        explicit ConcurrentSyncStorage(std::unique_ptr<AsyncStorage> asyncStorage);
+
+        ConcurrentSyncStorage(std::unique_ptr<AsyncStorage> asyncStorage,
+                              System& system);
+
+        void waitReady(const Namespace& ns, const std::chrono::steady_clock::duration& timeout) override;
+
+        void set(const Namespace& ns, const DataMap& dataMap) override;
+
+        bool setIf(const Namespace& ns, const Key& key, const Data& oldData, const Data& newData) override;
+
+        bool setIfNotExists(const Namespace& ns, const Key& key, const Data& data) override;
+
+        DataMap get(const Namespace& ns, const Keys& keys) override;
+
+        void remove(const Namespace& ns, const Keys& keys) override;
+
+        bool removeIf(const Namespace& ns, const Key& key, const Data& data) override;
+
+        Keys findKeys(const Namespace& ns, const std::string& keyPrefix) override;
+
+        Keys listKeys(const Namespace& ns, const std::string& pattern) override;
+
+        void removeAll(const Namespace& ns) override;
+
+        void removeByPrefix(const Namespace& ns, const std::string& keyPrefix) override;
+
+        std::vector<bool> writeBatch(const Namespace& ns, const WriteBatch& writeBatch) override;
+
+        void setOperationTimeout(const std::chrono::steady_clock::duration& timeout) override;
+
+        static constexpr int NO_TIMEOUT = -1;
+
+    private:
+        struct Completion
+        {
+            bool done;
+            std::error_code error;
+            bool status;
+            DataMap dataMap;
+            Keys keys;
+            std::vector<bool> statuses;
+
+            Completion();
+        };
+
+        using Request = std::function<void(const std::shared_ptr<Completion>& completion)>;
+
+        std::unique_ptr<AsyncStorage> asyncStorage;
+        System& system;
+        std::mutex mutex;
+        std::condition_variable eventsHandled;
+        bool polling;
+        std::chrono::steady_clock::duration operationTimeout;
+
+        bool waitSdlToBeReady(std::unique_lock<std::mutex>& lock,
+                              const Namespace& ns,
+                              const std::chrono::steady_clock::duration& timeout,
+                              std::error_code& error);
+
+        std::shared_ptr<Completion> execute(const Namespace& ns, const Request& request);
+
+        bool waitForCompletion(std::unique_lock<std::mutex>& lock,
+                               const Completion& completion,
+                               const std::chrono::steady_clock::duration& timeout);
+
+        void pollAndHandleEvents(std::unique_lock<std::mutex>& lock, int timeout_ms);
+
+        static AsyncStorage::ModifyAck modifyAck(const std::shared_ptr<Completion>& completion);
+
+        static AsyncStorage::ModifyIfAck modifyIfAck(const std::shared_ptr<Completion>& completion);
+
+        static AsyncStorage::GetAck getAck(const std::shared_ptr<Completion>& completion);
+
+        static AsyncStorage::FindKeysAck findKeysAck(const std::shared_ptr<Completion>& completion);
+
+        static AsyncStorage::WriteBatchAck writeBatchAck(const std::shared_ptr<Completion>& completion);
+    };
+}
+
+#endif
@@ -27,6 +27,8 @@
 #define SENTINEL_PORT_ENV_VAR_NAME "DBAAS_SERVICE_SENTINEL_PORT"
 #define SENTINEL_MASTER_NAME_ENV_VAR_NAME "DBAAS_MASTER_NAME"
 #define DB_CLUSTER_ADDR_LIST_ENV_VAR_NAME "DBAAS_CLUSTER_ADDR_LIST"
+#define SLOW_OPERATION_THRESHOLD_ENV_VAR_NAME "SDL_SLOW_OPERATION_THRESHOLD_MS"
+#define STATISTICS_ENABLED_ENV_VAR_NAME "SDL_STATISTICS_ENABLED"
 
 #include <iosfwd>
 #include <string>
@@ -41,6 +43,8 @@ namespace shareddatalayer
     class DatabaseConfiguration;
     class NamespaceConfigurations;
     class System;
+    struct SlowOperationLogConfiguration;
+    struct StatisticsConfiguration;
 
     class ConfigurationReader
     {
@@ -57,6 +61,18 @@ namespace shareddatalayer
 
         void readNamespaceConfigurations(NamespaceConfigurations& namespaceConfigurations);
 
+        /**
+         * Threshold given in environment variable overrides the threshold of json
+         * configuration. Configuration is left untouched if the log is not configured.
+         */
+        void readSlowOperationLogConfiguration(SlowOperationLogConfiguration& slowOperationLogConfiguration);
+
+        /**
+         * Enabling given in environment variable overrides the enabling of json
+         * configuration. Configuration is left untouched if statistics are not configured.
+         */
+        void readStatisticsConfiguration(StatisticsConfiguration& statisticsConfiguration);
+
         /**
          * Overrides existing json configuration with json format input stream given as
          * parameter. Does not override existing configration if existing configration
@@ -78,6 +94,11 @@ namespace shareddatalayer
         boost::optional<boost::property_tree::ptree> jsonDatabaseConfiguration;
         std::string sourceForDatabaseConfiguration;
         std::unordered_map<std::string, std::pair<boost::property_tree::ptree, std::string>> jsonNamespaceConfigurations;
+        boost::optional<boost::property_tree::ptree> jsonSlowOperationLogConfiguration;
+        std::string sourceForSlowOperationLogConfiguration;
+        boost::optional<boost::property_tree::ptree> jsonStatisticsConfiguration;
+        std::string sourceForStatisticsConfiguration;
+        System& system;
         std::shared_ptr<Logger> logger;
 
         void readConfigurationFromDirectories(const Directories& directories);
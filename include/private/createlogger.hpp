@@ -37,6 +37,9 @@ namespace shareddatalayer
     void logErrorOnce(const std::string& msg) noexcept;
 
     void logInfoOnce(const std::string& msg) noexcept;
+
+    /* Waits until the messages logged so far have been written, for example before abort. */
+    void waitLogsFlushed() noexcept;
 }
 
 #endif
@@ -23,6 +23,7 @@
 #define SHAREDDATALAYER_ENGINE_HPP_
 
 #include <functional>
+#include "private/inlinefunction.hpp"
 #include "private/timer.hpp"
 
 namespace shareddatalayer
@@ -126,7 +127,7 @@ namespace shareddatalayer
          */
         virtual void deleteMonitoredFD(int fd) = 0;
 
-        using Callback = std::function<void()>;
+        using Callback = InlineFunction<void(), 96>;
 
         /**
          * Post a callback function. The function will be called by the
@@ -139,7 +140,7 @@ namespace shareddatalayer
          *
          * @note This function <b>is</b> thread-safe.
          */
-        virtual void postCallback(const Callback& callback) = 0;
+        virtual void postCallback(Callback callback) = 0;
 
         virtual void run() = 0;
 
@@ -56,7 +56,7 @@ namespace shareddatalayer
 
         void deleteMonitoredFD(int fd) override;
 
-        void postCallback(const Callback& callback) override;
+        void postCallback(Callback callback) override;
 
         void run() override;
 
@@ -55,7 +55,8 @@ namespace shareddatalayer
         BACKEND_CONNECTION_LOST,
         BACKEND_NOT_READY,
         BACKEND_REJECTED_REQUEST,
-        BACKEND_ERROR
+        BACKEND_ERROR,
+        BACKEND_REPLY_TIMEOUT
     };
 
     std::error_condition make_error_condition(shareddatalayer::InternalError ec);
@@ -73,6 +74,7 @@ namespace shareddatalayer
             NOT_CONNECTED,
             IO_ERROR,
             WRITING_TO_SLAVE,
+            NO_SCRIPT,
             //Keep this always as last item. Used in unit tests to loop all enum values.
             END_MARKER
         };
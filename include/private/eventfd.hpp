@@ -22,17 +22,37 @@
 #ifndef SHAREDDATALAYER_EVENTFD_HPP_
 #define SHAREDDATALAYER_EVENTFD_HPP_
 
-#include <functional>
-#include <list>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <mutex>
+#include <thread>
+#include "private/engine.hpp"
 #include "private/filedescriptor.hpp"
 
 namespace shareddatalayer
 {
     class FDMonitor;
-    class Engine;
     class System;
 
+    /**
+     * EventFD executes posted callbacks in the thread handling the events of
+     * the eventfd. Callbacks are queued to a lock-free multi-producer
+     * single-consumer queue and the eventfd is written only when the queue
+     * becomes non-empty, so a burst of posts causes only one wakeup. Posts done
+     * by callbacks executed by EventFD itself do not write the eventfd at all,
+     * the wakeup is done once after the callbacks have been executed.
+     *
+     * The engine marks its thread for the whole handling of the events of one
+     * epoll_wait() round. Posts done by the marked thread, for example by the
+     * handlers of the connections, do not write the eventfd either. The posted
+     * callbacks are executed when the engine ends the round.
+     *
+     * Queue nodes are taken from a pool and returned to it after the callback
+     * has been executed, so posting does not allocate once the pool has grown
+     * to the number of callbacks pending at the same time. The pool grows in
+     * blocks of doubling size and is released only when EventFD is destroyed.
+     */
     class EventFD
     {
     public:
@@ -42,9 +62,18 @@ namespace shareddatalayer
 
         ~EventFD();
 
-        using Callback = std::function<void()>;
+        using Callback = Engine::Callback;
 
-        void post(const Callback& callback);
+        void post(Callback callback);
+
+        /** Mark the calling thread as handling the events of the engine. */
+        void beginEventHandling();
+
+        /**
+         * Execute the callbacks posted by the marked thread and clear the mark. The
+         * eventfd is written only if callbacks are still posted after a few rounds.
+         */
+        void endEventHandling();
 
         EventFD(EventFD&&) = delete;
         EventFD(const EventFD&) = delete;
@@ -52,22 +81,50 @@ namespace shareddatalayer
         EventFD& operator = (const EventFD&) = delete;
 
     private:
-        using Callbacks = std::list<Callback>;
+        struct Node
+        {
+            Callback callback;
+            std::atomic<Node*> next;
+            std::atomic<uint32_t> nextFree;
+            uint32_t index;
+        };
+
+        static const unsigned int MAX_DEFERRED_ROUNDS = 16U;
+        static const unsigned int FIRST_BLOCK_BITS = 6U;
+        static const unsigned int MAX_BLOCKS = 32U - FIRST_BLOCK_BITS;
+
+        Node* allocate(Callback callback);
+
+        void release(Node* node);
 
-        void atomicPushBack(const Callback& callback);
+        Node* popFree();
 
-        Callbacks atomicPopAll();
+        void pushFree(Node* node);
+
+        Node* grow();
+
+        Node* getNode(uint32_t index) const;
+
+        void push(Node* node);
+
+        void wakeup();
 
         void handleEvents();
 
         void executeCallbacks();
 
-        static void popAndExecuteFirstCallback(Callbacks& callbacks);
-
         System& system;
         FileDescriptor fd;
-        Callbacks callbacks;
-        std::mutex callbacksMutex;
+        std::array<std::atomic<Node*>, MAX_BLOCKS> blocks;
+        unsigned int blockCount;
+        std::mutex growMutex;
+        /* Index of the first free node plus one in the low bits, ABA tag in the high bits */
+        std::atomic<uint64_t> freeNodes;
+        Node* head;
+        std::atomic<Node*> tail;
+        std::atomic<bool> signaled;
+        std::atomic<std::thread::id> executingThread;
+        bool wakeupDeferred;
     };
 }
 
@@ -0,0 +1,284 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_INLINEFUNCTION_HPP_
+#define SHAREDDATALAYER_INLINEFUNCTION_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace shareddatalayer
+{
+    template <typename Signature, std::size_t Size = 64>
+    class InlineFunction;
+
+    /**
+     * InlineFunction is a replacement for std::function used in the internal
+     * callback paths. Callables which are at most Size bytes and can be moved
+     * without exceptions are stored inside the object, bigger callables are
+     * allocated from heap like std::function does.
+     *
+     * Unlike std::function, InlineFunction is move-only, thus it can store
+     * move-only callables and callables are never copied. Moving never
+     * allocates and leaves the source empty.
+     */
+    template <typename R, typename... Args, std::size_t Size>
+    class InlineFunction<R(Args...), Size>
+    {
+    public:
+        InlineFunction() noexcept:
+            ops(nullptr)
+        {
+        }
+
+        InlineFunction(std::nullptr_t) noexcept:
+            ops(nullptr)
+        {
+        }
+
+        template <typename F,
+                  typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, InlineFunction>::value>::type,
+                  typename = decltype(std::declval<typename std::decay<F>::type&>()(std::declval<Args>()...))>
+        InlineFunction(F&& f):
+            ops(nullptr)
+        {
+            using Target = typename std::decay<F>::type;
+            if (!isEmpty(f))
+                construct<Target>(std::forward<F>(f), std::integral_constant<bool, IsStoredInline<Target>::value>());
+        }
+
+        InlineFunction(const InlineFunction&) = delete;
+
+        InlineFunction(InlineFunction&& other) noexcept:
+            ops(nullptr)
+        {
+            moveFrom(other);
+        }
+
+        ~InlineFunction()
+        {
+            reset();
+        }
+
+        InlineFunction& operator = (const InlineFunction&) = delete;
+
+        InlineFunction& operator = (InlineFunction&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        InlineFunction& operator = (std::nullptr_t) noexcept
+        {
+            reset();
+            return *this;
+        }
+
+        R operator () (Args... args) const
+        {
+            if (!ops)
+                throw std::bad_function_call();
+            return ops->invoke(const_cast<Storage*>(&storage), std::forward<Args>(args)...);
+        }
+
+        explicit operator bool () const noexcept
+        {
+            return ops != nullptr;
+        }
+
+        /**
+         * Tells whether a callable of type F is stored inside the object, so that
+         * the callers can check with static_assert that their callbacks do not
+         * allocate.
+         */
+        template <typename F>
+        static constexpr bool isStoredInline() noexcept
+        {
+            return IsStoredInline<typename std::decay<F>::type>::value;
+        }
+
+    private:
+        using Storage = typename std::aligned_storage<Size, alignof(std::max_align_t)>::type;
+
+        struct Ops
+        {
+            R (*invoke)(void* storage, Args&&... args);
+            void (*move)(void* source, void* destination);
+            void (*destroy)(void* storage);
+        };
+
+        template <typename F>
+        struct IsStoredInline
+        {
+            static constexpr bool value = (sizeof(F) <= Size) &&
+                                          (alignof(F) <= alignof(std::max_align_t)) &&
+                                          std::is_nothrow_move_constructible<F>::value;
+        };
+
+        template <typename F>
+        struct InlineOps
+        {
+            static R invoke(void* storage, Args&&... args)
+            {
+                return (*static_cast<F*>(storage))(std::forward<Args>(args)...);
+            }
+
+            static void move(void* source, void* destination)
+            {
+                new (destination) F(std::move(*static_cast<F*>(source)));
+                static_cast<F*>(source)->~F();
+            }
+
+            static void destroy(void* storage)
+            {
+                static_cast<F*>(storage)->~F();
+            }
+
+            static const Ops ops;
+        };
+
+        template <typename F>
+        struct HeapOps
+        {
+            static R invoke(void* storage, Args&&... args)
+            {
+                return (**static_cast<F**>(storage))(std::forward<Args>(args)...);
+            }
+
+            static void move(void* source, void* destination)
+            {
+                *static_cast<F**>(destination) = *static_cast<F**>(source);
+            }
+
+            static void destroy(void* storage)
+            {
+                delete *static_cast<F**>(storage);
+            }
+
+            static const Ops ops;
+        };
+
+        Storage storage;
+        const Ops* ops;
+
+        template <typename F, typename G>
+        void construct(G&& g, std::true_type)
+        {
+            new (&storage) F(std::forward<G>(g));
+            ops = &InlineOps<F>::ops;
+        }
+
+        template <typename F, typename G>
+        void construct(G&& g, std::false_type)
+        {
+            *reinterpret_cast<F**>(&storage) = new F(std::forward<G>(g));
+            ops = &HeapOps<F>::ops;
+        }
+
+        void moveFrom(InlineFunction& other) noexcept
+        {
+            if (other.ops)
+            {
+                other.ops->move(&other.storage, &storage);
+                ops = other.ops;
+                other.ops = nullptr;
+            }
+        }
+
+        void reset() noexcept
+        {
+            if (ops)
+            {
+                ops->destroy(&storage);
+                ops = nullptr;
+            }
+        }
+
+        template <typename T>
+        static bool isEmpty(const T&)
+        {
+            return false;
+        }
+
+        template <typename T>
+        static bool isEmpty(T* pointer)
+        {
+            return pointer == nullptr;
+        }
+
+        template <typename S>
+        static bool isEmpty(const std::function<S>& function)
+        {
+            return !function;
+        }
+    };
+
+    template <typename Signature, std::size_t Size>
+    bool operator == (const InlineFunction<Signature, Size>& function, std::nullptr_t) noexcept
+    {
+        return !function;
+    }
+
+    template <typename Signature, std::size_t Size>
+    bool operator == (std::nullptr_t, const InlineFunction<Signature, Size>& function) noexcept
+    {
+        return !function;
+    }
+
+    template <typename Signature, std::size_t Size>
+    bool operator != (const InlineFunction<Signature, Size>& function, std::nullptr_t) noexcept
+    {
+        return static_cast<bool>(function);
+    }
+
+    template <typename Signature, std::size_t Size>
+    bool operator != (std::nullptr_t, const InlineFunction<Signature, Size>& function) noexcept
+    {
+        return static_cast<bool>(function);
+    }
+
+    template <typename R, typename... Args, std::size_t Size>
+    template <typename F>
+    const typename InlineFunction<R(Args...), Size>::Ops InlineFunction<R(Args...), Size>::InlineOps<F>::ops =
+    {
+        &InlineOps<F>::invoke,
+        &InlineOps<F>::move,
+        &InlineOps<F>::destroy
+    };
+
+    template <typename R, typename... Args, std::size_t Size>
+    template <typename F>
+    const typename InlineFunction<R(Args...), Size>::Ops InlineFunction<R(Args...), Size>::HeapOps<F>::ops =
+    {
+        &HeapOps<F>::invoke,
+        &HeapOps<F>::move,
+        &HeapOps<F>::destroy
+    };
+}
+
+#endif
@@ -22,6 +22,7 @@
 #ifndef SHAREDDATALAYER_NAMESPACECONFIGURATION_HPP_
 #define SHAREDDATALAYER_NAMESPACECONFIGURATION_HPP_
 
+#include <cstddef>
 #include <string>
 
 namespace shareddatalayer
@@ -32,15 +33,19 @@ namespace shareddatalayer
         bool dbBackendIsUsed;
         bool notificationsAreEnabled;
         const std::string sourceName;
+        /* Maximum number of entries in the near cache, zero when near cache is not used. */
+        std::size_t nearCacheSize;
 
         NamespaceConfiguration(const std::string& namespacePrefix,
                                bool useDbBackend,
                                bool enableNotifications,
-                               const std::string& sourceName):
+                               const std::string& sourceName,
+                               std::size_t nearCacheSize = 0):
             namespacePrefix(namespacePrefix),
             dbBackendIsUsed(useDbBackend),
             notificationsAreEnabled(enableNotifications),
-            sourceName(sourceName)
+            sourceName(sourceName),
+            nearCacheSize(nearCacheSize)
         {}
 
         bool operator==(const NamespaceConfiguration& nc) const
@@ -48,7 +53,8 @@ namespace shareddatalayer
             return namespacePrefix == nc.namespacePrefix &&
                    dbBackendIsUsed == nc.dbBackendIsUsed &&
                    notificationsAreEnabled == nc.notificationsAreEnabled &&
-                   sourceName == nc.sourceName;
+                   sourceName == nc.sourceName &&
+                   nearCacheSize == nc.nearCacheSize;
         }
     };
 }
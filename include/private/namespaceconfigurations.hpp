@@ -35,6 +35,8 @@ namespace shareddatalayer
         virtual void addNamespaceConfiguration(const NamespaceConfiguration& namespaceConfiguration) = 0;
         virtual bool isDbBackendUseEnabled(const std::string& ns) const = 0;
         virtual bool areNotificationsEnabled(const std::string& ns) const = 0;
+        virtual std::size_t getNearCacheSize(const std::string& ns) const = 0;
+        virtual bool isNearCacheUsed() const = 0;
         virtual std::string getDescription(const std::string& ns) const = 0;
         virtual bool isEmpty() const = 0;
 
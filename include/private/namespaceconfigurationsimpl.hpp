@@ -38,6 +38,8 @@ namespace shareddatalayer
         void addNamespaceConfiguration(const NamespaceConfiguration& namespaceConfiguration) override;
         bool isDbBackendUseEnabled(const std::string& ns) const override;
         bool areNotificationsEnabled(const std::string& ns) const override;
+        std::size_t getNearCacheSize(const std::string& ns) const override;
+        bool isNearCacheUsed() const override;
         std::string getDescription(const std::string& ns) const override;
         bool isEmpty() const override;
 
@@ -0,0 +1,107 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_NEARCACHE_HPP_
+#define SHAREDDATALAYER_NEARCACHE_HPP_
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <sdl/asyncstorage.hpp>
+
+namespace shareddatalayer
+{
+    /**
+     * Size bounded in-process cache of the data of one namespace. The least
+     * recently used entry is evicted when the cache is full.
+     *
+     * The cache does not know when the data is modified in the database. The
+     * owner must disable() the cache when it cannot receive modification
+     * notifications and invalidate() or clear() the cache on modifications.
+     * Every invalidation starts a new generation: data read from the database
+     * before an invalidation is not inserted to the cache after it.
+     */
+    class NearCache
+    {
+    public:
+        using Key = AsyncStorage::Key;
+        using Keys = AsyncStorage::Keys;
+        using Data = AsyncStorage::Data;
+        using Generation = std::uint64_t;
+
+        explicit NearCache(std::size_t maxSize);
+
+        NearCache(const NearCache&) = delete;
+        NearCache& operator = (const NearCache&) = delete;
+
+        /**
+         * Start serving data from the cache. A new cache is disabled. Data read
+         * before enabling is not inserted to the cache.
+         */
+        void enable();
+
+        /**
+         * Clear the cache and stop serving data from it.
+         */
+        void disable();
+
+        bool isEnabled() const { return enabled; }
+
+        /**
+         * Find the cached data of the given key.
+         *
+         * @return Pointer to the cached data, valid until the cache is next
+         *         modified, or <code>nullptr</code> if the key is not cached.
+         */
+        const Data* find(const Key& key);
+
+        /**
+         * Current generation to be given to insert() for data read from the
+         * database after this call.
+         */
+        Generation getGeneration() const { return generation; }
+
+        /**
+         * Insert the given data to the cache, unless the cache is disabled or
+         * has been invalidated after the given generation was read.
+         */
+        void insert(const Key& key, const Data& data, Generation readGeneration);
+
+        void invalidate(const Keys& keys);
+
+        void clear();
+
+        std::size_t size() const { return entries.size(); }
+
+    private:
+        using Entry = std::pair<Key, Data>;
+        using Entries = std::list<Entry>;
+
+        const std::size_t maxSize;
+        bool enabled;
+        Generation generation;
+        Entries entries;
+        std::unordered_map<Key, Entries::iterator> index;
+    };
+}
+
+#endif
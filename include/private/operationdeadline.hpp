@@ -0,0 +1,141 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_OPERATIONDEADLINE_HPP_
+#define SHAREDDATALAYER_OPERATIONDEADLINE_HPP_
+
+#include <memory>
+#include <utility>
+#include "private/timer.hpp"
+
+namespace shareddatalayer
+{
+    class Engine;
+
+    /**
+     * Deadline for an asynchronous operation. Acknowledgement wrapped with
+     * wrap() is called only once: either when the operation completes before
+     * the deadline, or with the given timeout arguments when the deadline
+     * expires. In the latter case the late completion is discarded.
+     */
+    class OperationDeadline: public std::enable_shared_from_this<OperationDeadline>
+    {
+    public:
+        static std::shared_ptr<OperationDeadline> create(Engine& engine, const Timer::Duration& timeout);
+
+        ~OperationDeadline();
+
+        OperationDeadline(const OperationDeadline&) = delete;
+        OperationDeadline& operator = (const OperationDeadline&) = delete;
+
+        /**
+         * Mark the operation completed and disarm the deadline.
+         *
+         * @return <code>true</code>, if the operation was not completed before,
+         *         otherwise <code>false</code>.
+         */
+        bool complete();
+
+        bool isCompleted() const { return completed; }
+
+        /**
+         * Arm the deadline to call the given acknowledgement with the given
+         * timeout arguments and return a wrapper which calls the given
+         * acknowledgement only if the deadline has not expired.
+         */
+        template <typename Ack, typename... Args>
+        Ack wrap(const Ack& ack, const Args&... timeoutArgs)
+        {
+            const std::weak_ptr<OperationDeadline> weak(shared_from_this());
+            timer.arm(timeout, [weak, ack, timeoutArgs...] ()
+                               {
+                                   const auto deadline(weak.lock());
+                                   if (deadline && deadline->complete())
+                                       ack(timeoutArgs...);
+                               });
+            return CompletingFunction<Ack>(shared_from_this(), ack);
+        }
+
+        /**
+         * Return a wrapper which calls the given function only if the
+         * operation has not been completed. Used for intermediate callbacks of
+         * an operation which must not be called after the deadline.
+         */
+        template <typename Function>
+        Function guard(const Function& function)
+        {
+            return GuardedFunction<Function>(shared_from_this(), function);
+        }
+
+    private:
+        template <typename Function>
+        class CompletingFunction
+        {
+        public:
+            CompletingFunction(std::shared_ptr<OperationDeadline> deadline, const Function& function):
+                deadline(std::move(deadline)),
+                function(function)
+            {
+            }
+
+            template <typename... Args>
+            void operator () (Args&&... args) const
+            {
+                if (deadline->complete())
+                    function(std::forward<Args>(args)...);
+            }
+
+        private:
+            std::shared_ptr<OperationDeadline> deadline;
+            Function function;
+        };
+
+        template <typename Function>
+        class GuardedFunction
+        {
+        public:
+            GuardedFunction(std::shared_ptr<OperationDeadline> deadline, const Function& function):
+                deadline(std::move(deadline)),
+                function(function)
+            {
+            }
+
+            template <typename... Args>
+            void operator () (Args&&... args) const
+            {
+                if (!deadline->isCompleted())
+                    function(std::forward<Args>(args)...);
+            }
+
+        private:
+            std::shared_ptr<OperationDeadline> deadline;
+            Function function;
+        };
+
+        OperationDeadline(Engine& engine, const Timer::Duration& timeout);
+
+        Timer timer;
+        const Timer::Duration timeout;
+        bool completed;
+    };
+}
+
+#endif
@@ -0,0 +1,76 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_PROBES_HPP_
+#define SHAREDDATALAYER_PROBES_HPP_
+
+#include "config.h"
+
+/*
+ * Statically defined tracepoints (USDT) of the provider "shareddatalayer" for tracing
+ * SDL with bpftrace, perf or SystemTap without rebuilding it.
+ *
+ * Probes are compiled in only if SDL is configured with --enable-probes, otherwise
+ * SHAREDDATALAYER_PROBE generates no code and its arguments are not evaluated. A
+ * compiled-in probe is a nop instruction until a tracer attaches to it, but its
+ * arguments are evaluated, so they should be cheap. Arguments must be integers or
+ * pointers.
+ *
+ * Probes and their arguments:
+ *
+ * operation_start(request id, namespace, operation, bytes sent)
+ *     AsyncStorage operation is started. Operation is the name used in the statistics.
+ * operation_done(request id, error code value, bytes received)
+ *     Operation is completed, just before the client callback is called.
+ * command_dispatch(command handle, namespace, command, command length, number of arguments, bytes)
+ *     Redis command is dispatched to a connection. Command is not NUL terminated.
+ *     Namespace is empty for the commands of SDL itself.
+ * socket_write(file descriptor)
+ *     Output buffer of a connection is written to the socket.
+ * command_reply(command handle, error code value, reply type)
+ *     Reply of a command is received and parsed. Reply type is 0 if there is no reply.
+ *     Not fired for replies arriving after the command callbacks have been disabled.
+ * callback_start(command handle)
+ * callback_done(command handle)
+ *     Command callback, which calls the client callback, is called and returns.
+ *
+ * Request ids identify the operations of one AsyncStorage instance. Command handles
+ * identify the pending commands of one connection and they are reused after a reply.
+ * Commands of an operation are dispatched by the thread starting it before the start
+ * function returns, unless the operation waits for a connection. Thus a request id is
+ * mapped to a command handle by matching operation_start and the following
+ * command_dispatch of the same thread.
+ */
+#if HAVE_SDT_PROBES
+#include <sys/sdt.h>
+#define SHAREDDATALAYER_PROBE(name, ...) STAP_PROBEV(shareddatalayer, name, __VA_ARGS__)
+#else
+namespace shareddatalayer
+{
+    template <typename... Args>
+    inline void ignoreProbeArguments(const Args&...)
+    {
+    }
+}
+#define SHAREDDATALAYER_PROBE(name, ...) do { if (false) ::shareddatalayer::ignoreProbeArguments(__VA_ARGS__); } while (false)
+#endif
+
+#endif
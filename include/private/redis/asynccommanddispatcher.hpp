@@ -28,6 +28,7 @@
 #include <memory>
 #include <vector>
 #include "private/asyncconnection.hpp"
+#include "private/inlinefunction.hpp"
 #include "private/logger.hpp"
 
 namespace shareddatalayer
@@ -39,6 +40,7 @@ namespace shareddatalayer
         class Reply;
         struct Contents;
         struct DatabaseInfo;
+        class Script;
 
         class AsyncCommandDispatcher
         {
@@ -59,12 +61,31 @@ namespace shareddatalayer
 
             virtual void registerDisconnectCb(const DisconnectCb& disconnectCb) = 0;
 
-            using CommandCb = std::function<void(const std::error_code&, const Reply&)>;
+            using CommandCb = InlineFunction<void(const std::error_code&, const Reply&), 96>;
 
-            virtual void dispatchAsync(const CommandCb& commandCb,
+            virtual void dispatchAsync(CommandCb commandCb,
                                        const AsyncConnection::Namespace& ns,
                                        const Contents& contents) = 0;
 
+            /* Dispatches EVALSHA contents built with ContentsBuilder. If the script is not
+             * in the script cache of the database (NOSCRIPT), the command is dispatched
+             * again as EVAL with the source of the script, which also loads the script to
+             * the cache for the following EVALSHAs. If the dispatcher has been destroyed
+             * before the NOSCRIPT reply, the error is given to the callback as such.
+             */
+            void dispatchScriptAsync(CommandCb commandCb,
+                                     const AsyncConnection::Namespace& ns,
+                                     const Script& script,
+                                     const Contents& contents);
+
+            /* Commands dispatched between cork() and the matching uncork() are written
+             * to the connection together at uncork(), instead of with one write per
+             * command. Calls can be nested.
+             */
+            virtual void cork() = 0;
+
+            virtual void uncork() = 0;
+
             virtual void disableCommandCallbacks() = 0;
 
             static std::shared_ptr<AsyncCommandDispatcher> create(Engine& engine,
@@ -75,7 +96,13 @@ namespace shareddatalayer
                                                                   bool usedForSentinel);
 
         protected:
-            AsyncCommandDispatcher() = default;
+            AsyncCommandDispatcher();
+
+        private:
+            /* Script callbacks hold a weak reference to this, so that they do not
+             * redispatch on a dispatcher which has been destroyed.
+             */
+            std::shared_ptr<bool> alive;
         };
     }
 }
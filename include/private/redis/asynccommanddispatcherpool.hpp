@@ -0,0 +1,174 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_REDIS_ASYNCCOMMANDDISPATCHERPOOL_HPP_
+#define SHAREDDATALAYER_REDIS_ASYNCCOMMANDDISPATCHERPOOL_HPP_
+
+#define DB_CONNECTION_POOL_SIZE_ENV_VAR_NAME "DBAAS_CONNECTION_POOL_SIZE"
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <vector>
+#include "private/redis/asynccommanddispatcher.hpp"
+#include "private/redis/contents.hpp"
+
+namespace shareddatalayer
+{
+    class System;
+
+    namespace redis
+    {
+        /**
+         * Dispatches commands over several connections to the same database.
+         *
+         * A command is sent to the dispatcher with the fewest outstanding commands, unless
+         * some of its keys have outstanding commands. In that case it is sent to the same
+         * dispatcher as those, so that commands on the same key are handled in the order
+         * they were dispatched. A command whose keys have outstanding commands in several
+         * dispatchers is held back until it can be sent to a single one.
+         *
+         * Keys are tracked by hashing them to a fixed number of ordering slots, thus
+         * dispatching does not allocate per key. Keys sharing a slot are ordered as if
+         * they were the same key, which only makes the ordering stricter than needed.
+         *
+         * Connection state of the dispatchers is tracked once waitConnectedAsync() or
+         * registerDisconnectCb() has been called. Disconnected dispatchers fail commands
+         * at once, thus they are not selected for new commands unless all are disconnected.
+         */
+        class AsyncCommandDispatcherPool: public AsyncCommandDispatcher,
+                                          public std::enable_shared_from_this<AsyncCommandDispatcherPool>
+        {
+        public:
+            using Dispatchers = std::vector<std::shared_ptr<AsyncCommandDispatcher>>;
+
+            static const std::size_t MAX_SIZE;
+
+            AsyncCommandDispatcherPool(const AsyncCommandDispatcherPool&) = delete;
+
+            AsyncCommandDispatcherPool& operator = (const AsyncCommandDispatcherPool&) = delete;
+
+            explicit AsyncCommandDispatcherPool(const Dispatchers& dispatchers);
+
+            ~AsyncCommandDispatcherPool() override;
+
+            void waitConnectedAsync(const ConnectAck& connectAck) override;
+
+            void registerDisconnectCb(const DisconnectCb& disconnectCb) override;
+
+            void dispatchAsync(CommandCb commandCb,
+                               const AsyncConnection::Namespace& ns,
+                               const Contents& contents) override;
+
+            void cork() override;
+
+            void uncork() override;
+
+            void disableCommandCallbacks() override;
+
+            /**
+             * Number of connections to open to each database, read from the
+             * DBAAS_CONNECTION_POOL_SIZE environment variable. Defaults to 1.
+             */
+            static std::size_t getSize(System& system);
+
+        private:
+            using Slots = std::vector<std::size_t>;
+
+            struct SlotState
+            {
+                std::size_t dispatcher;
+                /* Number of sent commands with a key in the slot. */
+                std::size_t outstanding;
+                /* Number of deferred commands with a key in the slot. */
+                std::size_t deferred;
+            };
+
+            struct PendingCommand
+            {
+                CommandCb commandCb;
+                std::size_t dispatcher;
+                Slots slots;
+            };
+
+            struct DeferredCommand
+            {
+                CommandCb commandCb;
+                AsyncConnection::Namespace ns;
+                Contents contents;
+                Slots slots;
+            };
+
+            const Dispatchers dispatchers;
+            std::vector<std::size_t> outstanding;
+            std::size_t nextDispatcher;
+            std::vector<SlotState> slotStates;
+            /* Slots of the command being dispatched, reused to avoid allocating. */
+            Slots slotsOfCommand;
+            /* Entries are reused, so that their slot vectors keep their capacity. */
+            std::vector<PendingCommand> pendingCommands;
+            std::vector<std::size_t> freePendingCommands;
+            std::deque<DeferredCommand> deferredCommands;
+            std::vector<bool> slotsOfEarlierDeferred;
+            bool dispatchingDeferred;
+            bool redispatchDeferred;
+            bool callbacksEnabled;
+            bool trackingConnections;
+            std::vector<bool> connected;
+            std::size_t connectedCount;
+            std::vector<ConnectAck> connectAcks;
+            DisconnectCb disconnectCb;
+
+            static void getSlots(const Contents& contents, Slots& slots);
+
+            bool isDeferred(const Slots& slots) const;
+
+            bool selectDispatcher(const Slots& slots, std::size_t& dispatcher);
+
+            void send(std::size_t dispatcher,
+                      CommandCb commandCb,
+                      const AsyncConnection::Namespace& ns,
+                      const Contents& contents,
+                      const Slots& slots);
+
+            void defer(CommandCb commandCb,
+                       const AsyncConnection::Namespace& ns,
+                       const Contents& contents,
+                       const Slots& slots);
+
+            void commandCompleted(std::size_t index,
+                                  const std::error_code& error,
+                                  const Reply& reply);
+
+            void dispatchDeferred();
+
+            void trackConnections();
+
+            void waitDispatcherConnected(std::size_t dispatcher);
+
+            void dispatcherConnected(std::size_t dispatcher);
+
+            void dispatcherDisconnected(std::size_t dispatcher);
+        };
+    }
+}
+
+#endif
@@ -26,9 +26,9 @@
 #include "private/databaseconfiguration.hpp"
 #include "private/logger.hpp"
 #include "private/timer.hpp"
+#include "private/redis/commandcbslab.hpp"
 #include <string>
 #include <set>
-#include <list>
 #include <vector>
 #include <map>
 #include <memory>
@@ -81,11 +81,15 @@ namespace shareddatalayer
 
             void registerDisconnectCb(const DisconnectCb& disconnectCb) override;
 
-            void dispatchAsync(const CommandCb& commandCb, const AsyncConnection::Namespace& ns, const Contents& contents) override;
+            void dispatchAsync(CommandCb commandCb, const AsyncConnection::Namespace& ns, const Contents& contents) override;
+
+            void cork() override;
+
+            void uncork() override;
 
             void disableCommandCallbacks() override;
 
-            void handleReply(const CommandCb& commandCb, const std::error_code& error, const redisReply* rr);
+            void handleReply(CommandCbSlab::Handle handle, const std::error_code& error, const redisReply* rr);
 
             bool isClientCallbacksEnabled() const;
 
@@ -111,7 +115,7 @@ namespace shareddatalayer
             ConnectAck connectAck;
             DisconnectCb disconnectCallback;
             ServiceState serviceState;
-            std::list<CommandCb> cbs;
+            CommandCbSlab cbs;
             bool clientCallbacksEnabled;
             Timer connectionRetryTimer;
             Timer::Duration connectionRetryTimerDuration;
@@ -119,13 +123,9 @@ namespace shareddatalayer
 
             void connect();
 
-            bool isValidCb(const CommandCb& commandCb);
-
-            void removeCb(const CommandCb& commandCb);
-
             void callCommandCbWithError(const CommandCb& commandCb, const std::error_code& error);
 
-            void dispatchAsync(const CommandCb& commandCb, const AsyncConnection::Namespace& ns, const Contents& contents, bool checkConnectionState);
+            void dispatchAsync(CommandCb commandCb, const AsyncConnection::Namespace& ns, const Contents& contents, bool checkConnectionState);
 
             void verifyConnection();
 
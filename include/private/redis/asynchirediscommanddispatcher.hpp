@@ -24,13 +24,13 @@
 
 #include "private/redis/asynccommanddispatcher.hpp"
 #include <string>
-#include <list>
 #include <vector>
 #include <map>
 #include <memory>
 #include <queue>
 #include "private/logger.hpp"
 #include "private/timer.hpp"
+#include "private/redis/commandcbslab.hpp"
 
 extern "C"
 {
@@ -79,16 +79,20 @@ namespace shareddatalayer
 
             void registerDisconnectCb(const DisconnectCb& disconnectCb) override;
 
-            void dispatchAsync(const CommandCb& commandCb, const AsyncConnection::Namespace& ns,
+            void dispatchAsync(CommandCb commandCb, const AsyncConnection::Namespace& ns,
                                const Contents& contents) override;
 
+            void cork() override;
+
+            void uncork() override;
+
             void disableCommandCallbacks() override;
 
             void setConnected();
 
             void setDisconnected();
 
-            void handleReply(const CommandCb& commandCb,
+            void handleReply(CommandCbSlab::Handle handle,
                              const std::error_code& error,
                              const redisReply* rr);
 
@@ -121,7 +125,7 @@ namespace shareddatalayer
             ConnectAck connectAck;
             DisconnectCb disconnectCallback;
             ServiceState serviceState;
-            std::list<CommandCb> cbs;
+            CommandCbSlab cbs;
             bool clientCallbacksEnabled;
             Timer connectionRetryTimer;
             Timer::Duration connectionRetryTimerDuration;
@@ -131,13 +135,9 @@ namespace shareddatalayer
 
             void connect();
 
-            bool isValidCb(const CommandCb& commandCb);
-
-            void removeCb(const CommandCb& commandCb);
-
             void callCommandCbWithError(const CommandCb& commandCb, const std::error_code& error);
 
-            void dispatchAsync(const CommandCb& commandCb, const Contents& contents, bool checkConnectionState);
+            void dispatchAsync(CommandCb commandCb, const AsyncConnection::Namespace& ns, const Contents& contents, bool checkConnectionState);
 
             void verifyConnectionReply(const std::error_code& error, const redis::Reply& reply);
         };
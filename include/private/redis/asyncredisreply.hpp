@@ -23,7 +23,7 @@
 #define SHAREDDATALAYER_REDIS_ASYNCREDISREPLY_HPP_
 
 #include "private/redis/reply.hpp"
-#include <map>
+#include <memory>
 
 extern "C"
 {
@@ -34,6 +34,10 @@ namespace shareddatalayer
 {
     namespace redis
     {
+        /*
+         * AsyncRedisReply wraps the hiredis reply tree without copying it. Array
+         * elements are created when the array is accessed for the first time.
+         */
         class AsyncRedisReply: public Reply
         {
         public:
@@ -50,15 +54,15 @@ namespace shareddatalayer
             const ReplyVector* getArray() const override;
 
         private:
+            const redisReply* rr;
             Type type;
-            long long integer;
             DataItem dataItem;
-            ReplyVector replyVector;
-            std::map<int, Type> typeMap;
+            mutable std::unique_ptr<AsyncRedisReply[]> elements;
+            mutable ReplyVector replyVector;
 
-            void parseReply(const redisReply& rr);
+            void setReply(const redisReply& rr);
 
-            void parseArray(const redisReply& rr);
+            void parseArray() const;
         };
     }
 }
@@ -22,9 +22,12 @@
 #ifndef SHAREDDATALAYER_REDIS_ASYNCREDISSTORAGE_HPP_
 #define SHAREDDATALAYER_REDIS_ASYNCREDISSTORAGE_HPP_
 
+#include <chrono>
 #include <functional>
+#include <map>
 #include <memory>
 #include <queue>
+#include <vector>
 #include <boost/optional.hpp>
 #include <sdl/asyncstorage.hpp>
 #include "private/logger.hpp"
@@ -33,6 +36,8 @@
 #include "private/redis/databaseinfo.hpp"
 #include "private/redis/reply.hpp"
 
+#define DB_REMOVE_BATCH_SIZE_ENV_VAR_NAME "DBAAS_REMOVE_BATCH_SIZE"
+
 namespace shareddatalayer
 {
     namespace redis
@@ -42,9 +47,12 @@ namespace shareddatalayer
         class Reply;
         struct Contents;
         class ContentsBuilder;
+        class Script;
     }
 
     class Engine;
+    class NearCache;
+    class System;
 
     class AsyncRedisStorage: public AsyncStorage
     {
@@ -54,6 +62,7 @@ namespace shareddatalayer
             SUCCESS = 0,
             REDIS_NOT_YET_DISCOVERED,
             INVALID_NAMESPACE,
+            OPERATION_TIMEOUT,
             //Keep this always as last item. Used in unit tests to loop all enum values.
             END_MARKER
         };
@@ -61,7 +70,16 @@ namespace shareddatalayer
         using AsyncCommandDispatcherCreator = std::function<std::shared_ptr<redis::AsyncCommandDispatcher>(Engine& engine,
                                                                                                            const redis::DatabaseInfo& databaseInfo,
                                                                                                            std::shared_ptr<redis::ContentsBuilder> contentsBuilder,
-                                                                                                           std::shared_ptr<Logger> logger)>;
+                                                                                                           std::shared_ptr<Logger> logger,
+                                                                                                           bool usePermanentCommandCallbacks)>;
+
+        /* Default number of keys the database examines per SCAN page. */
+        static constexpr std::size_t DEFAULT_SCAN_COUNT = 1000;
+
+        /* Default maximum number of keys removed with one UNLINK by removeAllAsync() and
+         * removeByPrefixAsync().
+         */
+        static constexpr std::size_t DEFAULT_REMOVE_BATCH_SIZE = 1000;
 
         static const std::error_category& errorCategory() noexcept;
 
@@ -81,10 +99,17 @@ namespace shareddatalayer
                           std::shared_ptr<NamespaceConfigurations> namespaceConfigurations,
                           const AsyncCommandDispatcherCreator& asyncCommandDispatcherCreator,
                           std::shared_ptr<redis::ContentsBuilder> contentsBuilder,
-                          std::shared_ptr<Logger> logger);
+                          std::shared_ptr<Logger> logger,
+                          std::size_t removeBatchSize = DEFAULT_REMOVE_BATCH_SIZE);
 
         ~AsyncRedisStorage() override;
 
+        /**
+         * Get the remove batch size from DBAAS_REMOVE_BATCH_SIZE environment variable.
+         * Defaults to DEFAULT_REMOVE_BATCH_SIZE.
+         */
+        static std::size_t getRemoveBatchSize(System& system);
+
         int fd() const override;
 
         void handleEvents() override;
@@ -99,6 +124,10 @@ namespace shareddatalayer
 
         void getAsync(const Namespace& ns, const Keys& keys, const GetAck& getAck) override;
 
+        void getViewsAsync(const Namespace& ns, const Keys& keys, const GetViewsAck& getViewsAck) override;
+
+        void getViewsAsync(const Namespace& ns, const Keys& keys, const DataVisitor& dataVisitor, const GetVisitAck& getVisitAck) override;
+
         void removeAsync(const Namespace& ns, const Keys& keys, const ModifyAck& modifyAck) override;
 
         void removeIfAsync(const Namespace& ns, const Key& key, const Data& data, const ModifyIfAck& modifyIfAck) override;
@@ -107,8 +136,28 @@ namespace shareddatalayer
 
         void listKeys(const Namespace& ns, const std::string& pattern, const FindKeysAck& findKeysAck) override;
 
+        void scanKeysAsync(const Namespace& ns, const std::string& pattern, std::size_t countHint, const ScanKeysAck& scanKeysAck) override;
+
         void removeAllAsync(const Namespace& ns, const ModifyAck& modifyAck) override;
 
+        void removeByPrefixAsync(const Namespace& ns, const std::string& keyPrefix, const ModifyAck& modifyAck) override;
+
+        void subscribeChannelAsync(const Namespace& ns, const Channels& channels, const NotificationCb& notificationCb, const ModifyAck& subscribeAck) override;
+
+        void unsubscribeChannelAsync(const Namespace& ns, const Channels& channels, const ModifyAck& unsubscribeAck) override;
+
+        void publishAsync(const Namespace& ns, const Channel& channel, const std::string& message, const ModifyAck& modifyAck) override;
+
+        void getBatchAsync(const NamespaceKeys& namespaceKeys, const GetBatchAck& getBatchAck) override;
+
+        void setBatchAsync(const NamespaceDataMaps& namespaceDataMaps, const ModifyAck& modifyAck) override;
+
+        void writeBatchAsync(const Namespace& ns, const WriteBatch& writeBatch, const WriteBatchAck& writeBatchAck) override;
+
+        void getStatisticsAsync(const GetStatisticsAck& getStatisticsAck) override;
+
+        void setOperationTimeout(const std::chrono::steady_clock::duration& timeout) override;
+
         redis::DatabaseInfo& getDatabaseInfo();
 
         std::string buildKeyPrefixSearchPattern(const Namespace& ns, const std::string& keyPrefix) const;
@@ -126,6 +175,55 @@ namespace shareddatalayer
         redis::DatabaseInfo dbInfo;
         std::shared_ptr<NamespaceConfigurations> namespaceConfigurations;
         std::shared_ptr<Logger> logger;
+        std::chrono::steady_clock::duration operationTimeout;
+        const std::size_t removeBatchSize;
+        std::shared_ptr<redis::AsyncCommandDispatcher> subscriber;
+        bool subscriberConnected;
+
+        struct ScanKeys;
+
+        struct NearCacheRead;
+
+        struct Removal;
+
+        struct Subscription
+        {
+            Channel channel;
+            NotificationCb notificationCb;
+        };
+
+        /* Subscriptions and not yet delivered messages, by channel name in the database. */
+        struct Notifications
+        {
+            std::map<std::string, Subscription> subscriptions;
+            std::map<std::string, Messages> pending;
+        };
+
+        struct SubscribeRequest
+        {
+            std::vector<std::string> channelNames;
+            std::size_t unconfirmed;
+            ModifyAck subscribeAck;
+        };
+
+        std::shared_ptr<Notifications> notifications;
+        /* Scan continuations hold a weak reference to this, as they may be called
+         * after the storage has been destroyed.
+         */
+        std::shared_ptr<bool> alive;
+        std::vector<std::shared_ptr<SubscribeRequest>> subscribeRequestsWaitingConnection;
+        /* Read once, so that storages without near caches skip the lookups. */
+        const bool nearCacheUsed;
+        std::map<std::string, std::shared_ptr<NearCache>> nearCaches;
+
+        template <typename Ack, typename... Args>
+        Ack withDeadline(const Ack& ack, const Args&... timeoutArgs);
+
+        template <typename CommandCb>
+        void dispatchCommand(CommandCb&& commandCb, const Namespace& ns, const redis::Contents& contents);
+
+        template <typename CommandCb>
+        void dispatchScript(CommandCb&& commandCb, const Namespace& ns, const redis::Script& script, const redis::Contents& contents);
 
         bool canOperationBePerformed(const Namespace& ns, boost::optional<bool> inputDataIsEmpty, std::error_code& ecToReturn);
 
@@ -138,6 +236,48 @@ namespace shareddatalayer
         void conditionalCommandCallback(const std::error_code& error, const redis::Reply&, const ModifyIfAck&);
 
         void findKeys(const std::string& ns, const std::string& keyPattern, const FindKeysAck& findKeysAck);
+
+        void scanKeys(const Namespace& ns, const std::string& keyPattern, const std::string& count, const ScanKeysAck& scanKeysAck);
+
+        void scanKeysPage(const std::shared_ptr<const ScanKeys>& scan, const std::string& cursor);
+
+        void removeKeys(const Namespace& ns, const std::string& keyPattern, const ModifyAck& modifyAck);
+
+        void unlinkKeys(const std::shared_ptr<Removal>& removal, const Keys& keys);
+
+        void removalStepDone(const std::shared_ptr<Removal>& removal);
+
+        std::string buildChannelName(const Namespace& ns, const Channel& channel) const;
+
+        void createSubscriber();
+
+        void subscriberConnectionEstablished();
+
+        void requestSubscription(const std::shared_ptr<SubscribeRequest>& request);
+
+        bool isSubscriptionNeeded(const std::string& channelName) const;
+
+        void subscribe(const std::shared_ptr<SubscribeRequest>& request);
+
+        void subscriberCallback(const std::error_code& error, const redis::Reply& reply, const std::shared_ptr<SubscribeRequest>& request);
+
+        void queueNotification(const std::string& channelName, const std::string& message);
+
+        static void deliverNotifications(const std::weak_ptr<Notifications>& notifications);
+
+        std::shared_ptr<NearCache> getNearCache(const Namespace& ns);
+
+        void invalidateNearCache(const Namespace& ns, const Keys& keys);
+
+        void invalidateNearCache(const Namespace& ns, const DataMap& dataMap);
+
+        void enableNearCache(const std::string& channelName);
+
+        void clearNearCache(const std::string& channelName);
+
+        void disableNearCaches();
+
+        void getFromNearCacheAsync(const Namespace& ns, const Keys& keys, const GetAck& getAck, const std::shared_ptr<NearCache>& nearCache);
     };
 
     AsyncRedisStorage::ErrorCode& operator++ (AsyncRedisStorage::ErrorCode& ecEnum);
@@ -0,0 +1,87 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_REDIS_COMMANDCBSLAB_HPP_
+#define SHAREDDATALAYER_REDIS_COMMANDCBSLAB_HPP_
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include "private/redis/asynccommanddispatcher.hpp"
+
+namespace shareddatalayer
+{
+    namespace redis
+    {
+        /*
+         * Storage for the callbacks of the commands waiting for a reply.
+         *
+         * Each callback is stored in a slot and identified by a handle which
+         * combines the slot index and the generation of the slot. The handle is
+         * given to hiredis as the command private data. Finding, validating and
+         * removing a callback are constant time operations and freed slots are
+         * reused, so no memory is allocated once the slab has grown to the number
+         * of concurrently pending commands. Reusing a slot increments its
+         * generation, which makes the handles to removed callbacks invalid.
+         *
+         * References to stored callbacks remain valid until the callback is
+         * removed, also when new callbacks are added.
+         */
+        class CommandCbSlab
+        {
+        public:
+            using CommandCb = AsyncCommandDispatcher::CommandCb;
+
+            using Handle = void*;
+
+            CommandCbSlab();
+
+            CommandCbSlab(const CommandCbSlab&) = delete;
+
+            CommandCbSlab& operator = (const CommandCbSlab&) = delete;
+
+            Handle add(CommandCb commandCb);
+
+            /* Returns nullptr if the handle does not refer to a stored callback. */
+            CommandCb* find(Handle handle);
+
+            void remove(Handle handle);
+
+            size_t size() const;
+
+        private:
+            struct Slot
+            {
+                CommandCb commandCb;
+                uint32_t generation;
+                bool used;
+            };
+
+            std::deque<Slot> slots;
+            std::vector<size_t> freeSlots;
+            size_t count;
+
+            bool findIndex(Handle handle, size_t& index) const;
+        };
+    }
+}
+
+#endif
@@ -22,21 +22,68 @@
 #ifndef SHAREDDATALAYER_REDIS_CONTENTS_HPP_
 #define SHAREDDATALAYER_REDIS_CONTENTS_HPP_
 
-#include <vector>
+#include <cstring>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace shareddatalayer
 {
     namespace redis
     {
+        /*
+         * Command arguments given to hiredis as (pointer, length) pairs.
+         *
+         * Arguments are either views to buffers owned by the caller (for
+         * example the data of a DataMap given to setAsync) or point to the
+         * storage owned by the contents (command names, namespaced keys).
+         * Data views are valid only as long as the caller's buffers, thus
+         * contents must be dispatched before those buffers are released.
+         *
+         * Copies of contents share the storage, and the arguments in it are
+         * valid as long as any of the copies exists. Shared storage is never
+         * modified, ContentsBuilder copies it before adding arguments to it.
+         *
+         * ContentsBuilder records which arguments are namespaced keys, so that
+         * the keys can be told apart from data and patterns which look alike.
+         */
         struct Contents
         {
-            std::vector<std::string> stack;
+            /* count key arguments starting from argument first, every step:th argument */
+            struct KeyArguments
+            {
+                KeyArguments():
+                    first(0),
+                    count(0),
+                    step(1)
+                {
+                }
+
+                KeyArguments(size_t first, size_t count, size_t step):
+                    first(first),
+                    count(count),
+                    step(step)
+                {
+                }
+
+                size_t first;
+                size_t count;
+                size_t step;
+            };
+
+            std::vector<const char*> stack;
             std::vector<size_t> sizes;
+            std::shared_ptr<std::string> storage;
+            KeyArguments keyArguments;
 
             bool operator == (const Contents& contents) const
             {
-                return (stack == contents.stack) && (sizes == contents.sizes);
+                if ((stack.size() != contents.stack.size()) || (sizes != contents.sizes))
+                    return false;
+                for (size_t i(0); i < stack.size(); ++i)
+                    if (std::memcmp(stack[i], contents.stack[i], sizes[i]) != 0)
+                        return false;
+                return true;
             }
 
             bool operator != (const Contents& contents) const
@@ -29,6 +29,7 @@ namespace shareddatalayer
     namespace redis
     {
         struct Contents;
+        class Script;
 
         class ContentsBuilder
         {
@@ -50,6 +51,16 @@ namespace shareddatalayer
                                    const std::string& string2,
                                    const std::string& string3) const;
 
+            virtual Contents build(const std::string& string,
+                                   const std::string& string2,
+                                   const std::string& string3,
+                                   const std::string& string4,
+                                   const std::string& string5,
+                                   const std::string& string6) const;
+
+            virtual Contents build(const std::string& string,
+                                   const std::vector<std::string>& strings) const;
+
             virtual Contents build(const std::string& string,
                                    const AsyncConnection::Namespace& ns,
                                    const AsyncConnection::DataMap& dataMap) const;
@@ -96,6 +107,15 @@ namespace shareddatalayer
                                    const std::string& string2,
                                    const std::string& string3) const;
 
+            /* EVALSHA of the script with the given keys of the namespace and arguments.
+             * All arguments are copied, thus the contents can be redispatched with
+             * AsyncCommandDispatcher::dispatchScriptAsync() after the call returns.
+             */
+            virtual Contents build(const Script& script,
+                                   const AsyncConnection::Namespace& ns,
+                                   const std::vector<AsyncConnection::Key>& keys,
+                                   const std::vector<std::string>& args) const;
+
         private:
             const char nsKeySeparator;
 
@@ -116,6 +136,15 @@ namespace shareddatalayer
             void addKeys(Contents& contents,
                          const AsyncConnection::Namespace& ns,
                          const AsyncConnection::Keys& keys) const;
+
+            std::string buildKeyPrefix(const AsyncConnection::Namespace& ns) const;
+
+            void reserveStorage(Contents& contents,
+                                size_t size) const;
+
+            void addToStorage(Contents& contents,
+                              const std::string& prefix,
+                              const std::string& string) const;
         };
     }
 }
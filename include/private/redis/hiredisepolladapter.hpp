@@ -60,16 +60,31 @@ namespace shareddatalayer
 
             virtual void cleanUp();
 
+            /* Until the matching uncork(), commands are only added to the output buffer
+             * of hiredis, and the whole buffer is written at uncork().
+             */
+            virtual void cork();
+
+            virtual void uncork();
+
         private:
             HiredisSystem& hiredisSystem;
             Engine& engine;
             redisAsyncContext* ac;
             unsigned int eventState;
+            /* Event mask last given to the engine, used to skip redundant epoll_ctl calls */
+            unsigned int monitoredEventState;
             bool reading;
             bool writing;
             bool isMonitoring;
+            unsigned int corked;
+            bool writeDeferred;
 
             void eventHandler(unsigned int events);
+
+            bool flushOutputBuffer();
+
+            void updateMonitoredEvents();
         };
     }
 }
@@ -65,6 +65,8 @@ namespace shareddatalayer
 
             virtual void redisAsyncHandleWrite(redisAsyncContext* ac);
 
+            virtual int redisBufferWrite(redisContext* context, int* done);
+
             virtual void redisAsyncDisconnect(redisAsyncContext* ac);
 
             virtual void redisAsyncFree(redisAsyncContext* ac);
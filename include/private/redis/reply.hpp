@@ -33,6 +33,11 @@ namespace shareddatalayer
     {
         using ReplyStringLength = decltype(::redisReply::len);
 
+        /*
+         * Reply is a view to the reply received from the database. It is valid only
+         * during the callback where it is given, the data needed after that has to
+         * be copied.
+         */
         class Reply
         {
         public:
@@ -53,8 +58,13 @@ namespace shareddatalayer
 
             struct DataItem
             {
-                std::string str;
+                const char* str;
                 ReplyStringLength len;
+
+                std::string toString() const
+                {
+                    return std::string(str, static_cast<size_t>(len));
+                }
             };
 
             virtual Type getType() const = 0;
@@ -63,7 +73,7 @@ namespace shareddatalayer
 
             virtual const DataItem* getString() const = 0;
 
-            using ReplyVector = std::vector<std::shared_ptr<Reply>>;
+            using ReplyVector = std::vector<const Reply*>;
 
             virtual const ReplyVector* getArray() const = 0;
 
@@ -0,0 +1,59 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_REDIS_SCRIPT_HPP_
+#define SHAREDDATALAYER_REDIS_SCRIPT_HPP_
+
+#include <memory>
+#include <string>
+
+namespace shareddatalayer
+{
+    namespace redis
+    {
+        /*
+         * Lua script executed in the database with EVALSHA. The SHA1 digest of the
+         * source identifies the script in the script cache of the database, thus the
+         * script needs to be sent as such only to the connections (or cluster nodes)
+         * which do not yet have it in their cache, see
+         * AsyncCommandDispatcher::dispatchScriptAsync().
+         *
+         * Copies of a script share the source.
+         */
+        class Script
+        {
+        public:
+            explicit Script(const std::string& source);
+
+            const std::string& getSource() const { return *source; }
+
+            const std::string& getSha1() const { return sha1; }
+
+            static std::string calculateSha1(const std::string& string);
+
+        private:
+            std::shared_ptr<const std::string> source;
+            std::string sha1;
+        };
+    }
+}
+
+#endif
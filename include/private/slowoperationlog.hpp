@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_SLOWOPERATIONLOG_HPP_
+#define SHAREDDATALAYER_SLOWOPERATIONLOG_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <sdl/statistics.hpp>
+#include "private/logger.hpp"
+
+namespace shareddatalayer
+{
+    struct SlowOperationLogConfiguration
+    {
+        /** Operations taking at least this long are recorded. Zero disables the log. */
+        std::chrono::milliseconds threshold = std::chrono::milliseconds::zero();
+
+        /** Number of the latest slow operations kept in memory. */
+        std::size_t size = 128;
+    };
+
+    /**
+     * Client side counterpart of Redis SLOWLOG. Keeps the latest operations of one
+     * AsyncStorage instance whose latency, from starting the operation to calling its
+     * acknowledgement, is at least the configured threshold. Thus the log catches also the
+     * delays of the network and the event loop, which Redis does not see.
+     *
+     * Slow operations are kept in a bounded ring and logged as warnings. At most one warning
+     * is logged per LOG_INTERVAL, the next warning tells how many slow operations were not
+     * logged. Like StatisticsCollector, the log is used only by the thread handling the
+     * events of the instance.
+     */
+    class SlowOperationLog
+    {
+    public:
+        using GetConnection = std::function<std::string(const std::string& ns)>;
+
+        static const std::chrono::steady_clock::duration LOG_INTERVAL;
+
+        SlowOperationLog(const SlowOperationLogConfiguration& configuration,
+                         const GetConnection& getConnection,
+                         std::shared_ptr<Logger> logger);
+
+        SlowOperationLog(const SlowOperationLog&) = delete;
+
+        SlowOperationLog& operator = (const SlowOperationLog&) = delete;
+
+        bool isSlow(const std::chrono::steady_clock::duration& latency) const { return latency >= threshold; }
+
+        void add(const std::string& ns,
+                 Statistics::OperationType type,
+                 std::size_t keyCount,
+                 std::uint64_t bytes,
+                 const std::chrono::steady_clock::duration& latency,
+                 const std::chrono::steady_clock::time_point& now);
+
+        /** Slow operations in the ring, the oldest first. */
+        Statistics::SlowOperations getSlowOperations() const;
+
+    private:
+        const std::chrono::steady_clock::duration threshold;
+        const std::size_t size;
+        GetConnection getConnection;
+        std::shared_ptr<Logger> logger;
+        Statistics::SlowOperations ring;
+        std::size_t next;
+        std::chrono::steady_clock::time_point nextLogTime;
+        std::uint64_t notLogged;
+
+        void log(const Statistics::SlowOperation& slowOperation);
+    };
+}
+
+#endif
@@ -0,0 +1,136 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_STATISTICSCOLLECTOR_HPP_
+#define SHAREDDATALAYER_STATISTICSCOLLECTOR_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <sdl/statistics.hpp>
+#include "private/slowoperationlog.hpp"
+
+namespace shareddatalayer
+{
+    struct StatisticsConfiguration
+    {
+        /** Operations are counted only if enabled. */
+        bool enabled = false;
+
+        /** Namespaces counted separately, the rest are counted as OTHER_NAMESPACE. */
+        std::size_t maxNamespaces = 64;
+    };
+
+    /**
+     * Collects the operation statistics of one AsyncStorage instance. The collector is a
+     * shard of its own for the instance and it is used only by the thread handling the
+     * events of the instance, thus recording an operation needs neither locks nor atomics.
+     *
+     * Operations are measured if counting is enabled, a slow operation log is set or the
+     * operation probes are compiled in. The caller checks it before starting a measurement.
+     */
+    class StatisticsCollector
+    {
+    public:
+        using OperationType = Statistics::OperationType;
+
+        /**
+         * Started operation. Record of the operation type of the namespace is looked up when
+         * the operation is started, completion only updates it. There is no record if
+         * counting is disabled. Request id identifies the operation in the operation_start
+         * and operation_done probes.
+         */
+        class Measurement
+        {
+        public:
+            struct Record
+            {
+                const std::string ns;
+                const OperationType type;
+                Statistics::OperationStatistics statistics;
+            };
+
+            Measurement(std::shared_ptr<Record> record,
+                        std::shared_ptr<SlowOperationLog> slowOperationLog,
+                        const std::string& ns,
+                        OperationType type,
+                        std::uint64_t requestId,
+                        std::size_t keyCount,
+                        std::uint64_t bytesSent);
+
+            void done(const std::error_code& error, std::uint64_t bytesReceived = 0) const;
+
+        private:
+            std::shared_ptr<Record> record;
+            std::shared_ptr<SlowOperationLog> slowOperationLog;
+            /* Namespace is copied only for the slow operation log. */
+            std::string ns;
+            OperationType type;
+            std::chrono::steady_clock::time_point startTime;
+            std::uint64_t requestId;
+            std::size_t keyCount;
+            std::uint64_t bytesSent;
+        };
+
+        static const std::string OTHER_NAMESPACE;
+
+        StatisticsCollector();
+
+        StatisticsCollector(const StatisticsCollector&) = delete;
+
+        StatisticsCollector& operator = (const StatisticsCollector&) = delete;
+
+        /**
+         * Record the operations exceeding the threshold of the given log also as slow
+         * operations. Affects the operations started after the call.
+         */
+        void setSlowOperationLog(std::shared_ptr<SlowOperationLog> slowOperationLog);
+
+        void setConfiguration(const StatisticsConfiguration& configuration);
+
+        bool isEnabled() const { return enabled || slowOperationLog; }
+
+        Measurement start(const std::string& ns, OperationType type, std::size_t keyCount, std::uint64_t bytesSent);
+
+        Statistics getStatistics() const;
+
+        static std::size_t getLatencyBucket(const std::chrono::steady_clock::duration& latency);
+
+    private:
+        using Records = std::array<std::shared_ptr<Measurement::Record>,
+                                   static_cast<std::size_t>(OperationType::END_MARKER)>;
+
+        bool enabled;
+        std::size_t maxNamespaces;
+        std::unordered_map<std::string, Records> namespaces;
+        Records otherNamespaces;
+        std::shared_ptr<SlowOperationLog> slowOperationLog;
+        std::uint64_t nextRequestId;
+
+        std::shared_ptr<Measurement::Record>& getRecord(const std::string& ns, OperationType type);
+    };
+}
+
+#endif
@@ -59,6 +59,10 @@ namespace shareddatalayer
 
         virtual void removeAll(const Namespace& ns) override;
 
+        virtual void removeByPrefix(const Namespace& ns, const std::string& keyPrefix) override;
+
+        virtual std::vector<bool> writeBatch(const Namespace& ns, const WriteBatch& writeBatch) override;
+
         virtual void setOperationTimeout(const std::chrono::steady_clock::duration& timeout) override;
 
         static constexpr int NO_TIMEOUT = -1;
@@ -69,6 +73,7 @@ namespace shareddatalayer
         DataMap localMap;
         Keys localKeys;
         bool localStatus;
+        std::vector<bool> localStatuses;
         std::error_code localError;
         bool synced;
         bool isReady;
@@ -97,6 +102,8 @@ namespace shareddatalayer
 
         void findKeysAck(const std::error_code& error, const Keys& keys);
 
+        void writeBatchAck(const std::error_code& error, const std::vector<bool>& statuses);
+
         void handlePendingEvents();
     };
 }
@@ -35,6 +35,12 @@ namespace shareddatalayer
 
         ~SystemLogger();
 
+        /**
+         * Waits, at most one second, until the messages logged so far by the loggers of the
+         * process have been written.
+         */
+        static void waitFlushed();
+
         std::ostream& emerg() override;
 
         std::ostream& alert() override;
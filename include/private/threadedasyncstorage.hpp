@@ -0,0 +1,112 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_THREADEDASYNCSTORAGE_HPP_
+#define SHAREDDATALAYER_THREADEDASYNCSTORAGE_HPP_
+
+#include <functional>
+#include <memory>
+#include <thread>
+#include <sdl/asyncstorage.hpp>
+
+namespace shareddatalayer
+{
+    class Engine;
+
+    /**
+     * AsyncStorage which runs the engine of the wrapped AsyncStorage in an internal thread.
+     *
+     * Operations are posted to the engine's lock-free callback queue, thus they are carried
+     * out in the I/O thread, and the wrapped AsyncStorage is used only by that thread.
+     */
+    class ThreadedAsyncStorage: public AsyncStorage
+    {
+    public:
+        ThreadedAsyncStorage(std::shared_ptr<Engine> engine,
+                             std::unique_ptr<AsyncStorage> asyncStorage,
+                             const Executor& executor);
+
+        ~ThreadedAsyncStorage() override;
+
+        int fd() const override;
+
+        void handleEvents() override;
+
+        void waitReadyAsync(const Namespace& ns, const ReadyAck& readyAck) override;
+
+        void setAsync(const Namespace& ns, const DataMap& dataMap, const ModifyAck& modifyAck) override;
+
+        void setIfAsync(const Namespace& ns, const Key& key, const Data& oldData, const Data& newData, const ModifyIfAck& modifyIfAck) override;
+
+        void setIfNotExistsAsync(const Namespace& ns, const Key& key, const Data& data, const ModifyIfAck& modifyIfAck) override;
+
+        void getAsync(const Namespace& ns, const Keys& keys, const GetAck& getAck) override;
+
+        void getViewsAsync(const Namespace& ns, const Keys& keys, const GetViewsAck& getViewsAck) override;
+
+        void getViewsAsync(const Namespace& ns, const Keys& keys, const DataVisitor& dataVisitor, const GetVisitAck& getVisitAck) override;
+
+        void removeAsync(const Namespace& ns, const Keys& keys, const ModifyAck& modifyAck) override;
+
+        void removeIfAsync(const Namespace& ns, const Key& key, const Data& data, const ModifyIfAck& modifyIfAck) override;
+
+        void findKeysAsync(const Namespace& ns, const std::string& keyPrefix, const FindKeysAck& findKeysAck) override;
+
+        void listKeys(const Namespace& ns, const std::string& pattern, const FindKeysAck& findKeysAck) override;
+
+        void scanKeysAsync(const Namespace& ns, const std::string& pattern, std::size_t countHint, const ScanKeysAck& scanKeysAck) override;
+
+        void removeAllAsync(const Namespace& ns, const ModifyAck& modifyAck) override;
+
+        void removeByPrefixAsync(const Namespace& ns, const std::string& keyPrefix, const ModifyAck& modifyAck) override;
+
+        void subscribeChannelAsync(const Namespace& ns, const Channels& channels, const NotificationCb& notificationCb, const ModifyAck& subscribeAck) override;
+
+        void unsubscribeChannelAsync(const Namespace& ns, const Channels& channels, const ModifyAck& unsubscribeAck) override;
+
+        void publishAsync(const Namespace& ns, const Channel& channel, const std::string& message, const ModifyAck& modifyAck) override;
+
+        void getBatchAsync(const NamespaceKeys& namespaceKeys, const GetBatchAck& getBatchAck) override;
+
+        void setBatchAsync(const NamespaceDataMaps& namespaceDataMaps, const ModifyAck& modifyAck) override;
+
+        void writeBatchAsync(const Namespace& ns, const WriteBatch& writeBatch, const WriteBatchAck& writeBatchAck) override;
+
+        void getStatisticsAsync(const GetStatisticsAck& getStatisticsAck) override;
+
+        void setOperationTimeout(const std::chrono::steady_clock::duration& timeout) override;
+
+    private:
+        std::shared_ptr<Engine> engine;
+        std::unique_ptr<AsyncStorage> asyncStorage;
+        const Executor executor;
+        /* Scan continuations hold a weak reference to this, as they may be called
+         * after the storage has been destroyed.
+         */
+        std::shared_ptr<bool> alive;
+        std::thread ioThread;
+
+        template <typename... Args>
+        std::function<void(Args...)> deliver(const std::function<void(Args...)>& ack) const;
+    };
+}
+
+#endif
@@ -0,0 +1,36 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_THROWEXCEPTIONFORERRORCODE_HPP_
+#define SHAREDDATALAYER_THROWEXCEPTIONFORERRORCODE_HPP_
+
+#include <system_error>
+
+namespace shareddatalayer
+{
+    /**
+     * Throw the SDL exception corresponding to the given asynchronous operation error.
+     * Used by the synchronous API implementations to report failed operations.
+     */
+    void throwExceptionForErrorCode[[ noreturn ]](const std::error_code& ec);
+}
+
+#endif
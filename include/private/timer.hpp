@@ -22,9 +22,10 @@
 #ifndef SHAREDDATALAYER_TIMER_HPP_
 #define SHAREDDATALAYER_TIMER_HPP_
 
-#include <map>
+#include <cstdint>
 #include <functional>
 #include <chrono>
+#include "private/inlinefunction.hpp"
 
 namespace shareddatalayer
 {
@@ -43,6 +44,12 @@ namespace shareddatalayer
 
         using Callback = std::function<void()>;
 
+        /**
+         * Callback given to arm(). Callbacks of at most 128 bytes are stored
+         * inside the timer, so arming does not allocate.
+         */
+        using Function = InlineFunction<void(), 128>;
+
         /**
          * Create a new timer. Each timer is associated with an Engine instance
          * and the associated Engine instance must exist as long as the timer
@@ -58,14 +65,15 @@ namespace shareddatalayer
          * Arm this timer. If already armed, then first disarm and then arm.
          *
          * @param duration Duration until this timer expires starting from
-         *                 <i>now</i>.
+         *                 <i>now</i>. The expiration time is rounded up to
+         *                 the timer resolution of one millisecond.
          * @param cb       Callback function to be called when this timer
          *                 expires. The callback will not be called if this
          *                 timer is disarmed or deleted before expiration.
          *
          * @see disarm
          */
-        void arm(const Duration& duration, const Callback& cb);
+        void arm(const Duration& duration, Function cb);
 
         /**
          * Disarm this timer if armed. If not armed, then nothing is done.
@@ -90,12 +98,17 @@ namespace shareddatalayer
     private:
         friend class TimerFD;
 
-        using Queue = std::multimap<Timer::Duration, std::pair<const Timer*, Timer::Callback>>;
-
         Engine& engine;
         bool armed;
-        /* The iterator is valid only while this timer is armed */
-        Queue::iterator iterator;
+        Function function;
+        /* The following are used by TimerFD only while this timer is armed */
+        mutable Callback callback;
+        mutable uint64_t expiry;
+        mutable unsigned int slot;
+        mutable Timer* previous;
+        mutable Timer* next;
+
+        void expire();
     };
 }
 
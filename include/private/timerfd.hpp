@@ -22,6 +22,8 @@
 #ifndef SHAREDDATALAYER_TIMERFD_HPP_
 #define SHAREDDATALAYER_TIMERFD_HPP_
 
+#include <array>
+#include <cstdint>
 #include <sys/timerfd.h>
 #include "private/timer.hpp"
 #include "private/filedescriptor.hpp"
@@ -31,6 +33,21 @@ namespace shareddatalayer
     class Engine;
     class System;
 
+    /**
+     * TimerFD keeps the armed timers in a hierarchical timing wheel, so that
+     * arming and disarming a timer are constant time operations regardless of
+     * the number of armed timers. The wheel has four levels of 64 slots with
+     * one millisecond resolution on the lowest level. Timers which do not fit
+     * in the wheel are kept in an overflow list until they do.
+     *
+     * Timers which are due are moved to an expired list before any callback
+     * is called, so a timer armed by a callback is due on the next pass at
+     * the earliest, even if it expires immediately.
+     *
+     * The timerfd is armed to the earliest expiration time when a timer which
+     * expires earlier than any other timer is armed. Disarming a timer does
+     * not touch the timerfd, unless the disarmed timer was the last one.
+     */
     class TimerFD
     {
     public:
@@ -50,31 +67,57 @@ namespace shareddatalayer
         TimerFD& operator = (const TimerFD&) = delete;
 
     private:
-        using Queue = Timer::Queue;
+        static const unsigned int SLOT_BITS = 6U;
+        static const unsigned int SLOTS_PER_LEVEL = 1U << SLOT_BITS;
+        static const unsigned int LEVELS = 4U;
+        static const unsigned int OVERFLOW_SLOT = LEVELS * SLOTS_PER_LEVEL;
+        static const unsigned int EXPIRED_SLOT = OVERFLOW_SLOT + 1U;
 
-        bool isFirst(Queue::iterator it) const;
+        struct Slot
+        {
+            Timer* first;
+            Timer* last;
+        };
 
-        Timer::Duration toAbsolute(const Timer::Duration& duration);
+        uint64_t toTicks(const Timer::Duration& duration) const;
+
+        Timer::Duration now() const;
+
+        void insert(Timer& timer);
+
+        void unlink(const Timer& timer);
 
         void handleEvents();
 
         bool timerExpired() const;
 
-        void handleExpiredTimers();
+        void handleExpiredTimers(uint64_t nowTicks);
+
+        bool nextSlot(unsigned int& slot, uint64_t& startTicks) const;
+
+        void moveToExpired(unsigned int slot);
+
+        void callExpiredTimers();
+
+        void cascadeSlot(unsigned int slot);
 
-        void popAndExecuteFirstTimer();
+        uint64_t earliestExpiry() const;
 
-        Timer::Duration nextTrigger() const;
+        void updateTimerFD();
 
         void disarmTimerFD();
 
-        void armTimerFD(const Timer::Duration& duration);
+        void armTimerFD(uint64_t ticks);
 
         void setTimeForTimerFD(time_t seconds, long int nanoseconds);
 
         System& system;
         FileDescriptor fd;
-        Queue queue;
+        std::array<Slot, EXPIRED_SLOT + 1U> slots;
+        std::array<uint64_t, LEVELS> occupied;
+        uint64_t currentTicks;
+        uint64_t armedTicks;
+        size_t count;
     };
 }
 
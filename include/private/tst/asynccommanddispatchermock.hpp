@@ -37,7 +37,11 @@ namespace shareddatalayer
 
             MOCK_METHOD1(registerDisconnectCb, void(const DisconnectCb& disconnectCb));
 
-            MOCK_METHOD3(dispatchAsync, void(const CommandCb& commandCb, const AsyncConnection::Namespace& ns, const redis::Contents& contents));
+            MOCK_METHOD3(dispatchAsync, void(CommandCb commandCb, const AsyncConnection::Namespace& ns, const redis::Contents& contents));
+
+            MOCK_METHOD0(cork, void());
+
+            MOCK_METHOD0(uncork, void());
 
             MOCK_METHOD0(disableCommandCallbacks, void());
         };
@@ -40,6 +40,10 @@ namespace shareddatalayer
 
             MOCK_METHOD3(getAsync, void(const Namespace& ns, const Keys& keys, const GetAck& getAck));
 
+            MOCK_METHOD3(getViewsAsync, void(const Namespace& ns, const Keys& keys, const GetViewsAck& getViewsAck));
+
+            MOCK_METHOD4(getViewsAsync, void(const Namespace& ns, const Keys& keys, const DataVisitor& dataVisitor, const GetVisitAck& getVisitAck));
+
             MOCK_METHOD3(removeAsync, void(const Namespace& ns, const Keys& keys, const ModifyAck& modifyAck));
 
             MOCK_METHOD4(removeIfAsync, void(const Namespace& ns, const Key& key, const Data& data, const ModifyIfAck& modifyIfAck));
@@ -48,8 +52,28 @@ namespace shareddatalayer
 
             MOCK_METHOD3(listKeys, void(const Namespace& ns, const std::string& pattern, const FindKeysAck& findKeysAck));
 
+            MOCK_METHOD4(scanKeysAsync, void(const Namespace& ns, const std::string& pattern, std::size_t countHint, const ScanKeysAck& scanKeysAck));
+
             MOCK_METHOD2(removeAllAsync, void(const Namespace& ns, const ModifyAck& modifyAck));
 
+            MOCK_METHOD3(removeByPrefixAsync, void(const Namespace& ns, const std::string& keyPrefix, const ModifyAck& modifyAck));
+
+            MOCK_METHOD4(subscribeChannelAsync, void(const Namespace& ns, const Channels& channels, const NotificationCb& notificationCb, const ModifyAck& subscribeAck));
+
+            MOCK_METHOD3(unsubscribeChannelAsync, void(const Namespace& ns, const Channels& channels, const ModifyAck& unsubscribeAck));
+
+            MOCK_METHOD4(publishAsync, void(const Namespace& ns, const Channel& channel, const std::string& message, const ModifyAck& modifyAck));
+
+            MOCK_METHOD2(getBatchAsync, void(const NamespaceKeys& namespaceKeys, const GetBatchAck& getBatchAck));
+
+            MOCK_METHOD2(setBatchAsync, void(const NamespaceDataMaps& namespaceDataMaps, const ModifyAck& modifyAck));
+
+            MOCK_METHOD3(writeBatchAsync, void(const Namespace& ns, const WriteBatch& writeBatch, const WriteBatchAck& writeBatchAck));
+
+            MOCK_METHOD1(getStatisticsAsync, void(const GetStatisticsAck& getStatisticsAck));
+
+            MOCK_METHOD1(setOperationTimeout, void(const std::chrono::steady_clock::duration& timeout));
+
             MOCK_METHOD2(waitReadyAsync, void(const Namespace& ns, const ReadyAck& readyAck));
 
             MOCK_CONST_METHOD0(fd, int());
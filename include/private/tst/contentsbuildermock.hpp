@@ -24,6 +24,7 @@
 
 #include <gmock/gmock.h>
 #include "private/redis/contentsbuilder.hpp"
+#include "private/redis/script.hpp"
 
 namespace shareddatalayer
 {
@@ -42,6 +43,16 @@ namespace shareddatalayer
                                                       const std::string& string2,
                                                       const std::string& string3));
 
+            MOCK_CONST_METHOD6(build, redis::Contents(const std::string& string,
+                                                      const std::string& string2,
+                                                      const std::string& string3,
+                                                      const std::string& string4,
+                                                      const std::string& string5,
+                                                      const std::string& string6));
+
+            MOCK_CONST_METHOD2(build, redis::Contents(const std::string& string,
+                                                      const std::vector<std::string>& strings));
+
             MOCK_CONST_METHOD3(build, redis::Contents(const std::string& string,
                                                       const AsyncConnection::Namespace& ns,
                                                       const AsyncConnection::DataMap& dataMap));
@@ -87,6 +98,11 @@ namespace shareddatalayer
                                                       const AsyncConnection::Keys& keys,
                                                       const std::string& string2,
                                                       const std::string& string3));
+
+            MOCK_CONST_METHOD4(build, redis::Contents(const redis::Script& script,
+                                                      const AsyncConnection::Namespace& ns,
+                                                      const std::vector<AsyncConnection::Key>& keys,
+                                                      const std::vector<std::string>& args));
         };
     }
 }
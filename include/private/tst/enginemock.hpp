@@ -47,7 +47,7 @@ namespace shareddatalayer
 
             MOCK_METHOD1(deleteMonitoredFD, void(int fd));
 
-            MOCK_METHOD1(postCallback, void(const Callback& callback));
+            MOCK_METHOD1(postCallback, void(Callback callback));
 
             MOCK_METHOD3(armTimer, void(Timer& timer, const Timer::Duration& duration, const Timer::Callback& cb));
 
@@ -60,6 +60,8 @@ namespace shareddatalayer
 
             MOCK_METHOD1(redisAsyncHandleWrite, void(redisAsyncContext* ac));
 
+            MOCK_METHOD2(redisBufferWrite, int(redisContext* context, int* done));
+
             MOCK_METHOD1(redisAsyncDisconnect, void(redisAsyncContext* ac));
 
             MOCK_METHOD1(redisAsyncFree, void(redisAsyncContext* ac));
@@ -0,0 +1,101 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_TST_MOVEARGACTION_HPP_
+#define SHAREDDATALAYER_TST_MOVEARGACTION_HPP_
+
+#include <type_traits>
+#include <utility>
+#include <gmock/gmock.h>
+
+namespace shareddatalayer
+{
+    namespace tst
+    {
+        /*
+         * Counterparts of SaveArg for move-only arguments, like callbacks, which the
+         * mocked function takes by value. Mock actions get the arguments as a const
+         * tuple, but the tuple itself is a temporary owned by the mock, thus the
+         * argument can be moved out of it.
+         */
+        template <int k, typename Args>
+        typename std::decay<typename std::tuple_element<k, Args>::type>::type&& moveArg(const Args& args)
+        {
+            using Arg = typename std::decay<typename std::tuple_element<k, Args>::type>::type;
+            return std::move(const_cast<Arg&>(::testing::get<k>(args)));
+        }
+
+        /* ACTION_TEMPLATE would copy the arguments, thus the actions are implemented as
+         * polymorphic actions which only get a reference to the argument tuple.
+         */
+        template <int k, typename Pointer>
+        class SaveMovedArgAction
+        {
+        public:
+            explicit SaveMovedArgAction(Pointer pointer):
+                pointer(pointer)
+            {
+            }
+
+            template <typename Result, typename Args>
+            void Perform(const Args& args) const
+            {
+                *pointer = moveArg<k>(args);
+            }
+
+        private:
+            Pointer pointer;
+        };
+
+        template <int k, typename Container>
+        class AppendMovedArgAction
+        {
+        public:
+            explicit AppendMovedArgAction(Container* container):
+                container(container)
+            {
+            }
+
+            template <typename Result, typename Args>
+            void Perform(const Args& args) const
+            {
+                container->push_back(moveArg<k>(args));
+            }
+
+        private:
+            Container* container;
+        };
+
+        template <int k, typename Pointer>
+        ::testing::PolymorphicAction<SaveMovedArgAction<k, Pointer>> SaveMovedArg(Pointer pointer)
+        {
+            return ::testing::MakePolymorphicAction(SaveMovedArgAction<k, Pointer>(pointer));
+        }
+
+        template <int k, typename Container>
+        ::testing::PolymorphicAction<AppendMovedArgAction<k, Container>> AppendMovedArg(Container* container)
+        {
+            return ::testing::MakePolymorphicAction(AppendMovedArgAction<k, Container>(container));
+        }
+    }
+}
+
+#endif
@@ -34,6 +34,8 @@ namespace shareddatalayer
             MOCK_METHOD1(addNamespaceConfiguration, void(const NamespaceConfiguration&));
             MOCK_CONST_METHOD1(isDbBackendUseEnabled, bool(const std::string&));
             MOCK_CONST_METHOD1(areNotificationsEnabled, bool(const std::string&));
+            MOCK_CONST_METHOD1(getNearCacheSize, std::size_t(const std::string&));
+            MOCK_CONST_METHOD0(isNearCacheUsed, bool());
             MOCK_CONST_METHOD1(getDescription, std::string(const std::string&));
             MOCK_CONST_METHOD0(isEmpty, bool());
         };
@@ -22,6 +22,7 @@
 #ifndef SHAREDDATALAYER_ASYNCSTORAGE_HPP_
 #define SHAREDDATALAYER_ASYNCSTORAGE_HPP_
 
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <map>
@@ -33,6 +34,8 @@
 #include <vector>
 #include <sdl/errorqueries.hpp>
 #include <sdl/publisherid.hpp>
+#include <sdl/statistics.hpp>
+#include <sdl/writebatch.hpp>
 
 namespace shareddatalayer
 {
@@ -54,7 +57,8 @@ namespace shareddatalayer
      * @see handleEvents
      *
      * @note The same instance of AsyncStorage must not be shared between multiple
-     *       threads without explicit application level locking.
+     *       threads without explicit application level locking, unless the instance
+     *       has been created with AsyncStorage::createThreaded().
      *
      * @see SyncStorage for synchronous interface.
      */
@@ -250,6 +254,89 @@ namespace shareddatalayer
                               const Keys& keys,
                               const GetAck& getAck) = 0;
 
+        /**
+         * View to a data buffer owned by shared data layer. The view is valid only during
+         * the acknowledgement or visitor call it is given to, data needed after that must be
+         * copied by the client.
+         */
+        struct DataView
+        {
+            const uint8_t* data;
+            size_t size;
+        };
+
+        /**
+         * Found keys and views to their data. Key pointers refer to the keys given to
+         * getViewsAsync and are valid as long as the data views.
+         */
+        using DataViews = std::vector<std::pair<const Key*, DataView>>;
+
+        /**
+         * Read acknowledgement to be called when getViewsAsync request using data views has been
+         * handled.
+         *
+         * @param error Error code describing the status of the request. The <code>std::error_code::category()</code>
+         *              and <code>std::error_code::value()</code> are implementation specific. Client is advised
+         *              to compare received error against <code>shareddatalayer::Error</code> constants when
+         *              doing error handling. See documentation: sdl/errorqueries.hpp for further information.
+         *              Received <code>std::error_code</code> and <code>std::error_code::message()</code> can be stored
+         *              and provided to shareddatalayer developers if problem needs further investigation.
+         * @param dataViews Views to the data read from the storage, valid only during the call.
+         *                  Empty container is returned in case of error.
+         */
+        using GetViewsAck = std::function<void(const std::error_code& error, const DataViews& dataViews)>;
+
+        /**
+         * Read data from shared data layer storage without copying it into a DataMap. Only
+         * those entries that are found will be returned.
+         *
+         * @param ns Namespace under which this operation is targeted.
+         * @param keys Data to be read.
+         * @param getViewsAck The acknowledgement to be called once the request has been handled.
+         *                    The given function is called in the context of handleEvents() function.
+         */
+        virtual void getViewsAsync(const Namespace& ns,
+                                   const Keys& keys,
+                                   const GetViewsAck& getViewsAck) = 0;
+
+        /**
+         * Visitor to be called for each found key when getViewsAsync request using a visitor has
+         * been handled.
+         *
+         * @param key Found key.
+         * @param data View to the data of the key, valid only during the call.
+         */
+        using DataVisitor = std::function<void(const Key& key, const DataView& data)>;
+
+        /**
+         * Acknowledgement to be called after the visitor has been called for all found keys.
+         *
+         * @param error Error code describing the status of the request. The <code>std::error_code::category()</code>
+         *              and <code>std::error_code::value()</code> are implementation specific. Client is advised
+         *              to compare received error against <code>shareddatalayer::Error</code> constants when
+         *              doing error handling. See documentation: sdl/errorqueries.hpp for further information.
+         *              Received <code>std::error_code</code> and <code>std::error_code::message()</code> can be stored
+         *              and provided to shareddatalayer developers if problem needs further investigation.
+         */
+        using GetVisitAck = std::function<void(const std::error_code& error)>;
+
+        /**
+         * Read data from shared data layer storage and pass it to the given visitor one key
+         * at a time. Only those entries that are found are visited. Visitor is not called in
+         * case of error.
+         *
+         * @param ns Namespace under which this operation is targeted.
+         * @param keys Data to be read.
+         * @param dataVisitor The visitor to be called for each found key. The given function is
+         *                    called in the context of handleEvents() function.
+         * @param getVisitAck The acknowledgement to be called once the request has been handled.
+         *                    The given function is called in the context of handleEvents() function.
+         */
+        virtual void getViewsAsync(const Namespace& ns,
+                                   const Keys& keys,
+                                   const DataVisitor& dataVisitor,
+                                   const GetVisitAck& getVisitAck) = 0;
+
         /**
          * Remove data from shared data layer storage. Existing keys are removed. Removing
          * is done atomically, i.e. either all succeeds or all fails.
@@ -330,8 +417,52 @@ namespace shareddatalayer
                               const FindKeysAck& findKeysAck) = 0;
 
         /**
-         * Remove all keys under the namespace. Found keys are removed atomically, i.e.
-         * either all succeeds or all fails.
+         * Function requesting the next page of a scanKeysAsync() request. The next page
+         * is acknowledged with the same acknowledgement function as the previous page.
+         * The scan is stopped simply by not calling the function. If the AsyncStorage
+         * instance has been destroyed, the function calls the acknowledgement with an
+         * error instead.
+         */
+        using ScanKeysNext = std::function<void()>;
+
+        /**
+         * Acknowledgement for one page of a scanKeysAsync() request.
+         *
+         * @param error Error code. If no error, then error code is false.
+         * @param keys The keys found on this page. A key may be reported more than once
+         *             during one scan if the namespace is modified while the scan is ongoing.
+         * @param next Function requesting the next page. Empty, if this is the last page
+         *             or if error is set.
+         */
+        using ScanKeysAck = std::function<void(const std::error_code& error, const Keys& keys, const ScanKeysNext& next)>;
+
+        /**
+         * Incrementally list keys matching search glob-style pattern under the namespace.
+         * Unlike listKeys(), the found keys are delivered page by page, so neither the
+         * memory usage of the client nor the time the backend spends per request grows
+         * with the size of the namespace. Supported patterns are the same as with
+         * listKeys().
+         *
+         * If operation timeout has been set with setOperationTimeout(), it is applied to
+         * each page separately.
+         *
+         * @param ns Namespace under which this operation is targeted.
+         * @param pattern Find keys matching a given glob-style pattern.
+         * @param countHint Hint for the backend how many keys to examine per page. The
+         *                  number of keys delivered in one page can be smaller or larger,
+         *                  and a page can also be empty. Zero selects a default value.
+         * @param scanKeysAck The acknowledgement to be called once for each page.
+         *                    The given function is called in the context of handleEvents() function.
+         */
+        virtual void scanKeysAsync(const Namespace& ns,
+                                   const std::string& pattern,
+                                   std::size_t countHint,
+                                   const ScanKeysAck& scanKeysAck) = 0;
+
+        /**
+         * Remove all keys under the namespace. Keys are found and removed in batches, thus the
+         * operation is not atomic: if an error occurs, some of the keys may have been removed.
+         * Keys added to the namespace while the operation is ongoing may or may not be removed.
          *
          * @param ns Namespace under which this operation is targeted.
          * @param modifyAck The acknowledgement to be called once the request has been handled.
@@ -340,6 +471,200 @@ namespace shareddatalayer
         virtual void removeAllAsync(const Namespace& ns,
                                     const ModifyAck& modifyAck) = 0;
 
+        /**
+         * Remove all keys starting with given key prefix under the namespace. Keys are found
+         * and removed in batches like with removeAllAsync().
+         *
+         * @param ns Namespace under which this operation is targeted.
+         * @param keyPrefix Only keys starting with given keyPrefix are removed. Passing empty
+         *                  string as keyPrefix removes all keys.
+         * @param modifyAck The acknowledgement to be called once the request has been handled.
+         *                  The given function is called in the context of handleEvents() function.
+         */
+        virtual void removeByPrefixAsync(const Namespace& ns,
+                                         const std::string& keyPrefix,
+                                         const ModifyAck& modifyAck) = 0;
+
+        using Channel = std::string;
+
+        using Channels = std::set<Channel>;
+
+        using Messages = std::vector<std::string>;
+
+        /**
+         * Channel on which a notification is published after each successful modification of
+         * the namespace, if notifications are enabled for the namespace. The message of the
+         * notification is the publisher ID of the client which made the modification.
+         */
+        static constexpr const char* MODIFICATIONS_CHANNEL = "";
+
+        /**
+         * Notification callback to be called when messages have been published on a subscribed
+         * channel. Messages received on the same channel during one event loop iteration are
+         * delivered with one call, in the order they were published.
+         *
+         * @param channel The channel on which the messages were published.
+         * @param messages The published messages.
+         */
+        using NotificationCb = std::function<void(const Channel& channel, const Messages& messages)>;
+
+        /**
+         * Subscribe to channels of the namespace. Channels are namespace specific, i.e. messages
+         * published on a channel of another namespace are not delivered. Subscribing again to an
+         * already subscribed channel replaces its notification callback.
+         *
+         * Subscriptions are renewed automatically if the connection to the backend data storage
+         * is lost and re-established. Messages published while the connection is lost are not
+         * delivered.
+         *
+         * @param ns Namespace under which this operation is targeted.
+         * @param channels Channels to subscribe. MODIFICATIONS_CHANNEL can be used to subscribe
+         *                 to the modification notifications of the namespace.
+         * @param notificationCb The callback to be called when messages have been published on
+         *                       any of the given channels. The given function is called in the
+         *                       context of handleEvents() function.
+         * @param subscribeAck The acknowledgement to be called once the subscription is active.
+         *                     The given function is called in the context of handleEvents() function.
+         */
+        virtual void subscribeChannelAsync(const Namespace& ns,
+                                           const Channels& channels,
+                                           const NotificationCb& notificationCb,
+                                           const ModifyAck& subscribeAck) = 0;
+
+        /**
+         * Unsubscribe from channels of the namespace. Notification callbacks of the given
+         * channels are not called after unsubscribeAck has been called.
+         *
+         * @param ns Namespace under which this operation is targeted.
+         * @param channels Channels to unsubscribe.
+         * @param unsubscribeAck The acknowledgement to be called once the request has been handled.
+         *                       The given function is called in the context of handleEvents() function.
+         */
+        virtual void unsubscribeChannelAsync(const Namespace& ns,
+                                             const Channels& channels,
+                                             const ModifyAck& unsubscribeAck) = 0;
+
+        /**
+         * Publish a message on a channel of the namespace.
+         *
+         * @param ns Namespace under which this operation is targeted.
+         * @param channel The channel on which the message is published.
+         * @param message The message to be published.
+         * @param modifyAck The acknowledgement to be called once the request has been handled.
+         *                  The given function is called in the context of handleEvents() function.
+         */
+        virtual void publishAsync(const Namespace& ns,
+                                  const Channel& channel,
+                                  const std::string& message,
+                                  const ModifyAck& modifyAck) = 0;
+
+        using NamespaceKeys = std::map<Namespace, Keys>;
+
+        using NamespaceDataMaps = std::map<Namespace, DataMap>;
+
+        /**
+         * Read acknowledgement to be called when getBatchAsync request has been handled.
+         *
+         * @param error Error code describing the status of the request. If reading from any of
+         *              the namespaces failed, the error of the first failed read is given.
+         * @param namespaceDataMaps Data read from each namespace, see getAsync(). Empty if
+         *                          <code>error</code> is set.
+         */
+        using GetBatchAck = std::function<void(const std::error_code& error, const NamespaceDataMaps& namespaceDataMaps)>;
+
+        /**
+         * Read data from several namespaces with one request. The reads of all the namespaces
+         * served by the same backend data storage are sent to it together, thus the batch
+         * takes one round trip per backend data storage instead of one per namespace.
+         *
+         * @param namespaceKeys Keys to read from each namespace.
+         * @param getBatchAck The acknowledgement to be called once the request has been handled.
+         *                    The given function is called in the context of handleEvents() function.
+         */
+        virtual void getBatchAsync(const NamespaceKeys& namespaceKeys,
+                                   const GetBatchAck& getBatchAck) = 0;
+
+        /**
+         * Write data to several namespaces with one request, see getBatchAsync(). Writing to
+         * each namespace is atomic, as in setAsync(), but writing the whole batch is not: if
+         * writing to some namespace fails, writes to the other namespaces may have succeeded.
+         *
+         * @param namespaceDataMaps Data to be written to each namespace.
+         * @param modifyAck The acknowledgement to be called once the request has been handled.
+         *                  If writing to any of the namespaces failed, the error of the first
+         *                  failed write is given. The given function is called in the context
+         *                  of handleEvents() function.
+         */
+        virtual void setBatchAsync(const NamespaceDataMaps& namespaceDataMaps,
+                                   const ModifyAck& modifyAck) = 0;
+
+        /**
+         * Write acknowledgement to be called when writeBatchAsync request has been handled.
+         *
+         * @param error Error code describing the status of the request, see ModifyAck. If
+         *              <code>error</code> is set, some or all of the operations may still
+         *              have been executed: modifications done before a failing operation
+         *              are not rolled back, and a request without a reply may have been
+         *              executed in full.
+         * @param statuses Status of each operation of the batch, in the order of the operations.
+         *                 Status of a conditional operation is false if the modification was not
+         *                 done due to the given prerequisite, otherwise status is true. Empty if
+         *                 <code>error</code> is set.
+         */
+        using WriteBatchAck = std::function<void(const std::error_code& error, const std::vector<bool>& statuses)>;
+
+        /**
+         * Execute the operations of a write batch with one request to the backend data
+         * storage. No other request is executed in between the operations, but if an
+         * operation fails, the modifications of the preceding operations remain, see
+         * WriteBatchAck. If notifications are enabled for the namespace, one notification is
+         * published if any of the operations modified the data.
+         *
+         * @param ns Namespace under which this operation is targeted.
+         * @param writeBatch The operations to execute.
+         * @param writeBatchAck The acknowledgement to be called once the request has been handled.
+         *                      The given function is called in the context of handleEvents() function.
+         */
+        virtual void writeBatchAsync(const Namespace& ns,
+                                     const WriteBatch& writeBatch,
+                                     const WriteBatchAck& writeBatchAck) = 0;
+
+        /**
+         * Statistics acknowledgement to be called when getStatisticsAsync request has been handled.
+         *
+         * @param statistics Snapshot of the operation statistics of this instance.
+         */
+        using GetStatisticsAck = std::function<void(const Statistics& statistics)>;
+
+        /**
+         * Get counters, byte counts and latency histograms of the data operations done with
+         * this instance, per namespace and operation type. Statistics are collected by each
+         * instance separately, thus collecting them does not need any synchronization
+         * between instances or threads. Statistics are collected only if enabled in the
+         * SDL configuration, otherwise the snapshot contains no operation counts.
+         *
+         * @param getStatisticsAck The acknowledgement to be called with a snapshot of the
+         *                         statistics taken when this function was called. The given
+         *                         function is called in the context of handleEvents() function.
+         */
+        virtual void getStatisticsAsync(const GetStatisticsAck& getStatisticsAck) = 0;
+
+        /**
+         * Set a deadline for the data operations of this instance. By default data operations
+         * do not have a deadline, acknowledgement is called only when the backend data storage
+         * replies or the connection to it is lost. When a deadline is set and the operation
+         * has not completed before the deadline, the acknowledgement is called with an
+         * <code>std::error_code</code> which is comparable to
+         * <code>shareddatalayer::Error::OPERATION_INTERRUPTED</code> and a possible late reply
+         * from the backend data storage is discarded.
+         *
+         * The deadline applies to operations started after this call. waitReadyAsync() is not
+         * affected. Timeout value 0 means no deadline.
+         *
+         * @param timeout Timeout value to set.
+         */
+        virtual void setOperationTimeout(const std::chrono::steady_clock::duration& timeout) = 0;
+
         /**
          * Create a new instance of AsyncStorage.
          *
@@ -347,6 +672,34 @@ namespace shareddatalayer
          */
         static std::unique_ptr<AsyncStorage> create();
 
+        /**
+         * Executor used to deliver acknowledgements of an AsyncStorage instance created with
+         * createThreaded(). The executor is called in the context of the internal I/O thread
+         * and it must arrange the given task to be run, for example in the application's own
+         * worker thread.
+         */
+        using Executor = std::function<void(const std::function<void()>& task)>;
+
+        /**
+         * Create a new instance of AsyncStorage which handles its I/O in an internal thread.
+         *
+         * Progress of the operations does not depend on the application's event loop, thus
+         * the application does not need to monitor fd() nor call handleEvents(). Operations
+         * can be started from any thread.
+         *
+         * Acknowledgements and data visitors are called in the internal I/O thread, unless an
+         * executor is given. In that case they are passed as tasks to the executor. Data views
+         * given to tasks run by the executor are valid during the task.
+         *
+         * The instance must not be destroyed in the internal I/O thread, thus without an
+         * executor it must not be destroyed in an acknowledgement. Doing so aborts the process.
+         *
+         * @param executor Optional executor to deliver acknowledgements with.
+         *
+         * @return New instance of AsyncStorage.
+         */
+        static std::unique_ptr<AsyncStorage> createThreaded(const Executor& executor = Executor());
+
     protected:
         AsyncStorage() = default;
     };
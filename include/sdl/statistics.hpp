@@ -0,0 +1,175 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_STATISTICS_HPP_
+#define SHAREDDATALAYER_STATISTICS_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace shareddatalayer
+{
+    /**
+     * @brief Snapshot of the operation statistics of one AsyncStorage instance.
+     *
+     * Statistics are counted separately for each namespace and operation type since the
+     * AsyncStorage instance was created. An operation is counted when its acknowledgement is
+     * called, thus operations still in progress are not included. Latency of an operation is
+     * the time from starting the operation to calling its acknowledgement.
+     *
+     * Snapshot is got with AsyncStorage::getStatisticsAsync(). It can be exported in
+     * Prometheus text exposition format with toPrometheusText().
+     *
+     * If the slow operation log is enabled in SDL configuration, the snapshot contains also
+     * the latest operations whose latency exceeded the configured threshold.
+     */
+    class Statistics
+    {
+    public:
+        using Namespace = std::string;
+
+        enum class OperationType
+        {
+            SET,
+            SET_IF,
+            SET_IF_NOT_EXISTS,
+            GET,
+            REMOVE,
+            REMOVE_IF,
+            FIND_KEYS,
+            LIST_KEYS,
+            SCAN_KEYS,
+            REMOVE_ALL,
+            REMOVE_BY_PREFIX,
+            PUBLISH,
+            GET_BATCH,
+            SET_BATCH,
+            WRITE_BATCH,
+            //Keep this always as last item. Used to loop all enum values.
+            END_MARKER
+        };
+
+        /**
+         * Number of latency histogram buckets. Upper bound of bucket <code>i</code> is
+         * <code>2^i</code> microseconds, except the last bucket which is unbounded.
+         */
+        static constexpr std::size_t LATENCY_BUCKETS = 26;
+
+        struct OperationStatistics
+        {
+            /** Number of completed operations. */
+            std::uint64_t count = 0;
+
+            /** Number of operations completed with an error. */
+            std::uint64_t errors = 0;
+
+            /** Bytes of keys, data and other arguments given to the completed operations. */
+            std::uint64_t bytesSent = 0;
+
+            /** Bytes of keys and data returned by the completed operations. */
+            std::uint64_t bytesReceived = 0;
+
+            /** Sum of the latencies of the completed operations. */
+            std::chrono::nanoseconds latencySum = std::chrono::nanoseconds::zero();
+
+            /** Number of completed operations in each latency bucket, see getLatencyBucketBound(). */
+            std::array<std::uint64_t, LATENCY_BUCKETS> latencyBuckets = {{}};
+        };
+
+        using OperationStatisticsMap = std::map<OperationType, OperationStatistics>;
+
+        using NamespaceStatisticsMap = std::map<Namespace, OperationStatisticsMap>;
+
+        struct SlowOperation
+        {
+            /** Time when the operation completed. */
+            std::chrono::system_clock::time_point time;
+
+            Namespace ns;
+
+            OperationType type;
+
+            /** Number of keys or key-data pairs given to the operation. */
+            std::size_t keyCount;
+
+            /** Bytes sent and received by the operation, see OperationStatistics. */
+            std::uint64_t bytes;
+
+            /**
+             * Addresses of the database servers used for the namespace, or "none" if the
+             * namespace does not use the database backend.
+             */
+            std::string connection;
+
+            std::chrono::nanoseconds latency;
+        };
+
+        using SlowOperations = std::vector<SlowOperation>;
+
+        Statistics() = default;
+
+        explicit Statistics(const NamespaceStatisticsMap& namespaces);
+
+        Statistics(const NamespaceStatisticsMap& namespaces, const SlowOperations& slowOperations);
+
+        /**
+         * Get statistics of the namespaces. Only the operation types used in a namespace are
+         * included.
+         */
+        const NamespaceStatisticsMap& getNamespaces() const { return namespaces; }
+
+        /**
+         * Get the latest slow operations, the oldest first. Empty if the slow operation log is
+         * not enabled.
+         */
+        const SlowOperations& getSlowOperations() const { return slowOperations; }
+
+        /**
+         * Get the inclusive upper bound of a latency bucket. The bound of the last bucket is
+         * <code>std::chrono::microseconds::max()</code>.
+         */
+        static std::chrono::microseconds getLatencyBucketBound(std::size_t bucket);
+
+        /**
+         * Get the name of an operation type, as used in exported metrics.
+         */
+        static const char* getOperationName(OperationType type);
+
+        /**
+         * Export the statistics in Prometheus text exposition format. Metrics are named
+         * <code>sdl_operations_total</code>, <code>sdl_operation_errors_total</code>,
+         * <code>sdl_operation_sent_bytes_total</code>, <code>sdl_operation_received_bytes_total</code>
+         * and <code>sdl_operation_duration_seconds</code> (histogram), all labeled with
+         * <code>namespace</code> and <code>operation</code>.
+         */
+        std::string toPrometheusText() const;
+
+    private:
+        NamespaceStatisticsMap namespaces;
+        SlowOperations slowOperations;
+    };
+}
+
+#endif
@@ -33,6 +33,7 @@
 #include <chrono>
 #include <sdl/exception.hpp>
 #include <sdl/publisherid.hpp>
+#include <sdl/writebatch.hpp>
 
 namespace shareddatalayer
 {
@@ -49,7 +50,8 @@ namespace shareddatalayer
      * operations are carried out in a separate thread.
      *
      * @note The same instance of SyncStorage must not be shared between multiple threads
-     *       without explicit application level locking.
+     *       without explicit application level locking, unless the instance has been
+     *       created with SyncStorage::createThreadSafe().
      *
      * @see AsyncStorage for asynchronous interface.
      * @see AsyncStorage::SEPARATOR for namespace format restrictions.
@@ -299,8 +301,10 @@ namespace shareddatalayer
                               const std::string& pattern) = 0;
 
         /**
-         * Remove all keys under the namespace. Found keys are removed atomically, i.e.
-         * either all succeeds or all fails.
+         * Remove all keys under the namespace. Keys are found and removed in batches, thus the
+         * operation is not atomic: if an exception is thrown, some of the keys may have been
+         * removed. Keys added to the namespace while the operation is ongoing may or may not
+         * be removed.
          *
          * Exceptions thrown (excluding standard exceptions such as std::bad_alloc) are all derived from
          * shareddatalayer::Exception base class. Client can catch only that exception if separate handling
@@ -315,6 +319,48 @@ namespace shareddatalayer
          */
         virtual void removeAll(const Namespace& ns) = 0;
 
+        /**
+         * Remove all keys starting with given key prefix under the namespace. Keys are found
+         * and removed in batches like with removeAll().
+         *
+         * Exceptions thrown (excluding standard exceptions such as std::bad_alloc) are all derived from
+         * shareddatalayer::Exception base class. Client can catch only that exception if separate handling
+         * for different shareddatalayer error situations is not needed.
+         *
+         * @param ns Namespace under which this operation is targeted.
+         * @param keyPrefix Only keys starting with given keyPrefix are removed. Passing empty
+         *                  string as keyPrefix removes all keys.
+         *
+         * @throw BackendError if the backend data storage fails to process the request.
+         * @throw NotConnected if shareddatalayer is not connected to the backend data storage.
+         * @throw OperationInterrupted if shareddatalayer does not receive a reply from the backend data storage.
+         * @throw InvalidNamespace if given namespace does not meet the namespace format restrictions.
+         */
+        virtual void removeByPrefix(const Namespace& ns, const std::string& keyPrefix) = 0;
+
+        /**
+         * Execute the operations of a write batch with one request to the backend data
+         * storage, see AsyncStorage::writeBatchAsync(). If an exception is thrown, some of
+         * the operations may still have been executed.
+         *
+         * Exceptions thrown (excluding standard exceptions such as std::bad_alloc) are all derived from
+         * shareddatalayer::Exception base class. Client can catch only that exception if separate handling
+         * for different shareddatalayer error situations is not needed.
+         *
+         * @param ns Namespace under which this operation is targeted.
+         * @param writeBatch The operations to execute.
+         *
+         * @return Status of each operation of the batch, in the order of the operations. Status
+         *         of a conditional operation is false if the modification was not done due to
+         *         the given prerequisite, otherwise status is true.
+         *
+         * @throw BackendError if the backend data storage fails to process the request.
+         * @throw NotConnected if shareddatalayer is not connected to the backend data storage.
+         * @throw OperationInterrupted if shareddatalayer does not receive a reply from the backend data storage.
+         * @throw InvalidNamespace if given namespace does not meet the namespace format restrictions.
+         */
+        virtual std::vector<bool> writeBatch(const Namespace& ns, const WriteBatch& writeBatch) = 0;
+
         /**
          * Set a timeout value for the synchronous SDL read, write and remove operations.
          * By default synchronous read, write and remove operations do not have any timeout
@@ -326,6 +372,10 @@ namespace shareddatalayer
          * Reasonable timeout value is 5 seconds or bigger value. On a side note, timeout
          * value 0 means interminable pending time.
          *
+         * The same timeout is also applied to each operation after it has been sent to
+         * the backend data storage. If the backend data storage does not reply within
+         * the timeout, OperationInterrupted exception is risen for the operation.
+         *
          * @param timeout Timeout value to set.
          */
          virtual void setOperationTimeout(const std::chrono::steady_clock::duration& timeout) = 0;
@@ -341,6 +391,18 @@ namespace shareddatalayer
          */
         static std::unique_ptr<SyncStorage> create();
 
+        /**
+         * Create a new instance of SyncStorage which can be shared between threads.
+         *
+         * Several threads can have operations pending on the returned instance at the same
+         * time, each of them blocking only until its own operation completes. All threads
+         * share the same backend connections, thus their operations are pipelined instead
+         * of each thread requiring its own SyncStorage instance.
+         *
+         * @return New thread-safe instance of SyncStorage.
+         */
+        static std::unique_ptr<SyncStorage> createThreadSafe();
+
     protected:
         SyncStorage() = default;
     };
@@ -60,6 +60,10 @@ namespace shareddatalayer
 
             virtual void getAsync(const Namespace&, const Keys&, const GetAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
 
+            virtual void getViewsAsync(const Namespace&, const Keys&, const GetViewsAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
+
+            virtual void getViewsAsync(const Namespace&, const Keys&, const DataVisitor&, const GetVisitAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
+
             virtual void removeAsync(const Namespace&, const Keys&, const ModifyAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
 
             virtual void removeIfAsync(const Namespace&, const Key&, const Data&, const ModifyIfAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
@@ -68,8 +72,28 @@ namespace shareddatalayer
 
             virtual void listKeys(const Namespace&, const std::string&, const FindKeysAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
 
+            virtual void scanKeysAsync(const Namespace&, const std::string&, std::size_t, const ScanKeysAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
+
             virtual void removeAllAsync(const Namespace&, const ModifyAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
 
+            virtual void removeByPrefixAsync(const Namespace&, const std::string&, const ModifyAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
+
+            virtual void subscribeChannelAsync(const Namespace&, const Channels&, const NotificationCb&, const ModifyAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
+
+            virtual void unsubscribeChannelAsync(const Namespace&, const Channels&, const ModifyAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
+
+            virtual void publishAsync(const Namespace&, const Channel&, const std::string&, const ModifyAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
+
+            virtual void getBatchAsync(const NamespaceKeys&, const GetBatchAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
+
+            virtual void setBatchAsync(const NamespaceDataMaps&, const ModifyAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
+
+            virtual void writeBatchAsync(const Namespace&, const WriteBatch&, const WriteBatchAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
+
+            virtual void getStatisticsAsync(const GetStatisticsAck&) override { logAndAbort(__PRETTY_FUNCTION__); }
+
+            virtual void setOperationTimeout(const std::chrono::steady_clock::duration&) override { logAndAbort(__PRETTY_FUNCTION__); }
+
         private:
             static void logAndAbort(const char* function) noexcept __attribute__ ((__noreturn__))
             {
@@ -66,6 +66,10 @@ namespace shareddatalayer
 
             virtual void removeAll(const Namespace&) override { logAndAbort(__PRETTY_FUNCTION__); }
 
+            virtual void removeByPrefix(const Namespace&, const std::string&) override { logAndAbort(__PRETTY_FUNCTION__); }
+
+            virtual std::vector<bool> writeBatch(const Namespace&, const WriteBatch&) override { logAndAbort(__PRETTY_FUNCTION__); }
+
             virtual void setOperationTimeout(const std::chrono::steady_clock::duration&) override { logAndAbort(__PRETTY_FUNCTION__); }
 
         private:
@@ -0,0 +1,118 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#ifndef SHAREDDATALAYER_WRITEBATCH_HPP_
+#define SHAREDDATALAYER_WRITEBATCH_HPP_
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace shareddatalayer
+{
+    /**
+     * @brief Write operations to be executed for one namespace as one atomic unit.
+     *
+     * Operations are added to the batch with the functions named after the corresponding
+     * AsyncStorage and SyncStorage operations and executed with
+     * AsyncStorage::writeBatchAsync() or SyncStorage::writeBatch(). The operations are
+     * executed in the order they were added, and no other client can observe or modify the
+     * data between them. A conditional operation whose condition is not met does not prevent
+     * the other operations of the batch from being executed.
+     *
+     * Functions adding operations return a reference to the batch, thus calls can be chained.
+     */
+    class WriteBatch
+    {
+    public:
+        using Key = std::string;
+
+        using Keys = std::set<Key>;
+
+        using Data = std::vector<uint8_t>;
+
+        using DataMap = std::map<Key, Data>;
+
+        enum class OperationType
+        {
+            SET,
+            REMOVE,
+            SET_IF,
+            SET_IF_NOT_EXISTS,
+            REMOVE_IF
+        };
+
+        /**
+         * One operation of a batch. SET uses <code>dataMap</code>, REMOVE uses
+         * <code>keys</code> and the conditional operations use <code>key</code> and
+         * <code>data</code>. SET_IF uses also <code>oldData</code>.
+         */
+        struct Operation
+        {
+            OperationType type;
+            DataMap dataMap;
+            Keys keys;
+            Key key;
+            Data oldData;
+            Data data;
+        };
+
+        using Operations = std::vector<Operation>;
+
+        /**
+         * Write data, see AsyncStorage::setAsync().
+         */
+        WriteBatch& set(const DataMap& dataMap);
+
+        /**
+         * Remove data, see AsyncStorage::removeAsync().
+         */
+        WriteBatch& remove(const Keys& keys);
+
+        /**
+         * Conditionally modify the value of a key, see AsyncStorage::setIfAsync().
+         */
+        WriteBatch& setIf(const Key& key, const Data& oldData, const Data& newData);
+
+        /**
+         * Conditionally set the value of a key, see AsyncStorage::setIfNotExistsAsync().
+         */
+        WriteBatch& setIfNotExists(const Key& key, const Data& data);
+
+        /**
+         * Conditionally remove data, see AsyncStorage::removeIfAsync().
+         */
+        WriteBatch& removeIf(const Key& key, const Data& data);
+
+        const Operations& getOperations() const { return operations; }
+
+        bool empty() const { return operations.empty(); }
+
+        std::size_t size() const { return operations.size(); }
+
+    private:
+        Operations operations;
+    };
+}
+
+#endif
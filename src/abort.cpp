@@ -32,5 +32,6 @@ void shareddatalayer::logAndAbort(const std::string& file, int line, const std::
     std::ostringstream msg;
     msg << "SHAREDDATALAYER_ABORT, file " << file << ", line " << line << ": " << message;
     logErrorOnce(msg.str());
+    waitLogsFlushed();
     abort();
 }
@@ -40,9 +40,9 @@ void AsyncDummyStorage::handleEvents()
     engine->handleEvents();
 }
 
-void AsyncDummyStorage::postCallback(const Callback& callback)
+void AsyncDummyStorage::postCallback(Callback callback)
 {
-    engine->postCallback(callback);
+    engine->postCallback(std::move(callback));
 }
 
 void AsyncDummyStorage::waitReadyAsync(const Namespace&, const ReadyAck& readyAck)
@@ -70,6 +70,16 @@ void AsyncDummyStorage::getAsync(const Namespace&, const Keys&, const GetAck& ge
     postCallback(std::bind(getAck, std::error_code(), DataMap()));
 }
 
+void AsyncDummyStorage::getViewsAsync(const Namespace&, const Keys&, const GetViewsAck& getViewsAck)
+{
+    postCallback(std::bind(getViewsAck, std::error_code(), DataViews()));
+}
+
+void AsyncDummyStorage::getViewsAsync(const Namespace&, const Keys&, const DataVisitor&, const GetVisitAck& getVisitAck)
+{
+    postCallback(std::bind(getVisitAck, std::error_code()));
+}
+
 void AsyncDummyStorage::removeAsync(const Namespace&, const Keys&, const ModifyAck& modifyAck)
 {
     postCallback(std::bind(modifyAck, std::error_code()));
@@ -90,7 +100,59 @@ void AsyncDummyStorage::listKeys(const Namespace&, const std::string&, const Fin
     postCallback(std::bind(findKeysAck, std::error_code(), Keys()));
 }
 
+void AsyncDummyStorage::scanKeysAsync(const Namespace&, const std::string&, std::size_t, const ScanKeysAck& scanKeysAck)
+{
+    postCallback(std::bind(scanKeysAck, std::error_code(), Keys(), ScanKeysNext()));
+}
+
 void AsyncDummyStorage::removeAllAsync(const Namespace&, const ModifyAck& modifyAck)
 {
     postCallback(std::bind(modifyAck, std::error_code()));
 }
+
+void AsyncDummyStorage::removeByPrefixAsync(const Namespace&, const std::string&, const ModifyAck& modifyAck)
+{
+    postCallback(std::bind(modifyAck, std::error_code()));
+}
+
+void AsyncDummyStorage::subscribeChannelAsync(const Namespace&, const Channels&, const NotificationCb&, const ModifyAck& subscribeAck)
+{
+    /* Nothing is ever published, thus notification callback is never called. */
+    postCallback(std::bind(subscribeAck, std::error_code()));
+}
+
+void AsyncDummyStorage::unsubscribeChannelAsync(const Namespace&, const Channels&, const ModifyAck& unsubscribeAck)
+{
+    postCallback(std::bind(unsubscribeAck, std::error_code()));
+}
+
+void AsyncDummyStorage::publishAsync(const Namespace&, const Channel&, const std::string&, const ModifyAck& modifyAck)
+{
+    postCallback(std::bind(modifyAck, std::error_code()));
+}
+
+void AsyncDummyStorage::getBatchAsync(const NamespaceKeys&, const GetBatchAck& getBatchAck)
+{
+    postCallback(std::bind(getBatchAck, std::error_code(), NamespaceDataMaps()));
+}
+
+void AsyncDummyStorage::setBatchAsync(const NamespaceDataMaps&, const ModifyAck& modifyAck)
+{
+    postCallback(std::bind(modifyAck, std::error_code()));
+}
+
+void AsyncDummyStorage::writeBatchAsync(const Namespace&, const WriteBatch& writeBatch, const WriteBatchAck& writeBatchAck)
+{
+    postCallback(std::bind(writeBatchAck, std::error_code(), std::vector<bool>(writeBatch.size(), true)));
+}
+
+void AsyncDummyStorage::getStatisticsAsync(const GetStatisticsAck& getStatisticsAck)
+{
+    /* Statistics are collected by AsyncStorageImpl. */
+    postCallback(std::bind(getStatisticsAck, Statistics()));
+}
+
+void AsyncDummyStorage::setOperationTimeout(const std::chrono::steady_clock::duration&)
+{
+    /* Operations are acknowledged immediately, thus no deadline is needed. */
+}
@@ -0,0 +1,346 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include "private/asynclogwriter.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <system_error>
+#include <syslog.h>
+#include <pthread.h>
+
+using namespace shareddatalayer;
+
+constexpr std::size_t AsyncLogWriter::DEFAULT_CAPACITY;
+constexpr std::size_t AsyncLogWriter::MAX_MESSAGE_LENGTH;
+constexpr unsigned int AsyncLogWriter::RATE_LIMIT_BURST;
+const std::chrono::steady_clock::duration AsyncLogWriter::RATE_LIMIT_INTERVAL(std::chrono::seconds(1));
+const std::chrono::steady_clock::duration AsyncLogWriter::FLUSH_INTERVAL(std::chrono::milliseconds(100));
+
+namespace
+{
+    const char TRUNCATION_MARKER[] = "... [truncated]";
+
+    /* Writers created with createProcessWriter, linked with nextProcessWriter. */
+    std::atomic<AsyncLogWriter*> processWriters(nullptr);
+
+    std::size_t append(char* text, std::size_t length, const char* s, std::size_t n)
+    {
+        n = std::min(n, AsyncLogWriter::MAX_MESSAGE_LENGTH - length);
+        std::memcpy(text + length, s, n);
+        return length + n;
+    }
+
+    /* Severity and text with every run of digits replaced with one '#'. */
+    std::string getSiteKey(int level, const char* text, std::size_t length)
+    {
+        std::string key(1, static_cast<char>('0' + level));
+        for (std::size_t i(0); i < length; ++i)
+            if (!std::isdigit(static_cast<unsigned char>(text[i])))
+                key.push_back(text[i]);
+            else if (key.back() != '#')
+                key.push_back('#');
+        return key;
+    }
+}
+
+AsyncLogWriter::AsyncLogWriter(const std::string& prefix, const Output& output):
+    AsyncLogWriter(prefix, output, DEFAULT_CAPACITY)
+{
+}
+
+AsyncLogWriter::AsyncLogWriter(const std::string& prefix, const Output& output, std::size_t capacity):
+    prefix(prefix),
+    output(output),
+    capacity(capacity),
+    slots(new Slot[capacity]),
+    writePosition(0),
+    readPosition(0),
+    dropped(0),
+    suppressed(0),
+    reportedDropped(0),
+    stopped(false),
+    nextProcessWriter(nullptr)
+{
+    for (std::size_t i(0); i < capacity; ++i)
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+AsyncLogWriter::~AsyncLogWriter()
+{
+    stop();
+}
+
+AsyncLogWriter& AsyncLogWriter::createProcessWriter(const std::string& prefix, const Output& output)
+{
+    static const bool handlersRegistered([]()
+                                         {
+                                             std::atexit(stopProcessWriters);
+                                             pthread_atfork(nullptr, nullptr, stopProcessWritersAfterFork);
+                                             return true;
+                                         }());
+    static_cast<void>(handlersRegistered);
+    auto writer(new AsyncLogWriter(prefix, output));
+    if (!writer->start())
+        writer->stop();
+    writer->nextProcessWriter = processWriters.load();
+    while (!processWriters.compare_exchange_weak(writer->nextProcessWriter, writer))
+        ;
+    return *writer;
+}
+
+void AsyncLogWriter::stopProcessWriters()
+{
+    for (auto writer(processWriters.load()); writer; writer = writer->nextProcessWriter)
+        writer->stop();
+}
+
+void AsyncLogWriter::stopProcessWritersAfterFork()
+{
+    for (auto writer(processWriters.load()); writer; writer = writer->nextProcessWriter)
+        writer->stopAfterFork();
+}
+
+bool AsyncLogWriter::start()
+{
+    try
+    {
+        thread = std::thread(&AsyncLogWriter::run, this);
+    }
+    catch (const std::system_error&)
+    {
+        return false;
+    }
+    return true;
+}
+
+void AsyncLogWriter::stop()
+{
+    if (stopped.exchange(true))
+        return;
+    {
+        /* The flusher checks stopped with the mutex locked before it waits. */
+        std::lock_guard<std::mutex> lock(mutex);
+    }
+    wakeup.notify_one();
+    if (thread.joinable())
+        thread.join();
+    const auto now(std::chrono::steady_clock::now());
+    {
+        std::lock_guard<std::mutex> lock(flushMutex);
+        flushLocked(now);
+        expireSites(now + RATE_LIMIT_INTERVAL);
+    }
+    flushed.notify_all();
+}
+
+void AsyncLogWriter::stopAfterFork()
+{
+    stopped = true;
+}
+
+bool AsyncLogWriter::write(int level, const std::string& loggerPrefix, const char* s, std::size_t n) noexcept
+{
+    Slot synchronousSlot;
+    Slot* slot(&synchronousSlot);
+    std::size_t position(0);
+    const bool synchronous(level <= LOG_CRIT || stopped.load(std::memory_order_acquire));
+    if (!synchronous)
+    {
+        position = writePosition.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            slot = &slots[position % capacity];
+            const auto difference(static_cast<std::intptr_t>(slot->sequence.load(std::memory_order_acquire))
+                                  - static_cast<std::intptr_t>(position));
+            if (difference == 0)
+            {
+                if (writePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (difference < 0)
+            {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+                position = writePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->level = level;
+    slot->time = std::chrono::steady_clock::now();
+    slot->prefixLength = append(slot->text, 0, loggerPrefix.data(), loggerPrefix.size());
+    slot->prefixLength = append(slot->text, slot->prefixLength, ": ", 2);
+    slot->length = append(slot->text, slot->prefixLength, s, n);
+    if (slot->length - slot->prefixLength < n)
+    {
+        const bool newline(s[n - 1] == '\n');
+        const auto markerLength(sizeof(TRUNCATION_MARKER) - 1);
+        std::memcpy(slot->text + MAX_MESSAGE_LENGTH - markerLength - (newline ? 1 : 0), TRUNCATION_MARKER, markerLength);
+        if (newline)
+            slot->text[MAX_MESSAGE_LENGTH - 1] = '\n';
+    }
+
+    if (synchronous)
+    {
+        try
+        {
+            if (stopped.load(std::memory_order_acquire))
+                output(level, slot->text, slot->length);
+            else
+            {
+                std::lock_guard<std::mutex> lock(flushMutex);
+                flushLocked(slot->time);
+                output(level, slot->text, slot->length);
+            }
+        }
+        catch (...)
+        {
+        }
+        return true;
+    }
+    slot->sequence.store(position + 1, std::memory_order_release);
+    /* The flusher may be waiting only if it has read all messages before this one. */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (readPosition.load(std::memory_order_relaxed) == position)
+        wakeup.notify_one();
+    return true;
+}
+
+void AsyncLogWriter::waitFlushed(const std::chrono::steady_clock::duration& timeout)
+{
+    if (stopped)
+        return;
+    const auto position(writePosition.load(std::memory_order_relaxed));
+    std::unique_lock<std::mutex> lock(mutex);
+    wakeup.notify_one();
+    flushed.wait_for(lock, timeout, [this, position]()
+                     {
+                         return stopped || readPosition.load(std::memory_order_acquire) >= position;
+                     });
+}
+
+void AsyncLogWriter::flush(const std::chrono::steady_clock::time_point& now)
+{
+    std::lock_guard<std::mutex> lock(flushMutex);
+    flushLocked(now);
+}
+
+void AsyncLogWriter::flushLocked(const std::chrono::steady_clock::time_point& now)
+{
+    auto position(readPosition.load(std::memory_order_relaxed));
+    for (;;)
+    {
+        auto& slot(slots[position % capacity]);
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+            break;
+        pass(slot);
+        slot.sequence.store(position + capacity, std::memory_order_release);
+        readPosition.store(++position, std::memory_order_release);
+    }
+    expireSites(now);
+    const auto droppedNow(dropped.load(std::memory_order_relaxed));
+    if (droppedNow != reportedDropped)
+    {
+        std::ostringstream os;
+        os << prefix << ": " << droppedNow - reportedDropped << " log message(s) dropped, log buffer full" << std::endl;
+        reportedDropped = droppedNow;
+        const auto text(os.str());
+        output(LOG_WARNING, text.data(), text.size());
+    }
+}
+
+void AsyncLogWriter::run()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopped)
+    {
+        lock.unlock();
+        flush(std::chrono::steady_clock::now());
+        lock.lock();
+        flushed.notify_all();
+        if (!stopped && isEmpty())
+            wakeup.wait_for(lock, FLUSH_INTERVAL);
+    }
+}
+
+bool AsyncLogWriter::isEmpty() const
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto position(readPosition.load(std::memory_order_relaxed));
+    return slots[position % capacity].sequence.load(std::memory_order_acquire) != position + 1;
+}
+
+void AsyncLogWriter::pass(const Slot& slot)
+{
+    auto& site(sites[getSiteKey(slot.level, slot.text, slot.length)]);
+    if (site.count && slot.time - site.windowStart >= RATE_LIMIT_INTERVAL)
+    {
+        reportSuppressed(site);
+        site.count = 0;
+        site.suppressed = 0;
+    }
+    if (!site.count)
+    {
+        site.windowStart = slot.time;
+        site.level = slot.level;
+        site.prefix.assign(slot.text, slot.prefixLength);
+    }
+    if (site.count < RATE_LIMIT_BURST)
+    {
+        ++site.count;
+        output(slot.level, slot.text, slot.length);
+    }
+    else
+    {
+        ++site.suppressed;
+        suppressed.fetch_add(1, std::memory_order_relaxed);
+        site.message.assign(slot.text + slot.prefixLength, slot.length - slot.prefixLength);
+    }
+}
+
+void AsyncLogWriter::reportSuppressed(const Site& site)
+{
+    if (!site.suppressed)
+        return;
+    std::ostringstream os;
+    os << site.prefix << site.suppressed << " similar message(s) suppressed, last: " << site.message;
+    if (site.message.empty() || site.message.back() != '\n')
+        os << std::endl;
+    const auto text(os.str());
+    output(site.level, text.data(), text.size());
+}
+
+void AsyncLogWriter::expireSites(const std::chrono::steady_clock::time_point& now)
+{
+    for (auto i(sites.begin()); i != sites.end();)
+        if (now - i->second.windowStart >= RATE_LIMIT_INTERVAL)
+        {
+            reportSuppressed(i->second);
+            i = sites.erase(i);
+        }
+        else
+            ++i;
+}
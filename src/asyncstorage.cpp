@@ -29,6 +29,7 @@
 #include "private/configurationreader.hpp"
 #include "private/databaseconfigurationimpl.hpp"
 #include "private/logger.hpp"
+#include "private/threadedasyncstorage.hpp"
 #if HAVE_REDIS
 #include "private/redis/asyncredisstorage.hpp"
 #include "private/redis/asyncdatabasediscovery.hpp"
@@ -47,12 +48,27 @@ std::unique_ptr<shareddatalayer::AsyncStorage> createInstance(const boost::optio
     return std::unique_ptr<AsyncStorageImpl>(new AsyncStorageImpl(engine, pId, logger));
 }
 
+std::unique_ptr<shareddatalayer::AsyncStorage> createThreadedInstance(const boost::optional<shareddatalayer::AsyncConnection::PublisherId>& pId,
+                                                                      const AsyncStorage::Executor& executor)
+{
+    auto engine(std::make_shared<EngineImpl>());
+    auto logger(createLogger(SDL_LOG_PREFIX));
+    std::unique_ptr<AsyncStorage> asyncStorage(new AsyncStorageImpl(engine, pId, logger));
+    return std::unique_ptr<ThreadedAsyncStorage>(new ThreadedAsyncStorage(engine, std::move(asyncStorage), executor));
+}
+
 }
 
 /* clang compilation produces undefined reference linker error without this */
 constexpr char AsyncStorage::SEPARATOR;
+constexpr const char* AsyncStorage::MODIFICATIONS_CHANNEL;
 
 std::unique_ptr<AsyncStorage> AsyncStorage::create()
 {
     return createInstance(boost::none);
 }
+
+std::unique_ptr<AsyncStorage> AsyncStorage::createThreaded(const Executor& executor)
+{
+    return createThreadedInstance(boost::none, executor);
+}
@@ -27,6 +27,9 @@
 #include "private/asyncdummystorage.hpp"
 #include "private/engine.hpp"
 #include "private/logger.hpp"
+#include "private/namespacevalidator.hpp"
+#include "private/slowoperationlog.hpp"
+#include "private/statisticscollector.hpp"
 #if HAVE_REDIS
 #include "private/redis/asyncredisstorage.hpp"
 #endif
@@ -63,6 +66,115 @@ namespace
         {
             return crc32(s)%count;
         }
+
+        using Measurement = StatisticsCollector::Measurement;
+
+        std::uint64_t getSize(const AsyncStorage::Keys& keys)
+        {
+            std::uint64_t size(0);
+            for (const auto& key : keys)
+                size += key.size();
+            return size;
+        }
+
+        std::uint64_t getSize(const AsyncStorage::DataMap& dataMap)
+        {
+            std::uint64_t size(0);
+            for (const auto& i : dataMap)
+                size += i.first.size() + i.second.size();
+            return size;
+        }
+
+        std::uint64_t getSize(const AsyncStorage::DataViews& dataViews)
+        {
+            std::uint64_t size(0);
+            for (const auto& i : dataViews)
+                size += i.first->size() + i.second.size;
+            return size;
+        }
+
+        std::uint64_t getSize(const WriteBatch& writeBatch)
+        {
+            std::uint64_t size(0);
+            for (const auto& operation : writeBatch.getOperations())
+                size += getSize(operation.dataMap) + getSize(operation.keys) + operation.key.size()
+                        + operation.oldData.size() + operation.data.size();
+            return size;
+        }
+
+        std::size_t getKeyCount(const WriteBatch& writeBatch)
+        {
+            std::size_t count(0);
+            for (const auto& operation : writeBatch.getOperations())
+                count += operation.dataMap.size() + operation.keys.size() + (operation.key.empty() ? 0 : 1);
+            return count;
+        }
+
+        AsyncStorage::ModifyAck measured(const Measurement& measurement, const AsyncStorage::ModifyAck& modifyAck)
+        {
+            return [measurement, modifyAck](const std::error_code& error)
+                   {
+                       measurement.done(error);
+                       modifyAck(error);
+                   };
+        }
+
+        AsyncStorage::ModifyIfAck measured(const Measurement& measurement, const AsyncStorage::ModifyIfAck& modifyIfAck)
+        {
+            return [measurement, modifyIfAck](const std::error_code& error, bool status)
+                   {
+                       measurement.done(error);
+                       modifyIfAck(error, status);
+                   };
+        }
+
+        AsyncStorage::GetAck measured(const Measurement& measurement, const AsyncStorage::GetAck& getAck)
+        {
+            return [measurement, getAck](const std::error_code& error, const AsyncStorage::DataMap& dataMap)
+                   {
+                       measurement.done(error, getSize(dataMap));
+                       getAck(error, dataMap);
+                   };
+        }
+
+        AsyncStorage::GetViewsAck measured(const Measurement& measurement, const AsyncStorage::GetViewsAck& getViewsAck)
+        {
+            return [measurement, getViewsAck](const std::error_code& error, const AsyncStorage::DataViews& dataViews)
+                   {
+                       measurement.done(error, getSize(dataViews));
+                       getViewsAck(error, dataViews);
+                   };
+        }
+
+        AsyncStorage::FindKeysAck measured(const Measurement& measurement, const AsyncStorage::FindKeysAck& findKeysAck)
+        {
+            return [measurement, findKeysAck](const std::error_code& error, const AsyncStorage::Keys& keys)
+                   {
+                       measurement.done(error, getSize(keys));
+                       findKeysAck(error, keys);
+                   };
+        }
+
+        AsyncStorage::ScanKeysAck measured(const Measurement& measurement, const AsyncStorage::ScanKeysAck& scanKeysAck)
+        {
+            /* Only the first page is measured, the following pages are not requested through AsyncStorageImpl. */
+            return [measurement, scanKeysAck](const std::error_code& error,
+                                              const AsyncStorage::Keys& keys,
+                                              const AsyncStorage::ScanKeysNext& next)
+                   {
+                       measurement.done(error, getSize(keys));
+                       scanKeysAck(error, keys, next);
+                   };
+        }
+
+        AsyncStorage::WriteBatchAck measured(const Measurement& measurement, const AsyncStorage::WriteBatchAck& writeBatchAck)
+        {
+            return [measurement, writeBatchAck](const std::error_code& error, const std::vector<bool>& statuses)
+                   {
+                       measurement.done(error);
+                       writeBatchAck(error, statuses);
+                   };
+        }
 }
 
 AsyncStorageImpl::AsyncStorageImpl(std::shared_ptr<Engine> engine,
@@ -73,11 +185,23 @@ AsyncStorageImpl::AsyncStorageImpl(std::shared_ptr<Engine> engine,
     namespaceConfigurations(std::make_shared<NamespaceConfigurationsImpl>()),
     publisherId(pId),
     logger(logger),
-    asyncDatabaseDiscoveryCreator(::asyncDatabaseDiscoveryCreator)
+    asyncDatabaseDiscoveryCreator(::asyncDatabaseDiscoveryCreator),
+    operationTimeout(std::chrono::steady_clock::duration::zero())
 {
     ConfigurationReader configurationReader(logger);
     configurationReader.readDatabaseConfiguration(std::ref(*databaseConfiguration));
     configurationReader.readNamespaceConfigurations(std::ref(*namespaceConfigurations));
+    SlowOperationLogConfiguration slowOperationLogConfiguration;
+    configurationReader.readSlowOperationLogConfiguration(slowOperationLogConfiguration);
+    StatisticsConfiguration statisticsConfiguration;
+    configurationReader.readStatisticsConfiguration(statisticsConfiguration);
+    statisticsCollector.setConfiguration(statisticsConfiguration);
+    if (slowOperationLogConfiguration.threshold != std::chrono::milliseconds::zero())
+        statisticsCollector.setSlowOperationLog(std::make_shared<SlowOperationLog>(slowOperationLogConfiguration,
+                                                                                   std::bind(&AsyncStorageImpl::getConnection,
+                                                                                             this,
+                                                                                             std::placeholders::_1),
+                                                                                   logger));
 }
 
 // Meant for UT usage
@@ -86,14 +210,17 @@ AsyncStorageImpl::AsyncStorageImpl(std::shared_ptr<Engine> engine,
                                    std::shared_ptr<DatabaseConfiguration> databaseConfiguration,
                                    std::shared_ptr<NamespaceConfigurations> namespaceConfigurations,
                                    std::shared_ptr<Logger> logger,
-                                   const AsyncDatabaseDiscoveryCreator& asyncDatabaseDiscoveryCreator):
+                                   const AsyncDatabaseDiscoveryCreator& asyncDatabaseDiscoveryCreator,
+                                   const StatisticsConfiguration& statisticsConfiguration):
     engine(engine),
     databaseConfiguration(databaseConfiguration),
     namespaceConfigurations(namespaceConfigurations),
     publisherId(pId),
     logger(logger),
-    asyncDatabaseDiscoveryCreator(asyncDatabaseDiscoveryCreator)
+    asyncDatabaseDiscoveryCreator(asyncDatabaseDiscoveryCreator),
+    operationTimeout(std::chrono::steady_clock::duration::zero())
 {
+    statisticsCollector.setConfiguration(statisticsConfiguration);
 }
 
 void AsyncStorageImpl::setAsyncRedisStorageHandlersForCluster(const std::string& ns)
@@ -111,6 +238,7 @@ void AsyncStorageImpl::setAsyncRedisStorageHandlersForCluster(const std::string&
                                                                 publisherId,
                                                                 namespaceConfigurations,
                                                                 logger);
+        redisHandler->setOperationTimeout(operationTimeout);
         asyncStorages.push_back(redisHandler);
     }
 }
@@ -133,16 +261,22 @@ void AsyncStorageImpl::setAsyncRedisStorageHandlers(const std::string& ns)
                                                             publisherId,
                                                             namespaceConfigurations,
                                                             logger);
+    redisHandler->setOperationTimeout(operationTimeout);
     asyncStorages.push_back(redisHandler);
 }
 
-AsyncStorage& AsyncStorageImpl::getAsyncRedisStorageHandler(const std::string& ns)
+std::size_t AsyncStorageImpl::getAsyncRedisStorageHandlerIndex(const std::string& ns)
 {
     std::size_t handlerIndex{0};
     if (DatabaseConfiguration::DbType::SDL_STANDALONE_CLUSTER == databaseConfiguration->getDbType() ||
         DatabaseConfiguration::DbType::SDL_SENTINEL_CLUSTER == databaseConfiguration->getDbType())
         handlerIndex = getClusterHashIndex(ns, databaseConfiguration->getServerAddresses().size());
-    return *asyncStorages.at(handlerIndex);
+    return handlerIndex;
+}
+
+AsyncStorage& AsyncStorageImpl::getAsyncRedisStorageHandler(const std::string& ns)
+{
+    return *asyncStorages.at(getAsyncRedisStorageHandlerIndex(ns));
 }
 
 AsyncStorage& AsyncStorageImpl::getRedisHandler(const std::string& ns)
@@ -160,8 +294,9 @@ AsyncStorage& AsyncStorageImpl::getRedisHandler(const std::string& ns)
 
 AsyncStorage& AsyncStorageImpl::getDummyHandler()
 {
-    static AsyncDummyStorage dummyHandler{engine};
-    return dummyHandler;
+    if (!dummyStorage)
+        dummyStorage = std::make_shared<AsyncDummyStorage>(engine);
+    return *dummyStorage;
 }
 
 AsyncStorage& AsyncStorageImpl::getOperationHandler(const std::string& ns)
@@ -172,6 +307,30 @@ AsyncStorage& AsyncStorageImpl::getOperationHandler(const std::string& ns)
     return getDummyHandler();
 }
 
+std::string AsyncStorageImpl::getConnection(const std::string& ns)
+{
+    if (!namespaceConfigurations->isDbBackendUseEnabled(ns) || asyncStorages.empty())
+        return "none";
+    std::string connection;
+    for (const auto& host : asyncStorages.at(getAsyncRedisStorageHandlerIndex(ns))->getDatabaseInfo().hosts)
+        connection += (connection.empty() ? "" : ",") + host.getString();
+    return connection;
+}
+
+bool AsyncStorageImpl::isMeasured(const Namespace& ns) const
+{
+    /* Operations with an invalid namespace fail without reaching the backend, thus they
+     * are not measured, and they cannot add namespaces to the statistics. The operation
+     * probes are fired by the measurements, thus with probes compiled in every operation
+     * is measured, but it is counted only if statistics are enabled.
+     */
+#if HAVE_SDT_PROBES
+    return isValidNamespace(ns);
+#else
+    return statisticsCollector.isEnabled() && isValidNamespace(ns);
+#endif
+}
+
 int AsyncStorageImpl::fd() const
 {
     return engine->fd();
@@ -192,7 +351,14 @@ void AsyncStorageImpl::setAsync(const Namespace& ns,
                                 const DataMap& dataMap,
                                 const ModifyAck& modifyAck)
 {
-    getOperationHandler(ns).setAsync(ns, dataMap, modifyAck);
+    auto& handler(getOperationHandler(ns));
+    if (!isMeasured(ns))
+    {
+        handler.setAsync(ns, dataMap, modifyAck);
+        return;
+    }
+    const auto measurement(statisticsCollector.start(ns, Statistics::OperationType::SET, dataMap.size(), getSize(dataMap)));
+    handler.setAsync(ns, dataMap, measured(measurement, modifyAck));
 }
 
 void AsyncStorageImpl::setIfAsync(const Namespace& ns,
@@ -201,7 +367,14 @@ void AsyncStorageImpl::setIfAsync(const Namespace& ns,
                                   const Data& newData,
                                   const ModifyIfAck& modifyIfAck)
 {
-    getOperationHandler(ns).setIfAsync(ns, key, oldData, newData, modifyIfAck);
+    auto& handler(getOperationHandler(ns));
+    if (!isMeasured(ns))
+    {
+        handler.setIfAsync(ns, key, oldData, newData, modifyIfAck);
+        return;
+    }
+    const auto measurement(statisticsCollector.start(ns, Statistics::OperationType::SET_IF, 1, key.size() + oldData.size() + newData.size()));
+    handler.setIfAsync(ns, key, oldData, newData, measured(measurement, modifyIfAck));
 }
 
 void AsyncStorageImpl::removeIfAsync(const Namespace& ns,
@@ -209,7 +382,14 @@ void AsyncStorageImpl::removeIfAsync(const Namespace& ns,
                                      const Data& data,
                                      const ModifyIfAck& modifyIfAck)
 {
-    getOperationHandler(ns).removeIfAsync(ns, key, data, modifyIfAck);
+    auto& handler(getOperationHandler(ns));
+    if (!isMeasured(ns))
+    {
+        handler.removeIfAsync(ns, key, data, modifyIfAck);
+        return;
+    }
+    const auto measurement(statisticsCollector.start(ns, Statistics::OperationType::REMOVE_IF, 1, key.size() + data.size()));
+    handler.removeIfAsync(ns, key, data, measured(measurement, modifyIfAck));
 }
 
 void AsyncStorageImpl::setIfNotExistsAsync(const Namespace& ns,
@@ -217,39 +397,314 @@ void AsyncStorageImpl::setIfNotExistsAsync(const Namespace& ns,
                                            const Data& data,
                                            const ModifyIfAck& modifyIfAck)
 {
-    getOperationHandler(ns).setIfNotExistsAsync(ns, key, data, modifyIfAck);
+    auto& handler(getOperationHandler(ns));
+    if (!isMeasured(ns))
+    {
+        handler.setIfNotExistsAsync(ns, key, data, modifyIfAck);
+        return;
+    }
+    const auto measurement(statisticsCollector.start(ns, Statistics::OperationType::SET_IF_NOT_EXISTS, 1, key.size() + data.size()));
+    handler.setIfNotExistsAsync(ns, key, data, measured(measurement, modifyIfAck));
 }
 
 void AsyncStorageImpl::getAsync(const Namespace& ns,
                                 const Keys& keys,
                                 const GetAck& getAck)
 {
-    getOperationHandler(ns).getAsync(ns, keys, getAck);
+    auto& handler(getOperationHandler(ns));
+    if (!isMeasured(ns))
+    {
+        handler.getAsync(ns, keys, getAck);
+        return;
+    }
+    const auto measurement(statisticsCollector.start(ns, Statistics::OperationType::GET, keys.size(), getSize(keys)));
+    handler.getAsync(ns, keys, measured(measurement, getAck));
+}
+
+void AsyncStorageImpl::getViewsAsync(const Namespace& ns,
+                                     const Keys& keys,
+                                     const GetViewsAck& getViewsAck)
+{
+    auto& handler(getOperationHandler(ns));
+    if (!isMeasured(ns))
+    {
+        handler.getViewsAsync(ns, keys, getViewsAck);
+        return;
+    }
+    const auto measurement(statisticsCollector.start(ns, Statistics::OperationType::GET, keys.size(), getSize(keys)));
+    handler.getViewsAsync(ns, keys, measured(measurement, getViewsAck));
+}
+
+void AsyncStorageImpl::getViewsAsync(const Namespace& ns,
+                                     const Keys& keys,
+                                     const DataVisitor& dataVisitor,
+                                     const GetVisitAck& getVisitAck)
+{
+    auto& handler(getOperationHandler(ns));
+    if (!isMeasured(ns))
+    {
+        handler.getViewsAsync(ns, keys, dataVisitor, getVisitAck);
+        return;
+    }
+    const auto measurement(statisticsCollector.start(ns, Statistics::OperationType::GET, keys.size(), getSize(keys)));
+    const auto bytesReceived(std::make_shared<std::uint64_t>(0));
+    handler.getViewsAsync(ns,
+                          keys,
+                          [bytesReceived, dataVisitor](const Key& key, const DataView& data)
+                          {
+                              *bytesReceived += key.size() + data.size;
+                              dataVisitor(key, data);
+                          },
+                          [measurement, bytesReceived, getVisitAck](const std::error_code& error)
+                          {
+                              measurement.done(error, *bytesReceived);
+                              getVisitAck(error);
+                          });
 }
 
 void AsyncStorageImpl::removeAsync(const Namespace& ns,
                                    const Keys& keys,
                                    const ModifyAck& modifyAck)
 {
-    getOperationHandler(ns).removeAsync(ns, keys, modifyAck);
+    auto& handler(getOperationHandler(ns));
+    if (!isMeasured(ns))
+    {
+        handler.removeAsync(ns, keys, modifyAck);
+        return;
+    }
+    const auto measurement(statisticsCollector.start(ns, Statistics::OperationType::REMOVE, keys.size(), getSize(keys)));
+    handler.removeAsync(ns, keys, measured(measurement, modifyAck));
 }
 
 void AsyncStorageImpl::findKeysAsync(const Namespace& ns,
                                      const std::string& keyPrefix,
                                      const FindKeysAck& findKeysAck)
 {
-    getOperationHandler(ns).findKeysAsync(ns, keyPrefix, findKeysAck);
+    auto& handler(getOperationHandler(ns));
+    if (!isMeasured(ns))
+    {
+        handler.findKeysAsync(ns, keyPrefix, findKeysAck);
+        return;
+    }
+    const auto measurement(statisticsCollector.start(ns, Statistics::OperationType::FIND_KEYS, 0, keyPrefix.size()));
+    handler.findKeysAsync(ns, keyPrefix, measured(measurement, findKeysAck));
 }
 
 void AsyncStorageImpl::listKeys(const Namespace& ns,
                                 const std::string& pattern,
                                 const FindKeysAck& findKeysAck)
 {
-    getOperationHandler(ns).listKeys(ns, pattern, findKeysAck);
+    auto& handler(getOperationHandler(ns));
+    if (!isMeasured(ns))
+    {
+        handler.listKeys(ns, pattern, findKeysAck);
+        return;
+    }
+    const auto measurement(statisticsCollector.start(ns, Statistics::OperationType::LIST_KEYS, 0, pattern.size()));
+    handler.listKeys(ns, pattern, measured(measurement, findKeysAck));
+}
+
+void AsyncStorageImpl::scanKeysAsync(const Namespace& ns,
+                                     const std::string& pattern,
+                                     std::size_t countHint,
+                                     const ScanKeysAck& scanKeysAck)
+{
+    auto& handler(getOperationHandler(ns));
+    if (!isMeasured(ns))
+    {
+        handler.scanKeysAsync(ns, pattern, countHint, scanKeysAck);
+        return;
+    }
+    const auto measurement(statisticsCollector.start(ns, Statistics::OperationType::SCAN_KEYS, 0, pattern.size()));
+    handler.scanKeysAsync(ns, pattern, countHint, measured(measurement, scanKeysAck));
 }
 
 void AsyncStorageImpl::removeAllAsync(const Namespace& ns,
                                        const ModifyAck& modifyAck)
 {
-    getOperationHandler(ns).removeAllAsync(ns, modifyAck);
+    auto& handler(getOperationHandler(ns));
+    if (!isMeasured(ns))
+    {
+        handler.removeAllAsync(ns, modifyAck);
+        return;
+    }
+    const auto measurement(statisticsCollector.start(ns, Statistics::OperationType::REMOVE_ALL, 0, 0));
+    handler.removeAllAsync(ns, measured(measurement, modifyAck));
+}
+
+void AsyncStorageImpl::removeByPrefixAsync(const Namespace& ns,
+                                           const std::string& keyPrefix,
+                                           const ModifyAck& modifyAck)
+{
+    auto& handler(getOperationHandler(ns));
+    if (!isMeasured(ns))
+    {
+        handler.removeByPrefixAsync(ns, keyPrefix, modifyAck);
+        return;
+    }
+    const auto measurement(statisticsCollector.start(ns, Statistics::OperationType::REMOVE_BY_PREFIX, 0, keyPrefix.size()));
+    handler.removeByPrefixAsync(ns, keyPrefix, measured(measurement, modifyAck));
+}
+
+void AsyncStorageImpl::subscribeChannelAsync(const Namespace& ns,
+                                             const Channels& channels,
+                                             const NotificationCb& notificationCb,
+                                             const ModifyAck& subscribeAck)
+{
+    getOperationHandler(ns).subscribeChannelAsync(ns, channels, notificationCb, subscribeAck);
+}
+
+void AsyncStorageImpl::unsubscribeChannelAsync(const Namespace& ns,
+                                               const Channels& channels,
+                                               const ModifyAck& unsubscribeAck)
+{
+    getOperationHandler(ns).unsubscribeChannelAsync(ns, channels, unsubscribeAck);
+}
+
+void AsyncStorageImpl::publishAsync(const Namespace& ns,
+                                    const Channel& channel,
+                                    const std::string& message,
+                                    const ModifyAck& modifyAck)
+{
+    auto& handler(getOperationHandler(ns));
+    if (!isMeasured(ns))
+    {
+        handler.publishAsync(ns, channel, message, modifyAck);
+        return;
+    }
+    const auto measurement(statisticsCollector.start(ns, Statistics::OperationType::PUBLISH, 0, channel.size() + message.size()));
+    handler.publishAsync(ns, channel, message, measured(measurement, modifyAck));
+}
+
+void AsyncStorageImpl::getBatchAsync(const NamespaceKeys& namespaceKeys,
+                                     const GetBatchAck& batchAck)
+{
+    /* Batch is counted as one operation of each of its namespaces. */
+    std::vector<std::pair<Namespace, Measurement>> measurements;
+    for (const auto& i : namespaceKeys)
+        if (isMeasured(i.first))
+            measurements.emplace_back(i.first, statisticsCollector.start(i.first, Statistics::OperationType::GET_BATCH, i.second.size(), getSize(i.second)));
+    GetBatchAck getBatchAck(batchAck);
+    if (!measurements.empty())
+        getBatchAck = [measurements, batchAck](const std::error_code& error,
+                                               const NamespaceDataMaps& namespaceDataMaps)
+                      {
+                          for (const auto& measurement : measurements)
+                          {
+                              const auto i(namespaceDataMaps.find(measurement.first));
+                              measurement.second.done(error, i == namespaceDataMaps.end() ? 0 : getSize(i->second));
+                          }
+                          batchAck(error, namespaceDataMaps);
+                      };
+
+    /* Namespaces served by the same handler are given to it as one batch. */
+    std::map<AsyncStorage*, NamespaceKeys> batches;
+    for (const auto& i : namespaceKeys)
+        batches[&getOperationHandler(i.first)].insert(i);
+
+    if (batches.empty())
+    {
+        engine->postCallback(std::bind(getBatchAck, std::error_code(), NamespaceDataMaps()));
+        return;
+    }
+    if (batches.size() == 1)
+    {
+        batches.begin()->first->getBatchAsync(namespaceKeys, getBatchAck);
+        return;
+    }
+
+    struct Result
+    {
+        std::size_t pending;
+        std::error_code error;
+        NamespaceDataMaps namespaceDataMaps;
+    };
+    const auto result(std::make_shared<Result>(Result { batches.size(), std::error_code(), NamespaceDataMaps() }));
+    for (const auto& batch : batches)
+        batch.first->getBatchAsync(batch.second,
+                                   [result, getBatchAck](const std::error_code& error,
+                                                         const NamespaceDataMaps& namespaceDataMaps)
+                                   {
+                                       if (error && !result->error)
+                                           result->error = error;
+                                       if (!error)
+                                           result->namespaceDataMaps.insert(namespaceDataMaps.begin(), namespaceDataMaps.end());
+                                       if (--result->pending == 0)
+                                           getBatchAck(result->error,
+                                                       result->error ? NamespaceDataMaps() : result->namespaceDataMaps);
+                                   });
+}
+
+void AsyncStorageImpl::setBatchAsync(const NamespaceDataMaps& namespaceDataMaps,
+                                     const ModifyAck& batchAck)
+{
+    std::vector<Measurement> measurements;
+    for (const auto& i : namespaceDataMaps)
+        if (isMeasured(i.first))
+            measurements.push_back(statisticsCollector.start(i.first, Statistics::OperationType::SET_BATCH, i.second.size(), getSize(i.second)));
+    ModifyAck modifyAck(batchAck);
+    if (!measurements.empty())
+        modifyAck = [measurements, batchAck](const std::error_code& error)
+                    {
+                        for (const auto& measurement : measurements)
+                            measurement.done(error);
+                        batchAck(error);
+                    };
+
+    std::map<AsyncStorage*, NamespaceDataMaps> batches;
+    for (const auto& i : namespaceDataMaps)
+        batches[&getOperationHandler(i.first)].insert(i);
+
+    if (batches.empty())
+    {
+        engine->postCallback(std::bind(modifyAck, std::error_code()));
+        return;
+    }
+    if (batches.size() == 1)
+    {
+        batches.begin()->first->setBatchAsync(namespaceDataMaps, modifyAck);
+        return;
+    }
+
+    struct Result
+    {
+        std::size_t pending;
+        std::error_code error;
+    };
+    const auto result(std::make_shared<Result>(Result { batches.size(), std::error_code() }));
+    for (const auto& batch : batches)
+        batch.first->setBatchAsync(batch.second,
+                                   [result, modifyAck](const std::error_code& error)
+                                   {
+                                       if (error && !result->error)
+                                           result->error = error;
+                                       if (--result->pending == 0)
+                                           modifyAck(result->error);
+                                   });
+}
+
+void AsyncStorageImpl::writeBatchAsync(const Namespace& ns,
+                                       const WriteBatch& writeBatch,
+                                       const WriteBatchAck& writeBatchAck)
+{
+    auto& handler(getOperationHandler(ns));
+    if (!isMeasured(ns))
+    {
+        handler.writeBatchAsync(ns, writeBatch, writeBatchAck);
+        return;
+    }
+    const auto measurement(statisticsCollector.start(ns, Statistics::OperationType::WRITE_BATCH, getKeyCount(writeBatch), getSize(writeBatch)));
+    handler.writeBatchAsync(ns, writeBatch, measured(measurement, writeBatchAck));
+}
+
+void AsyncStorageImpl::getStatisticsAsync(const GetStatisticsAck& getStatisticsAck)
+{
+    engine->postCallback(std::bind(getStatisticsAck, statisticsCollector.getStatistics()));
+}
+
+void AsyncStorageImpl::setOperationTimeout(const std::chrono::steady_clock::duration& timeout)
+{
+    operationTimeout = timeout;
+    for (auto& asyncStorage : asyncStorages)
+        asyncStorage->setOperationTimeout(timeout);
 }
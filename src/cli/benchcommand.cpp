@@ -0,0 +1,636 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <poll.h>
+#include <unistd.h>
+#include "private/cli/commandmap.hpp"
+#include "private/configurationreader.hpp"
+#include <sdl/asyncstorage.hpp>
+#include <sdl/exception.hpp>
+
+using namespace shareddatalayer;
+using namespace shareddatalayer::cli;
+
+namespace
+{
+    /*
+     * Latency histogram with logarithmic buckets. Each power of two is split into
+     * SUB_BUCKETS linear buckets, so a reported value is at most 1/SUB_BUCKETS
+     * larger than the real one.
+     */
+    class LatencyHistogram
+    {
+    public:
+        LatencyHistogram(): counts(bucketIndex(UINT64_MAX) + 1, 0), count(0), max(0) { }
+
+        void record(std::uint64_t value)
+        {
+            ++counts[bucketIndex(value)];
+            ++count;
+            max = std::max(max, value);
+        }
+
+        void merge(const LatencyHistogram& other)
+        {
+            for (std::size_t i(0); i < counts.size(); ++i)
+                counts[i] += other.counts[i];
+            count += other.count;
+            max = std::max(max, other.max);
+        }
+
+        std::uint64_t getCount() const { return count; }
+
+        std::uint64_t getMax() const { return max; }
+
+        std::uint64_t getPercentile(double percentile) const
+        {
+            if (!count)
+                return 0;
+            const auto target(std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(percentile / 100.0 * count))));
+            std::uint64_t cumulative(0);
+            for (std::size_t i(0); i < counts.size(); ++i)
+            {
+                cumulative += counts[i];
+                if (cumulative >= target)
+                    return std::min(bucketUpperBound(i), max);
+            }
+            return max;
+        }
+
+    private:
+        static constexpr unsigned SUB_BUCKET_BITS = 5;
+        static constexpr std::uint64_t SUB_BUCKETS = 1U << SUB_BUCKET_BITS;
+
+        std::vector<std::uint64_t> counts;
+        std::uint64_t count;
+        std::uint64_t max;
+
+        static std::size_t bucketIndex(std::uint64_t value)
+        {
+            if (value < SUB_BUCKETS)
+                return value;
+            const unsigned shift(63 - __builtin_clzll(value) - SUB_BUCKET_BITS);
+            return ((shift + 1) << SUB_BUCKET_BITS) + ((value >> shift) - SUB_BUCKETS);
+        }
+
+        static std::uint64_t bucketUpperBound(std::size_t index)
+        {
+            if (index < SUB_BUCKETS)
+                return index;
+            const unsigned shift((index >> SUB_BUCKET_BITS) - 1);
+            const std::uint64_t lower((SUB_BUCKETS + (index & (SUB_BUCKETS - 1))) << shift);
+            return lower + ((std::uint64_t(1) << shift) - 1);
+        }
+    };
+
+    struct Options
+    {
+        std::vector<AsyncStorage::Namespace> namespaces;
+        std::vector<AsyncStorage::Key> keys;
+        std::size_t minValueSize;
+        std::size_t maxValueSize;
+        unsigned readPercentage;
+        std::size_t clients;
+        std::size_t pipeline;
+        std::chrono::seconds duration;
+        std::uint64_t requests;
+        std::chrono::seconds timeout;
+    };
+
+    bool parseValueSize(const std::string& str, Options& options)
+    {
+        std::istringstream is(str);
+        if (!(is >> options.minValueSize))
+            return false;
+        options.maxValueSize = options.minValueSize;
+        char separator;
+        if (is >> separator && (separator != '-' || !(is >> options.maxValueSize)))
+            return false;
+        return is.eof() && options.minValueSize <= options.maxValueSize;
+    }
+
+    /* Lets all clients start the measurement at the same time, once all of them are ready. */
+    class StartGate
+    {
+    public:
+        StartGate(std::size_t clients, const std::chrono::seconds& duration):
+            waiting(clients),
+            duration(duration),
+            failed(false)
+        {
+        }
+
+        bool arriveAndWait(bool ready)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!ready)
+                failed = true;
+            if (--waiting == 0)
+            {
+                start = std::chrono::steady_clock::now();
+                if (duration.count())
+                    deadline = start + duration;
+                else
+                    deadline = std::chrono::steady_clock::time_point::max();
+                cv.notify_all();
+            }
+            else
+                cv.wait(lock, [this]() { return waiting == 0; });
+            return !failed;
+        }
+
+        std::chrono::steady_clock::time_point getStart() const { return start; }
+
+        std::chrono::steady_clock::time_point getDeadline() const { return deadline; }
+
+    private:
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::size_t waiting;
+        const std::chrono::seconds duration;
+        bool failed;
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    /*
+     * One client has its own AsyncStorage instance (and thus its own database connections)
+     * and is driven by its own thread. It keeps up to 'pipeline' operations in flight.
+     */
+    class Client
+    {
+    public:
+        Client(const Options& options, const AsyncStorage::Data& payload, std::size_t id, std::uint64_t requests):
+            options(options),
+            payload(payload),
+            requests(requests),
+            random(id + 1),
+            notReady(0),
+            inFlight(0),
+            issued(0),
+            prefillCursor(id)
+        {
+        }
+
+        bool connect()
+        {
+            try
+            {
+                storage = AsyncStorage::create();
+            }
+            catch (const shareddatalayer::Exception& error)
+            {
+                failure = std::string("AsyncStorage create failed: ") + error.what();
+                return false;
+            }
+            storage->setOperationTimeout(std::chrono::seconds(5));
+
+            notReady = options.namespaces.size();
+            for (const auto& ns : options.namespaces)
+                storage->waitReadyAsync(ns, [this, ns](const std::error_code& error)
+                                        {
+                                            if (error && failure.empty())
+                                                failure = "waitReadyAsync(" + ns + ") failed: " + error.message();
+                                            --notReady;
+                                        });
+            auto readyDeadline(std::chrono::steady_clock::time_point::max());
+            if (options.timeout.count())
+                readyDeadline = std::chrono::steady_clock::now() + options.timeout;
+            if (!runEventLoop([this]() { return notReady == 0; }, readyDeadline))
+                failure = "Storage not ready in " + std::to_string(options.timeout.count()) + " seconds";
+            return failure.empty();
+        }
+
+        bool prepare()
+        {
+            /* The first client is connected already for checking the namespaces. */
+            if (!storage && !connect())
+                return false;
+            for (std::size_t i(0); i < options.pipeline; ++i)
+                prefillNext();
+            runEventLoop([this]() { return inFlight == 0; });
+            return true;
+        }
+
+        std::vector<AsyncStorage::Namespace> findNonEmptyNamespaces()
+        {
+            std::vector<AsyncStorage::Namespace> nonEmpty;
+            std::size_t pending(options.namespaces.size());
+            for (const auto& ns : options.namespaces)
+                storage->scanKeysAsync(ns, "*", 0, [this, &nonEmpty, &pending, ns](const std::error_code& error,
+                                                                                   const AsyncStorage::Keys& keys,
+                                                                                   const AsyncStorage::ScanKeysNext& next)
+                                       {
+                                           if (error && failure.empty())
+                                               failure = "scanKeysAsync(" + ns + ") failed: " + error.message();
+                                           if (!keys.empty())
+                                               nonEmpty.push_back(ns);
+                                           else if (next)
+                                           {
+                                               next();
+                                               return;
+                                           }
+                                           --pending;
+                                       });
+            runEventLoop([&pending]() { return pending == 0; });
+            return nonEmpty;
+        }
+
+        void run(const std::chrono::steady_clock::time_point& runDeadline)
+        {
+            deadline = runDeadline;
+            for (std::size_t i(0); i < options.pipeline; ++i)
+                issueNext();
+            runEventLoop([this]() { return inFlight == 0; });
+        }
+
+        void removeKeys(const std::map<AsyncStorage::Namespace, AsyncStorage::Keys>& keys)
+        {
+            std::size_t pending(keys.size());
+            for (const auto& i : keys)
+            {
+                const auto& ns(i.first);
+                storage->removeAsync(ns, i.second, [this, &pending, ns](const std::error_code& error)
+                                     {
+                                         if (error)
+                                             ++errors["removeAsync(" + ns + "): " + error.message()];
+                                         --pending;
+                                     });
+            }
+            runEventLoop([&pending]() { return pending == 0; });
+        }
+
+        Statistics::SlowOperations getSlowOperations()
+        {
+            Statistics::SlowOperations slowOperations;
+            bool done(false);
+            storage->getStatisticsAsync([&slowOperations, &done](const Statistics& statistics)
+                                        {
+                                            slowOperations = statistics.getSlowOperations();
+                                            done = true;
+                                        });
+            runEventLoop([&done]() { return done; });
+            return slowOperations;
+        }
+
+        const std::string& getFailure() const { return failure; }
+
+        LatencyHistogram reads;
+        LatencyHistogram writes;
+        std::map<std::string, std::uint64_t> errors;
+        std::map<AsyncStorage::Namespace, AsyncStorage::Keys> writtenKeys;
+
+    private:
+        const Options& options;
+        const AsyncStorage::Data& payload;
+        const std::uint64_t requests;
+        std::mt19937_64 random;
+        std::unique_ptr<AsyncStorage> storage;
+        std::string failure;
+        std::size_t notReady;
+        std::size_t inFlight;
+        std::uint64_t issued;
+        std::size_t prefillCursor;
+        std::chrono::steady_clock::time_point deadline;
+
+        bool runEventLoop(const std::function<bool()>& done,
+                          const std::chrono::steady_clock::time_point& loopDeadline = std::chrono::steady_clock::time_point::max())
+        {
+            struct pollfd pfd = { storage->fd(), POLLIN, 0 };
+            while (!done())
+            {
+                if (std::chrono::steady_clock::now() >= loopDeadline)
+                    return false;
+                if (::poll(&pfd, 1, 100) > 0)
+                    storage->handleEvents();
+            }
+            return true;
+        }
+
+        AsyncStorage::Data buildValue()
+        {
+            std::uniform_int_distribution<std::size_t> size(options.minValueSize, options.maxValueSize);
+            return AsyncStorage::Data(payload.begin(), payload.begin() + size(random));
+        }
+
+        void prefillNext()
+        {
+            const auto total(options.namespaces.size() * options.keys.size());
+            if (prefillCursor >= total)
+                return;
+            const auto& ns(options.namespaces[prefillCursor / options.keys.size()]);
+            const auto& key(options.keys[prefillCursor % options.keys.size()]);
+            prefillCursor += options.clients;
+            writtenKeys[ns].insert(key);
+            ++inFlight;
+            storage->setAsync(ns, { { key, buildValue() } }, [this](const std::error_code& error)
+                              {
+                                  if (error)
+                                      ++errors["prefill setAsync: " + error.message()];
+                                  --inFlight;
+                                  prefillNext();
+                              });
+        }
+
+        void issueNext()
+        {
+            if ((requests && issued >= requests) || std::chrono::steady_clock::now() >= deadline)
+                return;
+            ++issued;
+            ++inFlight;
+            std::uniform_int_distribution<std::size_t> nsIndex(0, options.namespaces.size() - 1);
+            std::uniform_int_distribution<std::size_t> keyIndex(0, options.keys.size() - 1);
+            std::uniform_int_distribution<unsigned> percentage(0, 99);
+            const auto& ns(options.namespaces[nsIndex(random)]);
+            const auto& key(options.keys[keyIndex(random)]);
+            const bool read(percentage(random) < options.readPercentage);
+            if (!read)
+                writtenKeys[ns].insert(key);
+            const auto start(std::chrono::steady_clock::now());
+            if (read)
+                storage->getAsync(ns, { key }, [this, start](const std::error_code& error, const AsyncStorage::DataMap&)
+                                  {
+                                      completed(reads, start, "getAsync", error);
+                                  });
+            else
+                storage->setAsync(ns, { { key, buildValue() } }, [this, start](const std::error_code& error)
+                                  {
+                                      completed(writes, start, "setAsync", error);
+                                  });
+        }
+
+        void completed(LatencyHistogram& histogram,
+                       const std::chrono::steady_clock::time_point& start,
+                       const char* operation,
+                       const std::error_code& error)
+        {
+            const auto latency(std::chrono::steady_clock::now() - start);
+            if (error)
+                ++errors[std::string(operation) + ": " + error.message()];
+            else
+                histogram.record(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+            --inFlight;
+            issueNext();
+        }
+    };
+
+    void printLatencies(std::ostream& out, const std::string& name, const LatencyHistogram& histogram)
+    {
+        out << std::left << std::setw(8) << name << std::right
+            << std::setw(12) << histogram.getCount()
+            << std::setw(10) << histogram.getPercentile(50.0)
+            << std::setw(10) << histogram.getPercentile(99.0)
+            << std::setw(10) << histogram.getPercentile(99.9)
+            << std::setw(10) << histogram.getMax() << std::endl;
+    }
+
+    void printSlowOperations(std::ostream& out, Statistics::SlowOperations& slowOperations)
+    {
+        std::sort(slowOperations.begin(), slowOperations.end(),
+                  [](const Statistics::SlowOperation& a, const Statistics::SlowOperation& b) { return a.time < b.time; });
+        out << std::endl << "Slow operations: " << slowOperations.size() << std::endl;
+        for (const auto& slowOperation : slowOperations)
+        {
+            const auto time(std::chrono::system_clock::to_time_t(slowOperation.time));
+            const auto milliseconds(std::chrono::duration_cast<std::chrono::milliseconds>(
+                slowOperation.time.time_since_epoch()).count() % 1000);
+            std::tm tm;
+            localtime_r(&time, &tm);
+            out << std::put_time(&tm, "%F %T") << "." << std::setw(3) << std::setfill('0') << milliseconds
+                << std::setfill(' ')
+                << " namespace: " << slowOperation.ns
+                << ", operation: " << Statistics::getOperationName(slowOperation.type)
+                << ", keys: " << slowOperation.keyCount
+                << ", bytes: " << slowOperation.bytes
+                << ", connection: " << slowOperation.connection
+                << ", latency: " << std::chrono::duration_cast<std::chrono::microseconds>(slowOperation.latency).count()
+                << " us" << std::endl;
+        }
+    }
+
+    int benchCommand(std::ostream& out, const boost::program_options::variables_map& map)
+    {
+        Options options;
+        auto ns(map["ns"].as<std::string>());
+        if (ns.empty())
+            ns = "sdltoolbench_" + std::to_string(getpid()) + "_" + std::to_string(std::time(nullptr));
+        const auto nsCount(map["ns-count"].as<int>());
+        const auto keyCount(map["key-count"].as<int>());
+        const auto reads(map["reads"].as<int>());
+        const auto clients(map["clients"].as<int>());
+        const auto pipeline(map["pipeline"].as<int>());
+        const auto duration(map["duration"].as<int>());
+        const auto requests(map["requests"].as<int>());
+        const auto timeout(map["timeout"].as<int>());
+        const auto slowThreshold(map["slow-threshold"].as<int>());
+        if (nsCount < 1 || keyCount < 1 || clients < 1 || pipeline < 1 || reads < 0 || reads > 100
+            || duration < 0 || requests < 0 || timeout < 0 || slowThreshold < 0 || (!duration && !requests))
+        {
+            out << "Invalid arguments, see 'sdltool bench --help'" << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (!parseValueSize(map["value-size"].as<std::string>(), options))
+        {
+            out << "Invalid value size: " << map["value-size"].as<std::string>() << std::endl;
+            return EXIT_FAILURE;
+        }
+        for (int i(0); i < nsCount; ++i)
+            options.namespaces.push_back(nsCount == 1 ? ns : ns + "_" + std::to_string(i));
+        for (int i(0); i < keyCount; ++i)
+            options.keys.push_back("key_" + std::to_string(i));
+        options.readPercentage = static_cast<unsigned>(reads);
+        options.clients = static_cast<std::size_t>(clients);
+        options.pipeline = static_cast<std::size_t>(pipeline);
+        options.duration = std::chrono::seconds(requests ? 0 : duration);
+        options.requests = static_cast<std::uint64_t>(requests);
+        options.timeout = std::chrono::seconds(timeout);
+
+        AsyncStorage::Data payload(options.maxValueSize);
+        std::mt19937 random;
+        std::generate(payload.begin(), payload.end(), [&random]() { return static_cast<uint8_t>(random()); });
+
+        out << "Benchmarking " << clients << " client(s) with pipeline depth " << pipeline << ", "
+            << keyCount << " key(s) in " << nsCount << " namespace(s), value size " << options.minValueSize;
+        if (options.maxValueSize != options.minValueSize)
+            out << "-" << options.maxValueSize;
+        out << " bytes, " << reads << "% reads, namespace " << ns << std::endl;
+
+        if (slowThreshold)
+            setenv(SLOW_OPERATION_THRESHOLD_ENV_VAR_NAME, std::to_string(slowThreshold).c_str(), 1);
+
+        std::vector<std::unique_ptr<Client>> clientList;
+        for (std::size_t i(0); i < options.clients; ++i)
+        {
+            auto share(options.requests / options.clients + (i < options.requests % options.clients ? 1 : 0));
+            clientList.emplace_back(new Client(options, payload, i, share));
+        }
+
+        auto& firstClient(*clientList.front());
+        if (!firstClient.connect())
+        {
+            out << firstClient.getFailure() << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (!map["force"].as<bool>())
+        {
+            const auto nonEmpty(firstClient.findNonEmptyNamespaces());
+            if (!firstClient.getFailure().empty())
+            {
+                out << firstClient.getFailure() << std::endl;
+                return EXIT_FAILURE;
+            }
+            if (!nonEmpty.empty())
+            {
+                out << "Namespace " << nonEmpty.front() << " is not empty, use --force to benchmark with it anyway" << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+
+        StartGate gate(options.clients, options.duration);
+        std::vector<std::thread> threads;
+        for (auto& client : clientList)
+            threads.emplace_back([&gate, &client]()
+                                 {
+                                     if (gate.arriveAndWait(client->prepare()))
+                                         client->run(gate.getDeadline());
+                                 });
+        for (auto& thread : threads)
+            thread.join();
+        const auto elapsed(std::chrono::duration<double>(std::chrono::steady_clock::now() - gate.getStart()).count());
+
+        bool failed(false);
+        for (const auto& client : clientList)
+            if (!client->getFailure().empty())
+            {
+                out << client->getFailure() << std::endl;
+                failed = true;
+            }
+        if (failed)
+            return EXIT_FAILURE;
+
+        if (!map["keep-keys"].as<bool>())
+        {
+            std::map<AsyncStorage::Namespace, AsyncStorage::Keys> writtenKeys;
+            for (const auto& client : clientList)
+                for (const auto& i : client->writtenKeys)
+                    writtenKeys[i.first].insert(i.second.begin(), i.second.end());
+            firstClient.removeKeys(writtenKeys);
+        }
+
+        LatencyHistogram readLatencies;
+        LatencyHistogram writeLatencies;
+        std::map<std::string, std::uint64_t> errors;
+        std::uint64_t errorCount(0);
+        for (const auto& client : clientList)
+        {
+            readLatencies.merge(client->reads);
+            writeLatencies.merge(client->writes);
+            for (const auto& error : client->errors)
+            {
+                errors[error.first] += error.second;
+                errorCount += error.second;
+            }
+        }
+        LatencyHistogram allLatencies;
+        allLatencies.merge(readLatencies);
+        allLatencies.merge(writeLatencies);
+
+        const auto operations(allLatencies.getCount());
+        out << std::fixed << std::setprecision(2)
+            << "Completed " << operations << " operation(s) in " << elapsed << " seconds, "
+            << errorCount << " error(s)" << std::endl
+            << "Throughput: " << (elapsed > 0.0 ? operations / elapsed : 0.0) << " operations/s" << std::endl
+            << std::endl
+            << std::left << std::setw(8) << "latency" << std::right
+            << std::setw(12) << "count"
+            << std::setw(10) << "p50(us)"
+            << std::setw(10) << "p99(us)"
+            << std::setw(10) << "p99.9(us)"
+            << std::setw(10) << "max(us)" << std::endl;
+        printLatencies(out, "read", readLatencies);
+        printLatencies(out, "write", writeLatencies);
+        printLatencies(out, "all", allLatencies);
+        for (const auto& error : errors)
+            out << error.second << " x " << error.first << std::endl;
+
+        Statistics::SlowOperations slowOperations;
+        for (const auto& client : clientList)
+        {
+            const auto clientSlowOperations(client->getSlowOperations());
+            slowOperations.insert(slowOperations.end(), clientSlowOperations.begin(), clientSlowOperations.end());
+        }
+        if (!slowOperations.empty())
+            printSlowOperations(out, slowOperations);
+
+        return errorCount ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+}
+
+const char *longHelpBenchCmd =
+    "Generate load with AsyncStorage API and report throughput and latency percentiles.\n\n"
+    "Every client has its own storage instance, database connections and thread and keeps\n"
+    "up to pipeline depth operations in flight. Operations read or write one randomly chosen\n"
+    "key of a randomly chosen namespace. All keys are written once before the measurement\n"
+    "and the written keys are removed after it, unless --keep-keys is given.\n\n"
+    "By default a new namespace is generated for every run. A namespace given with --ns\n"
+    "must not contain any keys, unless --force is given.\n\n"
+    "With --slow-threshold every client records operations slower than the threshold and\n"
+    "the recorded slow operations are listed after the latencies. The threshold can also be\n"
+    "set with " SLOW_OPERATION_THRESHOLD_ENV_VAR_NAME " environment variable or SDL configuration.\n\n"
+    "Example: sdltool bench --clients 4 --pipeline 16 --value-size 100-1000 --reads 80 --duration 30";
+
+AUTO_REGISTER_COMMAND(std::bind(benchCommand, std::placeholders::_1, std::placeholders::_3),
+                      "bench",
+                      "Measure throughput and latency under concurrent load",
+                      longHelpBenchCmd,
+                      CommandMap::Category::UTIL,
+                      30060,
+                      ("ns", boost::program_options::value<std::string>()->default_value(""), "namespace to use, suffixed with an index if ns-count is more than one, Default is a generated namespace")
+                      ("ns-count", boost::program_options::value<int>()->default_value(1), "Number of namespaces")
+                      ("key-count", boost::program_options::value<int>()->default_value(10000), "Number of keys in every namespace")
+                      ("value-size", boost::program_options::value<std::string>()->default_value("100"), "Value size in bytes, either fixed (N) or uniformly distributed (MIN-MAX)")
+                      ("reads", boost::program_options::value<int>()->default_value(50), "Percentage of read operations")
+                      ("clients", boost::program_options::value<int>()->default_value(1), "Number of concurrent clients")
+                      ("pipeline", boost::program_options::value<int>()->default_value(1), "Number of operations in flight per client")
+                      ("duration", boost::program_options::value<int>()->default_value(10), "Measurement duration (in seconds)")
+                      ("requests", boost::program_options::value<int>()->default_value(0), "Total number of operations, overrides duration if given")
+                      ("timeout", boost::program_options::value<int>()->default_value(0), "Timeout (in seconds) for storage to become ready, Default is no timeout")
+                      ("slow-threshold", boost::program_options::value<int>()->default_value(0), "Record operations slower than this (in milliseconds), Default is no recording")
+                      ("keep-keys", boost::program_options::bool_switch()->default_value(false), "Do not remove the keys after the measurement")
+                      ("force", boost::program_options::bool_switch()->default_value(false), "Use the namespaces even if they already contain keys"));
@@ -106,9 +106,10 @@ namespace
             << "value\t"
             << "Write\tRead" << std::endl;
 
-        for (uint8_t val(0); 0 < keyCount--; ++val)
+        for (int i(0); i < keyCount; ++i)
         {
-            auto key("key_" + std::to_string(val));
+            auto key("key_" + std::to_string(i));
+            auto val(static_cast<uint8_t>(i));
 
             auto wStart(std::chrono::high_resolution_clock::now());
             execSet(std::ref(*sdl), ns, key, {val}, out);
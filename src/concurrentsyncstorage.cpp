@@ -0,0 +1,291 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <sys/poll.h>
+#include <sdl/rejectedbysdl.hpp>
+#include "private/concurrentsyncstorage.hpp"
+#include "private/system.hpp"
+#include "private/throwexceptionforerrorcode.hpp"
+
+using namespace shareddatalayer;
+
+ConcurrentSyncStorage::Completion::Completion():
+    done(false),
+    status(false)
+{
+}
+
+ConcurrentSyncStorage::ConcurrentSyncStorage(std::unique_ptr<AsyncStorage> asyncStorage):
+    ConcurrentSyncStorage(std::move(asyncStorage), System::getSystem())
+{
+}
+
+ConcurrentSyncStorage::ConcurrentSyncStorage(std::unique_ptr<AsyncStorage> pAsyncStorage,
+                                             System& system):
+    asyncStorage(std::move(pAsyncStorage)),
+    system(system),
+    polling(false),
+    operationTimeout(std::chrono::steady_clock::duration::zero())
+{
+}
+
+AsyncStorage::ModifyAck ConcurrentSyncStorage::modifyAck(const std::shared_ptr<Completion>& completion)
+{
+    return [completion] (const std::error_code& error)
+           {
+               completion->error = error;
+               completion->done = true;
+           };
+}
+
+AsyncStorage::ModifyIfAck ConcurrentSyncStorage::modifyIfAck(const std::shared_ptr<Completion>& completion)
+{
+    return [completion] (const std::error_code& error, bool status)
+           {
+               completion->error = error;
+               completion->status = status;
+               completion->done = true;
+           };
+}
+
+AsyncStorage::GetAck ConcurrentSyncStorage::getAck(const std::shared_ptr<Completion>& completion)
+{
+    return [completion] (const std::error_code& error, const DataMap& dataMap)
+           {
+               completion->error = error;
+               completion->dataMap = dataMap;
+               completion->done = true;
+           };
+}
+
+AsyncStorage::FindKeysAck ConcurrentSyncStorage::findKeysAck(const std::shared_ptr<Completion>& completion)
+{
+    return [completion] (const std::error_code& error, const Keys& keys)
+           {
+               completion->error = error;
+               completion->keys = keys;
+               completion->done = true;
+           };
+}
+
+AsyncStorage::WriteBatchAck ConcurrentSyncStorage::writeBatchAck(const std::shared_ptr<Completion>& completion)
+{
+    return [completion] (const std::error_code& error, const std::vector<bool>& statuses)
+           {
+               completion->error = error;
+               completion->statuses = statuses;
+               completion->done = true;
+           };
+}
+
+void ConcurrentSyncStorage::pollAndHandleEvents(std::unique_lock<std::mutex>& lock, int timeout_ms)
+{
+    struct pollfd events{ asyncStorage->fd(), POLLIN, 0 };
+    lock.unlock();
+    const auto ret(system.poll(&events, 1, timeout_ms));
+    lock.lock();
+    if (ret > 0 && (events.revents & POLLIN))
+        asyncStorage->handleEvents();
+}
+
+bool ConcurrentSyncStorage::waitForCompletion(std::unique_lock<std::mutex>& lock,
+                                              const Completion& completion,
+                                              const std::chrono::steady_clock::duration& timeout)
+{
+    const bool hasDeadline(timeout != std::chrono::steady_clock::duration::zero());
+    const auto deadline(std::chrono::steady_clock::now() + timeout);
+    while (!completion.done)
+    {
+        int timeout_ms(NO_TIMEOUT);
+        if (hasDeadline)
+        {
+            const auto now(std::chrono::steady_clock::now());
+            if (now >= deadline)
+                return false;
+            timeout_ms = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count()) + 1;
+        }
+        if (polling)
+        {
+            /* Another thread is polling on behalf of us, wait until it has handled the events. */
+            if (hasDeadline)
+                eventsHandled.wait_until(lock, deadline);
+            else
+                eventsHandled.wait(lock);
+            continue;
+        }
+        polling = true;
+        try
+        {
+            pollAndHandleEvents(lock, timeout_ms);
+        }
+        catch (...)
+        {
+            polling = false;
+            eventsHandled.notify_all();
+            throw;
+        }
+        polling = false;
+        eventsHandled.notify_all();
+    }
+    return true;
+}
+
+bool ConcurrentSyncStorage::waitSdlToBeReady(std::unique_lock<std::mutex>& lock,
+                                             const Namespace& ns,
+                                             const std::chrono::steady_clock::duration& timeout,
+                                             std::error_code& error)
+{
+    auto completion(std::make_shared<Completion>());
+    asyncStorage->waitReadyAsync(ns, modifyAck(completion));
+    if (!waitForCompletion(lock, *completion, timeout))
+        return false;
+    error = completion->error;
+    return true;
+}
+
+std::shared_ptr<ConcurrentSyncStorage::Completion> ConcurrentSyncStorage::execute(const Namespace& ns, const Request& request)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    std::error_code readyError;
+    waitSdlToBeReady(lock, ns, operationTimeout, readyError);
+    auto completion(std::make_shared<Completion>());
+    request(completion);
+    waitForCompletion(lock, *completion, std::chrono::steady_clock::duration::zero());
+    if (completion->error)
+        throwExceptionForErrorCode(completion->error);
+    return completion;
+}
+
+void ConcurrentSyncStorage::waitReady(const Namespace& ns, const std::chrono::steady_clock::duration& timeout)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    std::error_code error;
+    if (!waitSdlToBeReady(lock, ns, timeout, error))
+        throw RejectedBySdl("Timeout, SDL service not ready for the '" + ns + "' namespace");
+    if (error)
+        throwExceptionForErrorCode(error);
+}
+
+void ConcurrentSyncStorage::set(const Namespace& ns, const DataMap& dataMap)
+{
+    execute(ns,
+            [this, &ns, &dataMap] (const std::shared_ptr<Completion>& completion)
+            {
+                asyncStorage->setAsync(ns, dataMap, modifyAck(completion));
+            });
+}
+
+bool ConcurrentSyncStorage::setIf(const Namespace& ns, const Key& key, const Data& oldData, const Data& newData)
+{
+    return execute(ns,
+                   [this, &ns, &key, &oldData, &newData] (const std::shared_ptr<Completion>& completion)
+                   {
+                       asyncStorage->setIfAsync(ns, key, oldData, newData, modifyIfAck(completion));
+                   })->status;
+}
+
+bool ConcurrentSyncStorage::setIfNotExists(const Namespace& ns, const Key& key, const Data& data)
+{
+    return execute(ns,
+                   [this, &ns, &key, &data] (const std::shared_ptr<Completion>& completion)
+                   {
+                       asyncStorage->setIfNotExistsAsync(ns, key, data, modifyIfAck(completion));
+                   })->status;
+}
+
+ConcurrentSyncStorage::DataMap ConcurrentSyncStorage::get(const Namespace& ns, const Keys& keys)
+{
+    return std::move(execute(ns,
+                             [this, &ns, &keys] (const std::shared_ptr<Completion>& completion)
+                             {
+                                 asyncStorage->getAsync(ns, keys, getAck(completion));
+                             })->dataMap);
+}
+
+void ConcurrentSyncStorage::remove(const Namespace& ns, const Keys& keys)
+{
+    execute(ns,
+            [this, &ns, &keys] (const std::shared_ptr<Completion>& completion)
+            {
+                asyncStorage->removeAsync(ns, keys, modifyAck(completion));
+            });
+}
+
+bool ConcurrentSyncStorage::removeIf(const Namespace& ns, const Key& key, const Data& data)
+{
+    return execute(ns,
+                   [this, &ns, &key, &data] (const std::shared_ptr<Completion>& completion)
+                   {
+                       asyncStorage->removeIfAsync(ns, key, data, modifyIfAck(completion));
+                   })->status;
+}
+
+ConcurrentSyncStorage::Keys ConcurrentSyncStorage::findKeys(const Namespace& ns, const std::string& keyPrefix)
+{
+    return std::move(execute(ns,
+                             [this, &ns, &keyPrefix] (const std::shared_ptr<Completion>& completion)
+                             {
+                                 asyncStorage->findKeysAsync(ns, keyPrefix, findKeysAck(completion));
+                             })->keys);
+}
+
+ConcurrentSyncStorage::Keys ConcurrentSyncStorage::listKeys(const Namespace& ns, const std::string& pattern)
+{
+    return std::move(execute(ns,
+                             [this, &ns, &pattern] (const std::shared_ptr<Completion>& completion)
+                             {
+                                 asyncStorage->listKeys(ns, pattern, findKeysAck(completion));
+                             })->keys);
+}
+
+void ConcurrentSyncStorage::removeAll(const Namespace& ns)
+{
+    execute(ns,
+            [this, &ns] (const std::shared_ptr<Completion>& completion)
+            {
+                asyncStorage->removeAllAsync(ns, modifyAck(completion));
+            });
+}
+
+void ConcurrentSyncStorage::removeByPrefix(const Namespace& ns, const std::string& keyPrefix)
+{
+    execute(ns,
+            [this, &ns, &keyPrefix] (const std::shared_ptr<Completion>& completion)
+            {
+                asyncStorage->removeByPrefixAsync(ns, keyPrefix, modifyAck(completion));
+            });
+}
+
+std::vector<bool> ConcurrentSyncStorage::writeBatch(const Namespace& ns, const WriteBatch& writeBatch)
+{
+    return execute(ns,
+                   [this, &ns, &writeBatch] (const std::shared_ptr<Completion>& completion)
+                   {
+                       asyncStorage->writeBatchAsync(ns, writeBatch, writeBatchAck(completion));
+                   })->statuses;
+}
+
+void ConcurrentSyncStorage::setOperationTimeout(const std::chrono::steady_clock::duration& timeout)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    operationTimeout = timeout;
+    asyncStorage->setOperationTimeout(timeout);
+}
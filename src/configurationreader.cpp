@@ -28,6 +28,8 @@
 #include "private/logger.hpp"
 #include "private/namespaceconfigurations.hpp"
 #include "private/namespacevalidator.hpp"
+#include "private/slowoperationlog.hpp"
+#include "private/statisticscollector.hpp"
 #include "private/system.hpp"
 #include <boost/algorithm/string.hpp>
 
@@ -58,6 +60,15 @@ namespace
         }
     }
 
+    template <typename T>
+    T getOptional(const boost::property_tree::ptree& ptree, const std::string& param, const T& defaultValue,
+                  const std::string& sourceName)
+    {
+        if (ptree.count(param) == 0)
+            return defaultValue;
+        return get<T>(ptree, param, sourceName);
+    }
+
     void validateAndSetDbType(const std::string& type, DatabaseConfiguration& databaseConfiguration,
                               const std::string& sourceName)
     {
@@ -176,6 +187,26 @@ namespace
         }
     }
 
+    void validateNearCacheSize(long long nearCacheSize, bool enableNotifications,
+                               const std::string& sourceName)
+    {
+        if (nearCacheSize < 0)
+        {
+            std::ostringstream os;
+            os << "Configuration error in " << sourceName << ": "
+               << "\"nearCacheSize\" cannot be negative";
+            throw Exception(os.str());
+        }
+        /* Near cache entries are invalidated by the modification notifications. */
+        if (nearCacheSize && !enableNotifications)
+        {
+            std::ostringstream os;
+            os << "Configuration error in " << sourceName << ": "
+               << "\"nearCacheSize\" cannot be set, when \"enableNotifications\" is false";
+            throw Exception(os.str());
+        }
+    }
+
     void parseNsConfiguration(NamespaceConfigurations& namespaceConfigurations,
                               const std::string& namespacePrefix,
                               const boost::property_tree::ptree& ptree,
@@ -183,11 +214,14 @@ namespace
     {
         const auto useDbBackend(get<bool>(ptree, "useDbBackend", sourceName));
         const auto enableNotifications(get<bool>(ptree, "enableNotifications", sourceName));
+        const auto nearCacheSize(getOptional<long long>(ptree, "nearCacheSize", 0, sourceName));
 
         validateNamespacePrefix(namespacePrefix, sourceName);
         validateEnableNotifications(enableNotifications, useDbBackend, sourceName);
+        validateNearCacheSize(nearCacheSize, enableNotifications, sourceName);
 
-        namespaceConfigurations.addNamespaceConfiguration({namespacePrefix, useDbBackend, enableNotifications, sourceName});
+        namespaceConfigurations.addNamespaceConfiguration({namespacePrefix, useDbBackend, enableNotifications, sourceName,
+                                                           static_cast<std::size_t>(nearCacheSize)});
     }
 
     void parseNsConfigurationMap(NamespaceConfigurations& namespaceConfigurations,
@@ -197,6 +231,80 @@ namespace
             parseNsConfiguration(namespaceConfigurations, namespaceConfigurationMapItem.first, namespaceConfigurationMapItem.second.first, namespaceConfigurationMapItem.second.second);
     }
 
+    void parseSlowOperationLogConfiguration(SlowOperationLogConfiguration& slowOperationLogConfiguration,
+                                            const boost::property_tree::ptree& ptree,
+                                            const std::string& sourceName)
+    {
+        const auto threshold(get<int>(ptree, "thresholdMs", sourceName));
+        const auto size(getOptional<int>(ptree, "size", static_cast<int>(slowOperationLogConfiguration.size), sourceName));
+        if (threshold < 0)
+        {
+            std::ostringstream os;
+            os << "Configuration error in " << sourceName << ": "
+               << "\"thresholdMs\" cannot be negative";
+            throw Exception(os.str());
+        }
+        if (size <= 0)
+        {
+            std::ostringstream os;
+            os << "Configuration error in " << sourceName << ": "
+               << "\"size\" must be greater than 0";
+            throw Exception(os.str());
+        }
+        slowOperationLogConfiguration.threshold = std::chrono::milliseconds(threshold);
+        slowOperationLogConfiguration.size = static_cast<std::size_t>(size);
+    }
+
+    void parseSlowOperationThresholdFromString(SlowOperationLogConfiguration& slowOperationLogConfiguration,
+                                               const std::string& threshold,
+                                               const std::string& sourceName)
+    {
+        std::istringstream is(threshold);
+        unsigned int milliseconds;
+        if (!(is >> milliseconds) || !is.eof() || threshold.find('-') != std::string::npos)
+        {
+            std::ostringstream os;
+            os << "Configuration error in " << sourceName << ": "
+               << "invalid threshold: \"" << threshold << '\"';
+            throw Exception(os.str());
+        }
+        slowOperationLogConfiguration.threshold = std::chrono::milliseconds(milliseconds);
+    }
+
+    void parseStatisticsConfiguration(StatisticsConfiguration& statisticsConfiguration,
+                                      const boost::property_tree::ptree& ptree,
+                                      const std::string& sourceName)
+    {
+        const auto enabled(get<bool>(ptree, "enabled", sourceName));
+        const auto maxNamespaces(getOptional<int>(ptree, "maxNamespaces", static_cast<int>(statisticsConfiguration.maxNamespaces), sourceName));
+        if (maxNamespaces <= 0)
+        {
+            std::ostringstream os;
+            os << "Configuration error in " << sourceName << ": "
+               << "\"maxNamespaces\" must be greater than 0";
+            throw Exception(os.str());
+        }
+        statisticsConfiguration.enabled = enabled;
+        statisticsConfiguration.maxNamespaces = static_cast<std::size_t>(maxNamespaces);
+    }
+
+    void parseStatisticsEnabledFromString(StatisticsConfiguration& statisticsConfiguration,
+                                          const std::string& enabled,
+                                          const std::string& sourceName)
+    {
+        if (enabled == "true")
+            statisticsConfiguration.enabled = true;
+        else if (enabled == "false")
+            statisticsConfiguration.enabled = false;
+        else
+        {
+            std::ostringstream os;
+            os << "Configuration error in " << sourceName << ": "
+               << "invalid value: \"" << enabled << "\", expected \"true\" or \"false\"";
+            throw Exception(os.str());
+        }
+    }
+
     const std::string DEFAULT_REDIS_PORT("6379");
 
     void appendDBPortToAddrList(std::string& addresses, const std::string& port)
@@ -238,6 +346,9 @@ ConfigurationReader::ConfigurationReader(const Directories& directories,
     dbClusterAddrListEnvVariableName(DB_CLUSTER_ADDR_LIST_ENV_VAR_NAME),
     dbClusterAddrListEnvVariableValue({}),
     jsonDatabaseConfiguration(boost::none),
+    jsonSlowOperationLogConfiguration(boost::none),
+    jsonStatisticsConfiguration(boost::none),
+    system(system),
     logger(logger)
 {
     auto envStr = system.getenv(dbHostEnvVariableName.c_str());
@@ -307,6 +418,20 @@ void ConfigurationReader::readConfiguration(T& input, const std::string& current
         }
     }
 
+    const auto slowOperationLogConfiguration(propertyTree.get_child_optional("slowOperationLog"));
+    if (slowOperationLogConfiguration)
+    {
+        jsonSlowOperationLogConfiguration = slowOperationLogConfiguration;
+        sourceForSlowOperationLogConfiguration = currentSourceName;
+    }
+
+    const auto statisticsConfiguration(propertyTree.get_child_optional("statistics"));
+    if (statisticsConfiguration)
+    {
+        jsonStatisticsConfiguration = statisticsConfiguration;
+        sourceForStatisticsConfiguration = currentSourceName;
+    }
+
     const auto namespaceConfigurations(propertyTree.get_child_optional("sharedDataLayer"));
     if (namespaceConfigurations)
     {
@@ -396,6 +521,47 @@ void ConfigurationReader::readNamespaceConfigurations(NamespaceConfigurations& n
     }
 }
 
+void ConfigurationReader::readSlowOperationLogConfiguration(SlowOperationLogConfiguration& slowOperationLogConfiguration)
+{
+    try
+    {
+        if (jsonSlowOperationLogConfiguration)
+            parseSlowOperationLogConfiguration(slowOperationLogConfiguration,
+                                               *jsonSlowOperationLogConfiguration,
+                                               sourceForSlowOperationLogConfiguration);
+        const auto envStr(system.getenv(SLOW_OPERATION_THRESHOLD_ENV_VAR_NAME));
+        if (envStr)
+            parseSlowOperationThresholdFromString(slowOperationLogConfiguration,
+                                                  envStr,
+                                                  SLOW_OPERATION_THRESHOLD_ENV_VAR_NAME);
+    }
+    catch(const std::exception& e)
+    {
+        logger->error() << e.what();
+        throw;
+    }
+}
+
+void ConfigurationReader::readStatisticsConfiguration(StatisticsConfiguration& statisticsConfiguration)
+{
+    try
+    {
+        if (jsonStatisticsConfiguration)
+            parseStatisticsConfiguration(statisticsConfiguration,
+                                         *jsonStatisticsConfiguration,
+                                         sourceForStatisticsConfiguration);
+        const auto envStr(system.getenv(STATISTICS_ENABLED_ENV_VAR_NAME));
+        if (envStr)
+            parseStatisticsEnabledFromString(statisticsConfiguration,
+                                             envStr,
+                                             STATISTICS_ENABLED_ENV_VAR_NAME);
+    }
+    catch(const std::exception& e)
+    {
+        logger->error() << e.what();
+        throw;
+    }
+}
 
 template void ConfigurationReader::readConfiguration(const std::string&, const std::string&);
 template void ConfigurationReader::readConfiguration(std::istream&, const std::string&);
@@ -57,3 +57,12 @@ void shareddatalayer::logInfoOnce(const std::string& msg) noexcept
     auto logger(createLogger(SDL_LOG_PREFIX));
     logger->info() << msg << std::endl;
 }
+
+void shareddatalayer::waitLogsFlushed() noexcept
+{
+#if HAVE_SYSTEMLOGGER
+    SystemLogger::waitFlushed();
+#else
+    StdStreamLogger::waitFlushed();
+#endif
+}
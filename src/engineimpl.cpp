@@ -56,9 +56,17 @@ void EngineImpl::epollWait(int timeout)
     if (count <= 0)
         return;
     ebuffer.resize(count);
+    /* Callbacks posted while handling the events are executed at the end of the round
+     * without waking up epoll_wait() with the eventfd.
+     */
+    EventFD* const deferringEventFD(eventFD.get());
+    if (deferringEventFD)
+        deferringEventFD->beginEventHandling();
     for (const auto& i : ebuffer)
         if (i.data.fd != -1)
             callHandler(i);
+    if (deferringEventFD)
+        deferringEventFD->endEventHandling();
 }
 
 void EngineImpl::callHandler(const epoll_event& e)
@@ -126,9 +134,9 @@ void EngineImpl::disarmTimer(const Timer& timer)
     getTimerFD().disarm(timer);
 }
 
-void EngineImpl::postCallback(const Callback& callback)
+void EngineImpl::postCallback(Callback callback)
 {
-    getEventFD().post(callback);
+    getEventFD().post(std::move(callback));
 }
 
 void EngineImpl::run()
@@ -116,6 +116,8 @@ namespace
                 return "redis I/O error";
             case AsyncRedisCommandDispatcherErrorCode::WRITING_TO_SLAVE:
                 return "writing to slave";
+            case AsyncRedisCommandDispatcherErrorCode::NO_SCRIPT:
+                return "redis script not found from script cache";
             case AsyncRedisCommandDispatcherErrorCode::END_MARKER:
                 logErrorOnce("AsyncRedisCommandDispatcherErrorCode::END_MARKER is not meant to be queried (it is only for enum loop control)");
                 return "unsupported error code for message()";
@@ -146,6 +148,8 @@ namespace
                 return InternalError::BACKEND_ERROR;
             case AsyncRedisCommandDispatcherErrorCode::WRITING_TO_SLAVE:
                 return InternalError::BACKEND_ERROR;
+            case AsyncRedisCommandDispatcherErrorCode::NO_SCRIPT:
+                return InternalError::BACKEND_ERROR;
             case AsyncRedisCommandDispatcherErrorCode::END_MARKER:
                 logErrorOnce("AsyncRedisCommandDispatcherErrorCode::END_MARKER is not meant to be mapped to InternalError (it is only for enum loop control)");
                 return InternalError::SDL_ERROR_CODE_LOGIC_ERROR;
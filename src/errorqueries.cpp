@@ -92,7 +92,8 @@ namespace
                        ec == InternalError::BACKEND_NOT_READY ||
                        ec == InternalError::SDL_NOT_READY;
             case shareddatalayer::Error::OPERATION_INTERRUPTED:
-                return ec == InternalError::BACKEND_CONNECTION_LOST;
+                return ec == InternalError::BACKEND_CONNECTION_LOST ||
+                       ec == InternalError::BACKEND_REPLY_TIMEOUT;
             case shareddatalayer::Error::BACKEND_FAILURE:
                 return ec == InternalError::BACKEND_ERROR ||
                        ec == InternalError::SDL_ERROR_CODE_LOGIC_ERROR;
@@ -37,6 +37,9 @@ namespace
     {
         callback();
     }
+
+    const uint64_t INDEX_MASK(0xFFFFFFFFU);
+    const uint64_t TAG_INCREMENT(INDEX_MASK + 1U);
 }
 
 EventFD::EventFD(Engine& engine):
@@ -46,56 +49,192 @@ EventFD::EventFD(Engine& engine):
 
 EventFD::EventFD(System& system, Engine& engine):
     system(system),
-    fd(system, system.eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK))
+    fd(system, system.eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK)),
+    blocks(),
+    blockCount(0U),
+    freeNodes(0U),
+    head(allocate(Callback())),
+    tail(head),
+    signaled(false),
+    executingThread(std::thread::id()),
+    wakeupDeferred(false)
 {
     engine.addMonitoredFD(fd, Engine::EVENT_IN, std::bind(&EventFD::handleEvents, this));
 }
 
 EventFD::~EventFD()
 {
+    for (unsigned int i(0U); i < blockCount; ++i)
+        delete[] blocks[i].load();
 }
 
-void EventFD::post(const Callback& callback)
+void EventFD::post(Callback callback)
 {
     if (!callback)
         SHAREDDATALAYER_ABORT("A null callback was provided");
 
-    atomicPushBack(callback);
+    push(allocate(std::move(callback)));
+    if (signaled.exchange(true))
+        return;
+    if (executingThread.load() == std::this_thread::get_id())
+        wakeupDeferred = true;
+    else
+        wakeup();
+}
+
+EventFD::Node* EventFD::allocate(Callback callback)
+{
+    Node* node(popFree());
+    if (node == nullptr)
+        node = grow();
+    node->callback = std::move(callback);
+    node->next.store(nullptr, std::memory_order_relaxed);
+    return node;
+}
+
+void EventFD::release(Node* node)
+{
+    node->callback = nullptr;
+    pushFree(node);
+}
+
+EventFD::Node* EventFD::popFree()
+{
+    /*
+     * The tag is changed by every push and pop, so the exchange fails if the
+     * first node has been popped and pushed back after reading its next node.
+     */
+    uint64_t first(freeNodes.load(std::memory_order_acquire));
+    while ((first & INDEX_MASK) != 0U)
+    {
+        Node* const node(getNode(static_cast<uint32_t>(first & INDEX_MASK) - 1U));
+        const uint64_t next((first & ~INDEX_MASK) + TAG_INCREMENT + node->nextFree.load(std::memory_order_relaxed));
+        if (freeNodes.compare_exchange_weak(first, next, std::memory_order_acquire, std::memory_order_acquire))
+            return node;
+    }
+    return nullptr;
+}
+
+void EventFD::pushFree(Node* node)
+{
+    uint64_t first(freeNodes.load(std::memory_order_relaxed));
+    uint64_t next;
+    do
+    {
+        node->nextFree.store(static_cast<uint32_t>(first & INDEX_MASK), std::memory_order_relaxed);
+        next = (first & ~INDEX_MASK) + TAG_INCREMENT + node->index + 1U;
+    }
+    while (!freeNodes.compare_exchange_weak(first, next, std::memory_order_release, std::memory_order_relaxed));
+}
+
+EventFD::Node* EventFD::grow()
+{
+    std::lock_guard<std::mutex> lock(growMutex);
+    /* Another thread may have grown the pool while this one was waiting. */
+    Node* const node(popFree());
+    if (node != nullptr)
+        return node;
+    if (blockCount == MAX_BLOCKS)
+        SHAREDDATALAYER_ABORT("EventFD: too many pending callbacks");
+
+    const uint32_t size(1U << (FIRST_BLOCK_BITS + blockCount));
+    const uint32_t firstIndex(size - (1U << FIRST_BLOCK_BITS));
+    Node* const block(new Node[size]);
+    for (uint32_t i(0U); i < size; ++i)
+    {
+        block[i].next.store(nullptr, std::memory_order_relaxed);
+        block[i].nextFree.store(0U, std::memory_order_relaxed);
+        block[i].index = firstIndex + i;
+    }
+    blocks[blockCount].store(block, std::memory_order_release);
+    ++blockCount;
+    for (uint32_t i(1U); i < size; ++i)
+        pushFree(&block[i]);
+    return &block[0];
+}
+
+EventFD::Node* EventFD::getNode(uint32_t index) const
+{
+    /* Block n starts from index 2^(FIRST_BLOCK_BITS + n) - 2^FIRST_BLOCK_BITS. */
+    const uint32_t shifted((index >> FIRST_BLOCK_BITS) + 1U);
+    const unsigned int block(31U - __builtin_clz(shifted));
+    const uint32_t offset(index - (((1U << block) - 1U) << FIRST_BLOCK_BITS));
+    return blocks[block].load(std::memory_order_acquire) + offset;
+}
+
+void EventFD::push(Node* node)
+{
+    Node* const previous(tail.exchange(node));
+    previous->next.store(node);
+}
+
+void EventFD::wakeup()
+{
     static const uint64_t value(1U);
     system.write(fd, &value, sizeof(value));
 }
 
-void EventFD::atomicPushBack(const Callback& callback)
+void EventFD::beginEventHandling()
 {
-    std::lock_guard<std::mutex> guard(callbacksMutex);
-    callbacks.push_back(callback);
+    executingThread.store(std::this_thread::get_id());
 }
 
-EventFD::Callbacks EventFD::atomicPopAll()
+void EventFD::endEventHandling()
 {
-    std::lock_guard<std::mutex> guard(callbacksMutex);
-    Callbacks extractedCallbacks;
-    std::swap(callbacks, extractedCallbacks);
-    return extractedCallbacks;
+    /* Rounds are bounded, so that callbacks which keep posting callbacks do not
+     * starve the other file descriptors of the engine.
+     */
+    for (unsigned int round(0U); wakeupDeferred && (round < MAX_DEFERRED_ROUNDS); ++round)
+    {
+        wakeupDeferred = false;
+        executeCallbacks();
+    }
+    executingThread.store(std::thread::id());
+    if (wakeupDeferred)
+    {
+        wakeupDeferred = false;
+        wakeup();
+    }
 }
 
 void EventFD::handleEvents()
 {
     uint64_t value;
     system.read(fd, &value, sizeof(value));
+    if (executingThread.load() == std::this_thread::get_id())
+    {
+        /* Called by the engine, which executes the callbacks posted meanwhile at the end of the round. */
+        executeCallbacks();
+        return;
+    }
+    executingThread.store(std::this_thread::get_id());
     executeCallbacks();
+    executingThread.store(std::thread::id());
+    if (wakeupDeferred)
+    {
+        wakeupDeferred = false;
+        wakeup();
+    }
 }
 
 void EventFD::executeCallbacks()
 {
-    Callbacks callbacks(atomicPopAll());
-    while (!callbacks.empty())
-        popAndExecuteFirstCallback(callbacks);
-}
-
-void EventFD::popAndExecuteFirstCallback(Callbacks& callbacks)
-{
-    const auto callback(callbacks.front());
-    callbacks.pop_front();
-    execute(callback);
+    /*
+     * Posts done after clearing the flag will do a new wakeup, so callbacks
+     * which are not yet visible below will be executed in the next round.
+     * Callbacks posted by the executed callbacks are left to the next round
+     * by stopping at the tail seen here.
+     */
+    signaled.store(false);
+    Node* const last(tail.load());
+    while (head != last)
+    {
+        Node* const next(head->next.load());
+        if (next == nullptr)
+            break;
+        const Callback callback(std::move(next->callback));
+        release(head);
+        head = next;
+        execute(callback);
+    }
 }
@@ -67,6 +67,8 @@ std::string NamespaceConfigurationsImpl::getDescription(const std::string& ns) c
     os << sourceInfo << ", ";
     os << "useDbBackend: " << namespaceConfiguration.dbBackendIsUsed << ", ";
     os << "enableNotifications: " << namespaceConfiguration.notificationsAreEnabled;
+    if (namespaceConfiguration.nearCacheSize)
+        os << ", nearCacheSize: " << namespaceConfiguration.nearCacheSize;
     return os.str();
 }
 
@@ -80,6 +82,19 @@ bool NamespaceConfigurationsImpl::areNotificationsEnabled(const std::string& ns)
     return findConfigurationForNamespace(ns).notificationsAreEnabled;
 }
 
+std::size_t NamespaceConfigurationsImpl::getNearCacheSize(const std::string& ns) const
+{
+    return findConfigurationForNamespace(ns).nearCacheSize;
+}
+
+bool NamespaceConfigurationsImpl::isNearCacheUsed() const
+{
+    for (const auto& namespaceConfiguration : namespaceConfigurations)
+        if (namespaceConfiguration.nearCacheSize)
+            return true;
+    return false;
+}
+
 const NamespaceConfiguration& NamespaceConfigurationsImpl::findConfigurationForNamespace(const std::string& ns) const
 {
     if (namespaceConfigurationsLookupTable.count(ns) > 0)
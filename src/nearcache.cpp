@@ -0,0 +1,93 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include "private/nearcache.hpp"
+
+using namespace shareddatalayer;
+
+NearCache::NearCache(std::size_t maxSize):
+    maxSize(maxSize),
+    enabled(false),
+    generation(0)
+{
+}
+
+void NearCache::enable()
+{
+    /* Data read before the notifications were received may be stale. */
+    ++generation;
+    enabled = true;
+}
+
+void NearCache::disable()
+{
+    clear();
+    enabled = false;
+}
+
+const NearCache::Data* NearCache::find(const Key& key)
+{
+    const auto i(index.find(key));
+    if (i == index.end())
+        return nullptr;
+    entries.splice(entries.begin(), entries, i->second);
+    return &i->second->second;
+}
+
+void NearCache::insert(const Key& key, const Data& data, Generation readGeneration)
+{
+    if (!enabled || readGeneration != generation || maxSize == 0)
+        return;
+    const auto i(index.find(key));
+    if (i != index.end())
+    {
+        i->second->second = data;
+        entries.splice(entries.begin(), entries, i->second);
+        return;
+    }
+    if (entries.size() >= maxSize)
+    {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+    entries.emplace_front(key, data);
+    index.emplace(key, entries.begin());
+}
+
+void NearCache::invalidate(const Keys& keys)
+{
+    ++generation;
+    for (const auto& key : keys)
+    {
+        const auto i(index.find(key));
+        if (i == index.end())
+            continue;
+        entries.erase(i->second);
+        index.erase(i);
+    }
+}
+
+void NearCache::clear()
+{
+    ++generation;
+    entries.clear();
+    index.clear();
+}
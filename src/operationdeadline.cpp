@@ -0,0 +1,49 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include "private/operationdeadline.hpp"
+
+using namespace shareddatalayer;
+
+std::shared_ptr<OperationDeadline> OperationDeadline::create(Engine& engine, const Timer::Duration& timeout)
+{
+    return std::shared_ptr<OperationDeadline>(new OperationDeadline(engine, timeout));
+}
+
+OperationDeadline::OperationDeadline(Engine& engine, const Timer::Duration& timeout):
+    timer(engine),
+    timeout(timeout),
+    completed(false)
+{
+}
+
+OperationDeadline::~OperationDeadline()
+{
+}
+
+bool OperationDeadline::complete()
+{
+    if (completed)
+        return false;
+    completed = true;
+    timer.disarm();
+    return true;
+}
@@ -31,9 +31,43 @@
 #endif
 #include "private/abort.hpp"
 #include "private/engine.hpp"
+#include "private/error.hpp"
+#include "private/redis/contents.hpp"
+#include "private/redis/script.hpp"
 
+using namespace shareddatalayer;
 using namespace shareddatalayer::redis;
 
+namespace
+{
+    struct ScriptCommand
+    {
+        AsyncCommandDispatcher::CommandCb commandCb;
+        AsyncConnection::Namespace ns;
+        Script script;
+        Contents contents;
+    };
+
+    Contents buildEvalContents(const Script& script, const Contents& evalShaContents)
+    {
+        /* Only the command and the script identifier differ, the rest of the arguments
+         * point to the storage shared with the EVALSHA contents.
+         */
+        static const std::string eval("EVAL");
+        Contents contents(evalShaContents);
+        contents.stack[0] = eval.data();
+        contents.sizes[0] = eval.size();
+        contents.stack[1] = script.getSource().data();
+        contents.sizes[1] = script.getSource().size();
+        return contents;
+    }
+}
+
+AsyncCommandDispatcher::AsyncCommandDispatcher():
+    alive(std::make_shared<bool>(true))
+{
+}
+
 std::shared_ptr<AsyncCommandDispatcher> AsyncCommandDispatcher::create(Engine& engine,
                                                                        const DatabaseInfo& databaseInfo,
                                                                        std::shared_ptr<ContentsBuilder> contentsBuilder,
@@ -73,3 +107,23 @@ std::shared_ptr<AsyncCommandDispatcher> AsyncCommandDispatcher::create(Engine& e
     SHAREDDATALAYER_ABORT("Not implemented.");
 #endif
 }
+
+void AsyncCommandDispatcher::dispatchScriptAsync(CommandCb commandCb,
+                                                 const AsyncConnection::Namespace& ns,
+                                                 const Script& script,
+                                                 const Contents& contents)
+{
+    const auto command(std::make_shared<ScriptCommand>(ScriptCommand { std::move(commandCb), ns, script, contents }));
+    const std::weak_ptr<bool> weakAlive(alive);
+    dispatchAsync([this, weakAlive, command](const std::error_code& error, const Reply& reply)
+                  {
+                      if (error == AsyncRedisCommandDispatcherErrorCode::NO_SCRIPT && !weakAlive.expired())
+                          dispatchAsync(std::move(command->commandCb),
+                                        command->ns,
+                                        buildEvalContents(command->script, command->contents));
+                      else
+                          command->commandCb(error, reply);
+                  },
+                  ns,
+                  contents);
+}
@@ -0,0 +1,389 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include "private/redis/asynccommanddispatcherpool.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include "private/abort.hpp"
+#include "private/redis/reply.hpp"
+#include "private/system.hpp"
+
+using namespace shareddatalayer;
+using namespace shareddatalayer::redis;
+
+namespace
+{
+    /* Deferred commands outlive the buffers the original contents may point to. */
+    Contents copyContents(const Contents& contents)
+    {
+        Contents copy;
+        std::size_t size(0);
+        for (const auto& i : contents.sizes)
+            size += i;
+        copy.storage = std::make_shared<std::string>();
+        copy.storage->reserve(size);
+        for (std::size_t i(0); i < contents.stack.size(); ++i)
+            copy.storage->append(contents.stack[i], contents.sizes[i]);
+        copy.sizes = contents.sizes;
+        copy.keyArguments = contents.keyArguments;
+        copy.stack.reserve(contents.stack.size());
+        const char* argument(copy.storage->data());
+        for (const auto& i : copy.sizes)
+        {
+            copy.stack.push_back(argument);
+            argument += i;
+        }
+        return copy;
+    }
+
+    const std::size_t ORDERING_SLOTS(1024);
+
+    /* FNV-1a */
+    std::size_t hash(const char* data, std::size_t size)
+    {
+        uint64_t value(14695981039346656037ULL);
+        for (std::size_t i(0); i < size; ++i)
+        {
+            value ^= static_cast<unsigned char>(data[i]);
+            value *= 1099511628211ULL;
+        }
+        return static_cast<std::size_t>(value);
+    }
+}
+
+const std::size_t AsyncCommandDispatcherPool::MAX_SIZE(64);
+
+AsyncCommandDispatcherPool::AsyncCommandDispatcherPool(const Dispatchers& dispatchers):
+    dispatchers(dispatchers),
+    outstanding(dispatchers.size(), 0),
+    nextDispatcher(0),
+    slotStates(ORDERING_SLOTS, SlotState { 0, 0, 0 }),
+    dispatchingDeferred(false),
+    redispatchDeferred(false),
+    callbacksEnabled(true),
+    trackingConnections(false),
+    connected(dispatchers.size(), false),
+    connectedCount(0)
+{
+    if (dispatchers.empty())
+        SHAREDDATALAYER_ABORT("Connection pool without connections.");
+}
+
+AsyncCommandDispatcherPool::~AsyncCommandDispatcherPool()
+{
+}
+
+std::size_t AsyncCommandDispatcherPool::getSize(System& system)
+{
+    const auto envStr(system.getenv(DB_CONNECTION_POOL_SIZE_ENV_VAR_NAME));
+    if (!envStr)
+        return 1;
+    char* end(nullptr);
+    const auto size(std::strtoul(envStr, &end, 10));
+    if (end == envStr || *end != '\0' || size == 0)
+        return 1;
+    return std::min(static_cast<std::size_t>(size), MAX_SIZE);
+}
+
+void AsyncCommandDispatcherPool::waitConnectedAsync(const ConnectAck& connectAck)
+{
+    trackConnections();
+    if (connectedCount < dispatchers.size())
+    {
+        connectAcks.push_back(connectAck);
+        return;
+    }
+    /* Like a single dispatcher, let the first dispatcher call the acknowledgement
+     * after returning. The dispatcher keeps it until its next connection, but
+     * dispatcherDisconnected() replaces it before that.
+     */
+    const std::weak_ptr<AsyncCommandDispatcherPool> weakSelf(shared_from_this());
+    dispatchers.front()->waitConnectedAsync([weakSelf, connectAck]()
+                                            {
+                                                const auto self(weakSelf.lock());
+                                                if (self)
+                                                    self->dispatcherConnected(0);
+                                                connectAck();
+                                            });
+}
+
+void AsyncCommandDispatcherPool::registerDisconnectCb(const DisconnectCb& disconnectCb)
+{
+    this->disconnectCb = disconnectCb;
+    trackConnections();
+}
+
+void AsyncCommandDispatcherPool::trackConnections()
+{
+    if (trackingConnections)
+        return;
+    trackingConnections = true;
+    const std::weak_ptr<AsyncCommandDispatcherPool> weakSelf(shared_from_this());
+    for (std::size_t i(0); i < dispatchers.size(); ++i)
+    {
+        dispatchers[i]->registerDisconnectCb([weakSelf, i]()
+                                             {
+                                                 const auto self(weakSelf.lock());
+                                                 if (self)
+                                                     self->dispatcherDisconnected(i);
+                                             });
+        waitDispatcherConnected(i);
+    }
+}
+
+void AsyncCommandDispatcherPool::waitDispatcherConnected(std::size_t dispatcher)
+{
+    const std::weak_ptr<AsyncCommandDispatcherPool> weakSelf(shared_from_this());
+    dispatchers[dispatcher]->waitConnectedAsync([weakSelf, dispatcher]()
+                                                {
+                                                    const auto self(weakSelf.lock());
+                                                    if (self)
+                                                        self->dispatcherConnected(dispatcher);
+                                                });
+}
+
+void AsyncCommandDispatcherPool::dispatcherConnected(std::size_t dispatcher)
+{
+    if (connected[dispatcher])
+        return;
+    connected[dispatcher] = true;
+    if (++connectedCount < dispatchers.size())
+        return;
+    /* An acknowledgement may wait for the connections again. */
+    std::vector<ConnectAck> acks;
+    acks.swap(connectAcks);
+    for (const auto& ack : acks)
+        ack();
+}
+
+void AsyncCommandDispatcherPool::dispatcherDisconnected(std::size_t dispatcher)
+{
+    if (connected[dispatcher])
+    {
+        connected[dispatcher] = false;
+        --connectedCount;
+    }
+    waitDispatcherConnected(dispatcher);
+    if (disconnectCb)
+        disconnectCb();
+}
+
+void AsyncCommandDispatcherPool::getSlots(const Contents& contents, Slots& slots)
+{
+    /* Only the key arguments recorded by ContentsBuilder are ordered, so for example
+     * a SCAN match pattern with the namespace prefix is not taken as a key.
+     */
+    slots.clear();
+    const auto& keyArguments(contents.keyArguments);
+    for (std::size_t i(0); i < keyArguments.count; ++i)
+    {
+        const auto argument(keyArguments.first + i * keyArguments.step);
+        slots.push_back(hash(contents.stack[argument], contents.sizes[argument]) % ORDERING_SLOTS);
+    }
+}
+
+bool AsyncCommandDispatcherPool::isDeferred(const Slots& slots) const
+{
+    for (const auto& slot : slots)
+        if (slotStates[slot].deferred)
+            return true;
+    return false;
+}
+
+bool AsyncCommandDispatcherPool::selectDispatcher(const Slots& slots, std::size_t& dispatcher)
+{
+    bool pinned(false);
+    for (const auto& slot : slots)
+    {
+        const auto& slotState(slotStates[slot]);
+        if (!slotState.outstanding)
+            continue;
+        if (pinned && dispatcher != slotState.dispatcher)
+            return false;
+        dispatcher = slotState.dispatcher;
+        pinned = true;
+    }
+    if (pinned)
+        return true;
+
+    /* Disconnected dispatchers are skipped, unless all are disconnected. */
+    const bool skipDisconnected(connectedCount != 0);
+    dispatcher = dispatchers.size();
+    for (std::size_t i(0); i < dispatchers.size(); ++i)
+    {
+        const auto candidate((nextDispatcher + i) % dispatchers.size());
+        if (skipDisconnected && !connected[candidate])
+            continue;
+        if (dispatcher == dispatchers.size() || outstanding[candidate] < outstanding[dispatcher])
+            dispatcher = candidate;
+    }
+    nextDispatcher = (dispatcher + 1) % dispatchers.size();
+    return true;
+}
+
+void AsyncCommandDispatcherPool::dispatchAsync(CommandCb commandCb,
+                                               const AsyncConnection::Namespace& ns,
+                                               const Contents& contents)
+{
+    getSlots(contents, slotsOfCommand);
+    std::size_t dispatcher(0);
+    if (!isDeferred(slotsOfCommand) && selectDispatcher(slotsOfCommand, dispatcher))
+        send(dispatcher, std::move(commandCb), ns, contents, slotsOfCommand);
+    else
+        defer(std::move(commandCb), ns, contents, slotsOfCommand);
+}
+
+void AsyncCommandDispatcherPool::send(std::size_t dispatcher,
+                                      CommandCb commandCb,
+                                      const AsyncConnection::Namespace& ns,
+                                      const Contents& contents,
+                                      const Slots& slots)
+{
+    ++outstanding[dispatcher];
+    for (const auto& slot : slots)
+    {
+        auto& slotState(slotStates[slot]);
+        slotState.dispatcher = dispatcher;
+        ++slotState.outstanding;
+    }
+    /* The callback is kept in the pool, so that the callback given to the dispatcher
+     * stays small enough to be stored without allocating.
+     */
+    std::size_t index(pendingCommands.size());
+    if (freePendingCommands.empty())
+        pendingCommands.emplace_back();
+    else
+    {
+        index = freePendingCommands.back();
+        freePendingCommands.pop_back();
+    }
+    auto& pendingCommand(pendingCommands[index]);
+    pendingCommand.commandCb = std::move(commandCb);
+    pendingCommand.dispatcher = dispatcher;
+    pendingCommand.slots.assign(slots.begin(), slots.end());
+    const std::weak_ptr<AsyncCommandDispatcherPool> weakSelf(shared_from_this());
+    const auto completionCb([weakSelf, index](const std::error_code& error, const Reply& reply)
+                            {
+                                const auto self(weakSelf.lock());
+                                if (self)
+                                    self->commandCompleted(index, error, reply);
+                            });
+    static_assert(CommandCb::isStoredInline<decltype(completionCb)>(),
+                  "Pool completion callback does not fit in CommandCb");
+    dispatchers[dispatcher]->dispatchAsync(completionCb, ns, contents);
+}
+
+void AsyncCommandDispatcherPool::defer(CommandCb commandCb,
+                                       const AsyncConnection::Namespace& ns,
+                                       const Contents& contents,
+                                       const Slots& slots)
+{
+    for (const auto& slot : slots)
+        ++slotStates[slot].deferred;
+    deferredCommands.push_back({ std::move(commandCb), ns, copyContents(contents), slots });
+}
+
+void AsyncCommandDispatcherPool::commandCompleted(std::size_t index,
+                                                  const std::error_code& error,
+                                                  const Reply& reply)
+{
+    if (!callbacksEnabled)
+        return;
+    auto& pendingCommand(pendingCommands[index]);
+    auto commandCb(std::move(pendingCommand.commandCb));
+    --outstanding[pendingCommand.dispatcher];
+    for (const auto& slot : pendingCommand.slots)
+        --slotStates[slot].outstanding;
+    pendingCommand.slots.clear();
+    freePendingCommands.push_back(index);
+    commandCb(error, reply);
+    dispatchDeferred();
+}
+
+void AsyncCommandDispatcherPool::dispatchDeferred()
+{
+    if (!callbacksEnabled)
+        return;
+    if (dispatchingDeferred)
+    {
+        /* Command completed synchronously while sending deferred commands. */
+        redispatchDeferred = true;
+        return;
+    }
+    if (deferredCommands.empty())
+        return;
+    dispatchingDeferred = true;
+    do
+    {
+        redispatchDeferred = false;
+        /* Deferred commands are kept in order, a command is not sent before an earlier
+         * deferred command with a common slot. Sending may add new deferred commands to
+         * the end, thus the commands are indexed instead of iterated.
+         */
+        slotsOfEarlierDeferred.assign(ORDERING_SLOTS, false);
+        std::size_t i(0);
+        while (i < deferredCommands.size())
+        {
+            const auto& slots(deferredCommands[i].slots);
+            const bool blocked(std::any_of(slots.begin(), slots.end(),
+                                           [this](std::size_t slot) { return slotsOfEarlierDeferred[slot]; }));
+            std::size_t dispatcher(0);
+            if (blocked || !selectDispatcher(slots, dispatcher))
+            {
+                for (const auto& slot : slots)
+                    slotsOfEarlierDeferred[slot] = true;
+                ++i;
+                continue;
+            }
+            for (const auto& slot : slots)
+                --slotStates[slot].deferred;
+            auto command(std::move(deferredCommands[i]));
+            deferredCommands.erase(deferredCommands.begin() + i);
+            send(dispatcher, std::move(command.commandCb), command.ns, command.contents, command.slots);
+        }
+    }
+    while (redispatchDeferred && callbacksEnabled);
+    dispatchingDeferred = false;
+}
+
+void AsyncCommandDispatcherPool::cork()
+{
+    for (const auto& dispatcher : dispatchers)
+        dispatcher->cork();
+}
+
+void AsyncCommandDispatcherPool::uncork()
+{
+    for (const auto& dispatcher : dispatchers)
+        dispatcher->uncork();
+}
+
+void AsyncCommandDispatcherPool::disableCommandCallbacks()
+{
+    callbacksEnabled = false;
+    pendingCommands.clear();
+    freePendingCommands.clear();
+    deferredCommands.clear();
+    slotStates.assign(ORDERING_SLOTS, SlotState { 0, 0, 0 });
+    for (const auto& dispatcher : dispatchers)
+        dispatcher->disableCommandCallbacks();
+}
@@ -22,12 +22,14 @@
 #include "private/redis/asynchiredisclustercommanddispatcher.hpp"
 #include <algorithm>
 #include <cstring>
+#include <numeric>
 #include <cerrno>
 #include <sstream>
 #include "private/abort.hpp"
 #include "private/createlogger.hpp"
 #include "private/error.hpp"
 #include "private/logger.hpp"
+#include "private/probes.hpp"
 #include "private/redis/asyncredisreply.hpp"
 #include "private/redis/reply.hpp"
 #include "private/redis/hiredisclustersystem.hpp"
@@ -66,9 +68,11 @@ namespace
     {
         auto instance(static_cast<AsyncHiredisClusterCommandDispatcher*>(acc->data));
         auto reply(static_cast<redisReply*>(rr));
-        auto cb(static_cast<AsyncHiredisClusterCommandDispatcher::CommandCb*>(pd));
-        if (instance->isClientCallbacksEnabled())
-            instance->handleReply(*cb, getRedisError(acc->err, acc->errstr, reply), reply);
+        if (!instance->isClientCallbacksEnabled())
+            return;
+        const auto error(getRedisError(acc->err, acc->errstr, reply));
+        SHAREDDATALAYER_PROBE(command_reply, pd, error.value(), reply ? reply->type : 0);
+        instance->handleReply(pd, error, reply);
     }
 }
 
@@ -216,14 +220,14 @@ void AsyncHiredisClusterCommandDispatcher::registerDisconnectCb(const Disconnect
     disconnectCallback = disconnectCb;
 }
 
-void AsyncHiredisClusterCommandDispatcher::dispatchAsync(const CommandCb& commandCb,
+void AsyncHiredisClusterCommandDispatcher::dispatchAsync(CommandCb commandCb,
                                                          const AsyncConnection::Namespace& ns,
                                                          const Contents& contents)
 {
-    dispatchAsync(commandCb, ns, contents, true);
+    dispatchAsync(std::move(commandCb), ns, contents, true);
 }
 
-void AsyncHiredisClusterCommandDispatcher::dispatchAsync(const CommandCb& commandCb,
+void AsyncHiredisClusterCommandDispatcher::dispatchAsync(CommandCb commandCb,
                                                          const AsyncConnection::Namespace& ns,
                                                          const Contents& contents,
                                                          bool checkConnectionState)
@@ -232,26 +236,38 @@ void AsyncHiredisClusterCommandDispatcher::dispatchAsync(const CommandCb& comman
     {
         engine.postCallback(std::bind(&AsyncHiredisClusterCommandDispatcher::callCommandCbWithError,
                                        this,
-                                       commandCb,
+                                       std::move(commandCb),
                                        std::error_code(AsyncRedisCommandDispatcherErrorCode::NOT_CONNECTED)));
         return;
     }
-    cbs.push_back(commandCb);
-    std::vector<const char*> chars;
-    std::transform(contents.stack.begin(), contents.stack.end(),
-                   std::back_inserter(chars), [](const std::string& str){ return str.c_str(); });
-    if (hiredisClusterSystem.redisClusterAsyncCommandArgvWithKey(acc, cb, &cbs.back(), ns.c_str(), static_cast<int>(ns.size()),
-                                                                 static_cast<int>(contents.stack.size()), &chars[0],
-                                                                 &contents.sizes[0]) != REDIS_OK)
+    const auto handle(cbs.add(std::move(commandCb)));
+    SHAREDDATALAYER_PROBE(command_dispatch, handle, ns.c_str(), contents.stack.front(), contents.sizes.front(),
+                          contents.stack.size(), std::accumulate(contents.sizes.begin(), contents.sizes.end(), size_t(0)));
+    /* hiredis formats the arguments into its output buffer and does not modify them. */
+    if (hiredisClusterSystem.redisClusterAsyncCommandArgvWithKey(acc, cb, handle, ns.c_str(), static_cast<int>(ns.size()),
+                                                                 static_cast<int>(contents.stack.size()), const_cast<const char**>(contents.stack.data()),
+                                                                 contents.sizes.data()) != REDIS_OK)
     {
-        removeCb(cbs.back());
+        commandCb = std::move(*cbs.find(handle));
+        cbs.remove(handle);
         engine.postCallback(std::bind(&AsyncHiredisClusterCommandDispatcher::callCommandCbWithError,
                                        this,
-                                       commandCb,
+                                       std::move(commandCb),
                                        getRedisError(acc->err, acc->errstr, nullptr)));
     }
 }
 
+void AsyncHiredisClusterCommandDispatcher::cork()
+{
+    /* The cluster adapter always writes the commands in the output event handler,
+     * thus the commands are written together also without corking.
+     */
+}
+
+void AsyncHiredisClusterCommandDispatcher::uncork()
+{
+}
+
 void AsyncHiredisClusterCommandDispatcher::disableCommandCallbacks()
 {
     clientCallbacksEnabled = false;
@@ -280,18 +296,21 @@ void AsyncHiredisClusterCommandDispatcher::armConnectionRetryTimer()
 
 }
 
-void AsyncHiredisClusterCommandDispatcher::handleReply(const CommandCb& commandCb,
+void AsyncHiredisClusterCommandDispatcher::handleReply(CommandCbSlab::Handle handle,
                                                        const std::error_code& error,
                                                        const redisReply* rr)
 {
-    if (!isValidCb(commandCb))
+    auto commandCb(cbs.find(handle));
+    if (commandCb == nullptr)
         SHAREDDATALAYER_ABORT("Invalid callback function.");
+    SHAREDDATALAYER_PROBE(callback_start, handle);
     if (error)
-        commandCb(error, AsyncRedisReply());
+        (*commandCb)(error, AsyncRedisReply());
     else
-        commandCb(error, AsyncRedisReply(*rr));
+        (*commandCb)(error, AsyncRedisReply(*rr));
+    SHAREDDATALAYER_PROBE(callback_done, handle);
     if (!usePermanentCommandCallbacks)
-        removeCb(commandCb);
+        cbs.remove(handle);
 }
 
 bool AsyncHiredisClusterCommandDispatcher::isClientCallbacksEnabled() const
@@ -299,24 +318,6 @@ bool AsyncHiredisClusterCommandDispatcher::isClientCallbacksEnabled() const
     return clientCallbacksEnabled;
 }
 
-bool AsyncHiredisClusterCommandDispatcher::isValidCb(const CommandCb& commandCb)
-{
-    for (auto i(cbs.begin()); i != cbs.end(); ++i)
-        if (&*i == &commandCb)
-            return true;
-    return false;
-}
-
-void AsyncHiredisClusterCommandDispatcher::removeCb(const CommandCb& commandCb)
-{
-    for (auto i(cbs.begin()); i != cbs.end(); ++i)
-        if (&*i == &commandCb)
-        {
-            cbs.erase(i);
-            break;
-        }
-}
-
 void AsyncHiredisClusterCommandDispatcher::handleDisconnect(const redisAsyncContext* ac)
 {
     adapter->detach(ac);
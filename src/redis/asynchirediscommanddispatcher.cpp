@@ -22,6 +22,7 @@
 #include "private/redis/asynchirediscommanddispatcher.hpp"
 #include <algorithm>
 #include <cstring>
+#include <numeric>
 #include <cerrno>
 #include <sstream>
 #include <arpa/inet.h>
@@ -30,6 +31,7 @@
 #include "private/engine.hpp"
 #include "private/error.hpp"
 #include "private/logger.hpp"
+#include "private/probes.hpp"
 #include "private/redis/asyncredisreply.hpp"
 #include "private/redis/reply.hpp"
 #include "private/redis/hiredissystem.hpp"
@@ -74,9 +76,11 @@ namespace
     {
         auto instance(static_cast<AsyncHiredisCommandDispatcher*>(ac->data));
         auto reply(static_cast<redisReply*>(rr));
-        auto cb(static_cast<AsyncHiredisCommandDispatcher::CommandCb*>(pd));
-        if (instance->isClientCallbacksEnabled())
-            instance->handleReply(*cb, getRedisError(ac->err, ac->errstr, reply), reply);
+        if (!instance->isClientCallbacksEnabled())
+            return;
+        const auto error(getRedisError(ac->err, ac->errstr, reply));
+        SHAREDDATALAYER_PROBE(command_reply, pd, error.value(), reply ? reply->type : 0);
+        instance->handleReply(pd, error, reply);
     }
 }
 
@@ -173,6 +177,7 @@ void AsyncHiredisCommandDispatcher::verifyConnection()
                                 this,
                                 std::placeholders::_1,
                                 std::placeholders::_2),
+                      AsyncConnection::Namespace(),
                       contentsBuilder->build("COMMAND"),
                       false);
     }
@@ -219,14 +224,15 @@ void AsyncHiredisCommandDispatcher::registerDisconnectCb(const DisconnectCb& dis
     disconnectCallback = disconnectCb;
 }
 
-void AsyncHiredisCommandDispatcher::dispatchAsync(const CommandCb& commandCb,
-                                                  const AsyncConnection::Namespace&,
+void AsyncHiredisCommandDispatcher::dispatchAsync(CommandCb commandCb,
+                                                  const AsyncConnection::Namespace& ns,
                                                   const Contents& contents)
 {
-    dispatchAsync(commandCb, contents, true);
+    dispatchAsync(std::move(commandCb), ns, contents, true);
 }
 
-void AsyncHiredisCommandDispatcher::dispatchAsync(const CommandCb& commandCb,
+void AsyncHiredisCommandDispatcher::dispatchAsync(CommandCb commandCb,
+                                                  const AsyncConnection::Namespace& ns,
                                                   const Contents& contents,
                                                   bool checkConnectionState)
 {
@@ -234,25 +240,36 @@ void AsyncHiredisCommandDispatcher::dispatchAsync(const CommandCb& commandCb,
     {
         engine.postCallback(std::bind(&AsyncHiredisCommandDispatcher::callCommandCbWithError,
                                        this,
-                                       commandCb,
+                                       std::move(commandCb),
                                        std::error_code(AsyncRedisCommandDispatcherErrorCode::NOT_CONNECTED)));
         return;
     }
-    cbs.push_back(commandCb);
-    std::vector<const char*> chars;
-    std::transform(contents.stack.begin(), contents.stack.end(),
-                   std::back_inserter(chars), [](const std::string& str){ return str.c_str(); });
-    if (hiredisSystem.redisAsyncCommandArgv(ac, cb, &cbs.back(), static_cast<int>(contents.stack.size()),
-                                            &chars[0], &contents.sizes[0]) != REDIS_OK)
+    const auto handle(cbs.add(std::move(commandCb)));
+    SHAREDDATALAYER_PROBE(command_dispatch, handle, ns.c_str(), contents.stack.front(), contents.sizes.front(),
+                          contents.stack.size(), std::accumulate(contents.sizes.begin(), contents.sizes.end(), size_t(0)));
+    /* hiredis formats the arguments into its output buffer and does not modify them. */
+    if (hiredisSystem.redisAsyncCommandArgv(ac, cb, handle, static_cast<int>(contents.stack.size()),
+                                            const_cast<const char**>(contents.stack.data()), contents.sizes.data()) != REDIS_OK)
     {
-        removeCb(cbs.back());
+        commandCb = std::move(*cbs.find(handle));
+        cbs.remove(handle);
         engine.postCallback(std::bind(&AsyncHiredisCommandDispatcher::callCommandCbWithError,
                                        this,
-                                       commandCb,
+                                       std::move(commandCb),
                                        getRedisError(ac->err, ac->errstr, nullptr)));
     }
 }
 
+void AsyncHiredisCommandDispatcher::cork()
+{
+    adapter->cork();
+}
+
+void AsyncHiredisCommandDispatcher::uncork()
+{
+    adapter->uncork();
+}
+
 void AsyncHiredisCommandDispatcher::disableCommandCallbacks()
 {
     clientCallbacksEnabled = false;
@@ -286,18 +303,21 @@ void AsyncHiredisCommandDispatcher::setDisconnected()
                             std::bind(&AsyncHiredisCommandDispatcher::connect, this));
 }
 
-void AsyncHiredisCommandDispatcher::handleReply(const CommandCb& commandCb,
+void AsyncHiredisCommandDispatcher::handleReply(CommandCbSlab::Handle handle,
                                                 const std::error_code& error,
                                                 const redisReply* rr)
 {
-    if (!isValidCb(commandCb))
+    auto commandCb(cbs.find(handle));
+    if (commandCb == nullptr)
         SHAREDDATALAYER_ABORT("Invalid callback function.");
+    SHAREDDATALAYER_PROBE(callback_start, handle);
     if (error)
-        commandCb(error, AsyncRedisReply());
+        (*commandCb)(error, AsyncRedisReply());
     else
-        commandCb(error, AsyncRedisReply(*rr));
+        (*commandCb)(error, AsyncRedisReply(*rr));
+    SHAREDDATALAYER_PROBE(callback_done, handle);
     if (!usePermanentCommandCallbacks)
-        removeCb(commandCb);
+        cbs.remove(handle);
 }
 
 bool AsyncHiredisCommandDispatcher::isClientCallbacksEnabled() const
@@ -305,24 +325,6 @@ bool AsyncHiredisCommandDispatcher::isClientCallbacksEnabled() const
     return clientCallbacksEnabled;
 }
 
-bool AsyncHiredisCommandDispatcher::isValidCb(const CommandCb& commandCb)
-{
-    for (auto i(cbs.begin()); i != cbs.end(); ++i)
-        if (&*i == &commandCb)
-            return true;
-    return false;
-}
-
-void AsyncHiredisCommandDispatcher::removeCb(const CommandCb& commandCb)
-{
-    for (auto i(cbs.begin()); i != cbs.end(); ++i)
-        if (&*i == &commandCb)
-        {
-            cbs.erase(i);
-            break;
-        }
-}
-
 void AsyncHiredisCommandDispatcher::disconnectHiredis()
 {
     /* hiredis sometimes crashes if redisAsyncFree is called without being connected (even
@@ -24,26 +24,41 @@
 using namespace shareddatalayer;
 using namespace shareddatalayer::redis;
 
+namespace
+{
+    /* Empty string given for the replies which do not contain a string. */
+    const char emptyString[] = "";
+
+    Reply::Type mapType(int type)
+    {
+        switch (type)
+        {
+            case REDIS_REPLY_INTEGER:
+                return Reply::Type::INTEGER;
+            case REDIS_REPLY_STATUS:
+                return Reply::Type::STATUS;
+            case REDIS_REPLY_STRING:
+                return Reply::Type::STRING;
+            case REDIS_REPLY_ARRAY:
+                return Reply::Type::ARRAY;
+            case REDIS_REPLY_NIL:
+            default:
+                return Reply::Type::NIL;
+        }
+    }
+}
+
 AsyncRedisReply::AsyncRedisReply():
+    rr(nullptr),
     type(Type::NIL),
-    integer(0),
-    dataItem { { }, 0 }
+    dataItem { emptyString, 0 }
 {
 }
 
 AsyncRedisReply::AsyncRedisReply(const redisReply& rr):
-    integer(0),
-    dataItem { { }, 0 },
-    typeMap { { REDIS_REPLY_NIL, Type::NIL }, { REDIS_REPLY_INTEGER, Type::INTEGER },
-              { REDIS_REPLY_STATUS, Type::STATUS }, { REDIS_REPLY_STRING, Type::STRING },
-              { REDIS_REPLY_ARRAY, Type::ARRAY } }
+    AsyncRedisReply()
 {
-    auto res(typeMap.find(rr.type));
-    if (res != typeMap.end())
-    {
-        type = res->second;
-        parseReply(rr);
-    }
+    setReply(rr);
 }
 
 AsyncRedisReply::Type AsyncRedisReply::getType() const
@@ -53,7 +68,9 @@ AsyncRedisReply::Type AsyncRedisReply::getType() const
 
 long long AsyncRedisReply::getInteger() const
 {
-    return integer;
+    if (type == Type::INTEGER)
+        return rr->integer;
+    return 0;
 }
 
 const AsyncRedisReply::DataItem* AsyncRedisReply::getString() const
@@ -63,32 +80,27 @@ const AsyncRedisReply::DataItem* AsyncRedisReply::getString() const
 
 const AsyncRedisReply::ReplyVector* AsyncRedisReply::getArray() const
 {
+    if ((type == Type::ARRAY) && !elements && (rr->elements > 0))
+        parseArray();
     return &replyVector;
 }
 
-void AsyncRedisReply::parseReply(const redisReply& rr)
+void AsyncRedisReply::setReply(const redisReply& rr)
 {
-    switch (type)
-    {
-        case Type::INTEGER:
-            integer = rr.integer;
-            break;
-        case Type::STATUS:
-        case Type::STRING:
-            dataItem.str = std::string(rr.str, static_cast<size_t>(rr.len));
-            dataItem.len = rr.len;
-            break;
-        case Type::ARRAY:
-            parseArray(rr);
-            break;
-        case Type::NIL:
-        default:
-            break;
-    }
+    this->rr = &rr;
+    type = mapType(rr.type);
+    if ((type == Type::STATUS) || (type == Type::STRING))
+        dataItem = DataItem { rr.str, rr.len };
 }
 
-void AsyncRedisReply::parseArray(const redisReply& rr)
+void AsyncRedisReply::parseArray() const
 {
-    for (auto i(0U); i < rr.elements; ++i)
-        replyVector.push_back(std::make_shared<AsyncRedisReply>(*rr.element[i]));
+    const auto count(static_cast<size_t>(rr->elements));
+    elements.reset(new AsyncRedisReply[count]);
+    replyVector.reserve(count);
+    for (size_t i(0); i < count; ++i)
+    {
+        elements[i].setReply(*rr->element[i]);
+        replyVector.push_back(&elements[i]);
+    }
 }
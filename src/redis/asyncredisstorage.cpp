@@ -20,6 +20,8 @@
 */
 
 #include "config.h"
+#include <algorithm>
+#include <cstdlib>
 #include <sstream>
 #include "private/error.hpp"
 #include <sdl/emptynamespace.hpp>
@@ -29,15 +31,20 @@
 #include "private/createlogger.hpp"
 #include "private/engine.hpp"
 #include "private/logger.hpp"
+#include "private/nearcache.hpp"
 #include "private/namespacevalidator.hpp"
+#include "private/operationdeadline.hpp"
 #include "private/configurationreader.hpp"
+#include "private/system.hpp"
 #include "private/redis/asynccommanddispatcher.hpp"
+#include "private/redis/asynccommanddispatcherpool.hpp"
 #include "private/redis/asyncdatabasediscovery.hpp"
 #include "private/redis/asyncredisstorage.hpp"
 #include "private/redis/contents.hpp"
 #include "private/redis/contentsbuilder.hpp"
 #include "private/redis/redisgeneral.hpp"
 #include "private/redis/reply.hpp"
+#include "private/redis/script.hpp"
 
 using namespace shareddatalayer;
 using namespace shareddatalayer::redis;
@@ -52,14 +59,26 @@ namespace
     std::shared_ptr<AsyncCommandDispatcher> asyncCommandDispatcherCreator(Engine& engine,
                                                                           const DatabaseInfo& databaseInfo,
                                                                           std::shared_ptr<ContentsBuilder> contentsBuilder,
-                                                                          std::shared_ptr<Logger> logger)
+                                                                          std::shared_ptr<Logger> logger,
+                                                                          bool usePermanentCommandCallbacks)
     {
-        return AsyncCommandDispatcher::create(engine,
-                                              databaseInfo,
-                                              contentsBuilder,
-                                              false,
-                                              logger,
-                                              false);
+        const auto poolSize(usePermanentCommandCallbacks ? 1 : AsyncCommandDispatcherPool::getSize(System::getSystem()));
+        if (poolSize == 1)
+            return AsyncCommandDispatcher::create(engine,
+                                                  databaseInfo,
+                                                  contentsBuilder,
+                                                  usePermanentCommandCallbacks,
+                                                  logger,
+                                                  false);
+        AsyncCommandDispatcherPool::Dispatchers dispatchers;
+        for (std::size_t i(0); i < poolSize; ++i)
+            dispatchers.push_back(AsyncCommandDispatcher::create(engine,
+                                                                 databaseInfo,
+                                                                 contentsBuilder,
+                                                                 false,
+                                                                 logger,
+                                                                 false));
+        return std::make_shared<AsyncCommandDispatcherPool>(dispatchers);
     }
 
     class AsyncRedisStorageErrorCategory: public std::error_category
@@ -89,6 +108,8 @@ namespace
                 return "connection to the underlying data storage not yet available";
             case AsyncRedisStorage::ErrorCode::INVALID_NAMESPACE:
                 return "invalid namespace identifier passed to SDL API";
+            case AsyncRedisStorage::ErrorCode::OPERATION_TIMEOUT:
+                return "operation did not complete before the deadline";
             case AsyncRedisStorage::ErrorCode::END_MARKER:
                 logErrorOnce("AsyncRedisStorage::ErrorCode::END_MARKER is not meant to be queried (it is only for enum loop control)");
                 return "unsupported error code for message()";
@@ -107,6 +128,8 @@ namespace
                 return InternalError::SDL_NOT_READY;
             case AsyncRedisStorage::ErrorCode::INVALID_NAMESPACE:
                 return InternalError::SDL_RECEIVED_INVALID_PARAMETER;
+            case AsyncRedisStorage::ErrorCode::OPERATION_TIMEOUT:
+                return InternalError::BACKEND_REPLY_TIMEOUT;
             case AsyncRedisStorage::ErrorCode::END_MARKER:
                 logErrorOnce("AsyncRedisStorage::ErrorCode::END_MARKER is not meant to be mapped to InternalError (it is only for enum loop control)");
                 return InternalError::SDL_ERROR_CODE_LOGIC_ERROR;
@@ -127,22 +150,52 @@ namespace
         {
             if (replyVector[i]->getType() == Reply::Type::STRING)
             {
-                AsyncStorage::Data data;
                 auto dataStr(replyVector[i]->getString());
-                for (ReplyStringLength k(0); k < dataStr->len; ++k)
-                    data.push_back(static_cast<uint8_t>(dataStr->str[static_cast<size_t>(k)]));
-                dataMap.insert({ j, data });
+                const auto begin(reinterpret_cast<const uint8_t*>(dataStr->str));
+                dataMap.insert({ j, AsyncStorage::Data(begin, begin + dataStr->len) });
             }
             ++i;
         }
         return dataMap;
     }
 
+    AsyncStorage::DataView getDataView(const Reply::DataItem& item)
+    {
+        return AsyncStorage::DataView { reinterpret_cast<const uint8_t*>(item.str), static_cast<size_t>(item.len) };
+    }
+
+    AsyncStorage::DataViews buildDataViews(const AsyncStorage::Keys& keys, const Reply::ReplyVector& replyVector)
+    {
+        AsyncStorage::DataViews dataViews;
+        dataViews.reserve(keys.size());
+        auto i(0U);
+        for (const auto& j : keys)
+        {
+            if (replyVector[i]->getType() == Reply::Type::STRING)
+                dataViews.push_back({ &j, getDataView(*replyVector[i]->getString()) });
+            ++i;
+        }
+        return dataViews;
+    }
+
+    void visitData(const AsyncStorage::Keys& keys, const Reply::ReplyVector& replyVector, const AsyncStorage::DataVisitor& dataVisitor)
+    {
+        auto i(0U);
+        for (const auto& j : keys)
+        {
+            if (replyVector[i]->getType() == Reply::Type::STRING)
+                dataVisitor(j, getDataView(*replyVector[i]->getString()));
+            ++i;
+        }
+    }
+
     AsyncStorage::Key getKey(const Reply::DataItem& item)
     {
-        std::string str(item.str.c_str(), static_cast<size_t>(item.len));
-        auto res(str.find(AsyncRedisStorage::SEPARATOR));
-        return str.substr(res + 1);
+        const auto end(item.str + item.len);
+        const auto res(std::find(item.str, end, AsyncRedisStorage::SEPARATOR));
+        if (res == end)
+            return AsyncStorage::Key(item.str, end);
+        return AsyncStorage::Key(res + 1, end);
     }
 
     AsyncStorage::Keys getKeys(const Reply::ReplyVector& replyVector)
@@ -156,6 +209,101 @@ namespace
         return keys;
     }
 
+    void getCommandCallback(const std::error_code& error,
+                            const Reply& reply,
+                            const AsyncStorage::GetAck& getAck,
+                            const AsyncStorage::Keys& keys)
+    {
+        if (error)
+            getAck(error, AsyncStorage::DataMap());
+        else
+            getAck(std::error_code(), buildDataMap(keys, *reply.getArray()));
+    }
+
+    void getViewsCommandCallback(const std::error_code& error,
+                                 const Reply& reply,
+                                 const AsyncStorage::GetViewsAck& getViewsAck,
+                                 const AsyncStorage::Keys& keys)
+    {
+        if (error)
+            getViewsAck(error, AsyncStorage::DataViews());
+        else
+            getViewsAck(std::error_code(), buildDataViews(keys, *reply.getArray()));
+    }
+
+    void visitCommandCallback(const std::error_code& error,
+                              const Reply& reply,
+                              const AsyncStorage::DataVisitor& dataVisitor,
+                              const AsyncStorage::GetVisitAck& getVisitAck,
+                              const std::shared_ptr<const AsyncStorage::Keys>& keys)
+    {
+        if (!error)
+            visitData(*keys, *reply.getArray(), dataVisitor);
+        getVisitAck(error);
+    }
+
+    /* Executes the operations of a WriteBatch. KEYS are the keys of the operations in
+     * order. ARGV[1] is the channel to publish a notification on (empty if notifications
+     * are not enabled) and ARGV[2] the message. Then each operation has a code followed
+     * by its arguments: "set" and "del" the number of keys (and "set" the data for each
+     * key), "setie" the old and the new data, "setnx" and "delie" the data. Returns the
+     * status (1 or 0) of each operation.
+     */
+    const Script writeBatchScript(R"(
+local k, a = 1, 3
+local statuses = {}
+local modified = false
+while a <= #ARGV do
+    local op = ARGV[a]
+    local status = 1
+    if op == 'set' then
+        local n = tonumber(ARGV[a + 1])
+        for i = 0, n - 1 do
+            redis.call('SET', KEYS[k + i], ARGV[a + 2 + i])
+        end
+        modified = modified or n > 0
+        k, a = k + n, a + 2 + n
+    elseif op == 'del' then
+        local n = tonumber(ARGV[a + 1])
+        for i = 0, n - 1 do
+            redis.call('DEL', KEYS[k + i])
+        end
+        modified = modified or n > 0
+        k, a = k + n, a + 2
+    elseif op == 'setie' then
+        if redis.call('GET', KEYS[k]) == ARGV[a + 1] then
+            redis.call('SET', KEYS[k], ARGV[a + 2])
+            modified = true
+        else
+            status = 0
+        end
+        k, a = k + 1, a + 3
+    elseif op == 'setnx' then
+        status = redis.call('SETNX', KEYS[k], ARGV[a + 1])
+        modified = modified or status == 1
+        k, a = k + 1, a + 2
+    else
+        if redis.call('GET', KEYS[k]) == ARGV[a + 1] then
+            redis.call('DEL', KEYS[k])
+            modified = true
+        else
+            status = 0
+        end
+        k, a = k + 1, a + 2
+    end
+    statuses[#statuses + 1] = status
+end
+if modified and ARGV[1] ~= '' then
+    redis.call('PUBLISH', ARGV[1], ARGV[2])
+end
+return statuses
+)");
+
+    std::string toString(const AsyncStorage::Data& data)
+    {
+        return std::string(data.begin(), data.end());
+    }
+
     void escapeRedisSearchPatternCharacters(std::string& stringToProcess)
     {
         const std::string redisSearchPatternCharacters = R"(*?[]\)";
@@ -189,6 +337,35 @@ const std::error_category& AsyncRedisStorage::errorCategory() noexcept
     return theAsyncRedisStorageErrorCategory;
 }
 
+constexpr std::size_t AsyncRedisStorage::DEFAULT_SCAN_COUNT;
+constexpr std::size_t AsyncRedisStorage::DEFAULT_REMOVE_BATCH_SIZE;
+
+struct AsyncRedisStorage::ScanKeys
+{
+    Namespace ns;
+    std::string keyPattern;
+    std::string count;
+    ScanKeysAck scanKeysAck;
+};
+
+struct AsyncRedisStorage::NearCacheRead
+{
+    Keys missing;
+    DataMap cached;
+    std::shared_ptr<NearCache> nearCache;
+    NearCache::Generation generation;
+};
+
+struct AsyncRedisStorage::Removal
+{
+    Namespace ns;
+    ModifyAck modifyAck;
+    /* Number of ongoing requests, including the scan until its last page. */
+    std::size_t pending;
+    bool keysRemoved;
+    std::error_code error;
+};
+
 AsyncRedisStorage::AsyncRedisStorage(std::shared_ptr<Engine> engine,
                                      std::shared_ptr<AsyncDatabaseDiscovery> discovery,
                                      const boost::optional<PublisherId>& pId,
@@ -200,7 +377,8 @@ AsyncRedisStorage::AsyncRedisStorage(std::shared_ptr<Engine> engine,
                       namespaceConfigurations,
                       ::asyncCommandDispatcherCreator,
                       std::make_shared<redis::ContentsBuilder>(SEPARATOR),
-                      logger)
+                      logger,
+                      getRemoveBatchSize(System::getSystem()))
 {
 }
 
@@ -210,7 +388,8 @@ AsyncRedisStorage::AsyncRedisStorage(std::shared_ptr<Engine> engine,
                                      std::shared_ptr<NamespaceConfigurations> namespaceConfigurations,
                                      const AsyncCommandDispatcherCreator& asyncCommandDispatcherCreator,
                                      std::shared_ptr<redis::ContentsBuilder> contentsBuilder,
-                                     std::shared_ptr<Logger> logger):
+                                     std::shared_ptr<Logger> logger,
+                                     std::size_t removeBatchSize):
     engine(engine),
     dispatcher(nullptr),
     discovery(discovery),
@@ -218,7 +397,13 @@ AsyncRedisStorage::AsyncRedisStorage(std::shared_ptr<Engine> engine,
     asyncCommandDispatcherCreator(asyncCommandDispatcherCreator),
     contentsBuilder(contentsBuilder),
     namespaceConfigurations(namespaceConfigurations),
-    logger(logger)
+    logger(logger),
+    operationTimeout(std::chrono::steady_clock::duration::zero()),
+    removeBatchSize(removeBatchSize),
+    subscriberConnected(false),
+    notifications(std::make_shared<Notifications>()),
+    alive(std::make_shared<bool>(true)),
+    nearCacheUsed(namespaceConfigurations->isNearCacheUsed())
 {
     if(publisherId && (*publisherId).empty())
     {
@@ -237,6 +422,20 @@ AsyncRedisStorage::~AsyncRedisStorage()
         discovery->clearStateChangedCb();
     if (dispatcher)
         dispatcher->disableCommandCallbacks();
+    if (subscriber)
+        subscriber->disableCommandCallbacks();
+}
+
+std::size_t AsyncRedisStorage::getRemoveBatchSize(System& system)
+{
+    const auto envStr(system.getenv(DB_REMOVE_BATCH_SIZE_ENV_VAR_NAME));
+    if (!envStr)
+        return DEFAULT_REMOVE_BATCH_SIZE;
+    char* end(nullptr);
+    const auto size(std::strtoul(envStr, &end, 10));
+    if (end == envStr || *end != '\0' || size == 0)
+        return DEFAULT_REMOVE_BATCH_SIZE;
+    return size;
 }
 
 redis::DatabaseInfo& AsyncRedisStorage::getDatabaseInfo()
@@ -249,7 +448,8 @@ void AsyncRedisStorage::serviceStateChanged(const redis::DatabaseInfo& newDataba
     dispatcher = asyncCommandDispatcherCreator(*engine,
                                                newDatabaseInfo,
                                                contentsBuilder,
-                                               logger);
+                                               logger,
+                                               false);
     if (readyAck)
         dispatcher->waitConnectedAsync([this]()
                                        {
@@ -257,6 +457,11 @@ void AsyncRedisStorage::serviceStateChanged(const redis::DatabaseInfo& newDataba
                                            readyAck = ReadyAck();
                                        });
     dbInfo = newDatabaseInfo;
+    if (subscriber)
+    {
+        subscriber->disableCommandCallbacks();
+        createSubscriber();
+    }
 }
 
 int AsyncRedisStorage::fd() const
@@ -269,6 +474,46 @@ void AsyncRedisStorage::handleEvents()
     engine->handleEvents();
 }
 
+void AsyncRedisStorage::getStatisticsAsync(const GetStatisticsAck& getStatisticsAck)
+{
+    /* Statistics are collected by AsyncStorageImpl. */
+    engine->postCallback(std::bind(getStatisticsAck, Statistics()));
+}
+
+void AsyncRedisStorage::setOperationTimeout(const std::chrono::steady_clock::duration& timeout)
+{
+    operationTimeout = timeout;
+}
+
+template <typename Ack, typename... Args>
+Ack AsyncRedisStorage::withDeadline(const Ack& ack, const Args&... timeoutArgs)
+{
+    if (operationTimeout == std::chrono::steady_clock::duration::zero())
+        return ack;
+    return OperationDeadline::create(*engine, operationTimeout)->wrap(ack,
+                                                                      std::error_code(ErrorCode::OPERATION_TIMEOUT),
+                                                                      timeoutArgs...);
+}
+
+template <typename CommandCb>
+void AsyncRedisStorage::dispatchCommand(CommandCb&& commandCb, const Namespace& ns, const Contents& contents)
+{
+    static_assert(AsyncCommandDispatcher::CommandCb::isStoredInline<CommandCb>(),
+                  "Command callback does not fit in AsyncCommandDispatcher::CommandCb");
+    dispatcher->dispatchAsync(std::forward<CommandCb>(commandCb), ns, contents);
+}
+
+template <typename CommandCb>
+void AsyncRedisStorage::dispatchScript(CommandCb&& commandCb,
+                                       const Namespace& ns,
+                                       const Script& script,
+                                       const Contents& contents)
+{
+    static_assert(AsyncCommandDispatcher::CommandCb::isStoredInline<CommandCb>(),
+                  "Command callback does not fit in AsyncCommandDispatcher::CommandCb");
+    dispatcher->dispatchScriptAsync(std::forward<CommandCb>(commandCb), ns, script, contents);
+}
+
 bool AsyncRedisStorage::canOperationBePerformed(const Namespace& ns,
                                                 boost::optional<bool> noKeysGiven,
                                                 std::error_code& ecToReturn)
@@ -318,22 +563,25 @@ void AsyncRedisStorage::setAsync(const Namespace& ns,
         return;
     }
 
+    const auto ack(withDeadline(modifyAck));
+    invalidateNearCache(ns, dataMap);
+
     if (namespaceConfigurations->areNotificationsEnabled(ns))
-        dispatcher->dispatchAsync(std::bind(&AsyncRedisStorage::modificationCommandCallback,
-                                            this,
-                                            std::placeholders::_1,
-                                            std::placeholders::_2,
-                                            modifyAck),
-                                  ns,
-                                  contentsBuilder->build("MSETPUB", ns, dataMap, ns, getPublishMessage()));
+        dispatchCommand(std::bind(&AsyncRedisStorage::modificationCommandCallback,
+                                  this,
+                                  std::placeholders::_1,
+                                  std::placeholders::_2,
+                                  ack),
+                        ns,
+                        contentsBuilder->build("MSETPUB", ns, dataMap, ns, getPublishMessage()));
     else
-        dispatcher->dispatchAsync(std::bind(&AsyncRedisStorage::modificationCommandCallback,
-                                            this,
-                                            std::placeholders::_1,
-                                            std::placeholders::_2,
-                                            modifyAck),
-                                  ns,
-                                  contentsBuilder->build("MSET", ns, dataMap));
+        dispatchCommand(std::bind(&AsyncRedisStorage::modificationCommandCallback,
+                                  this,
+                                  std::placeholders::_1,
+                                  std::placeholders::_2,
+                                  ack),
+                        ns,
+                        contentsBuilder->build("MSET", ns, dataMap));
 }
 
 void AsyncRedisStorage::modificationCommandCallback(const std::error_code& error,
@@ -370,22 +618,25 @@ void AsyncRedisStorage::setIfAsync(const Namespace& ns,
         return;
     }
 
+    const auto ack(withDeadline(modifyIfAck, false));
+    invalidateNearCache(ns, { key });
+
     if (namespaceConfigurations->areNotificationsEnabled(ns))
-        dispatcher->dispatchAsync(std::bind(&AsyncRedisStorage::conditionalCommandCallback,
-                                            this,
-                                            std::placeholders::_1,
-                                            std::placeholders::_2,
-                                            modifyIfAck),
-                                  ns,
-                                  contentsBuilder->build("SETIEPUB", ns, key, newData, oldData, ns, getPublishMessage()));
+        dispatchCommand(std::bind(&AsyncRedisStorage::conditionalCommandCallback,
+                                  this,
+                                  std::placeholders::_1,
+                                  std::placeholders::_2,
+                                  ack),
+                        ns,
+                        contentsBuilder->build("SETIEPUB", ns, key, newData, oldData, ns, getPublishMessage()));
     else
-        dispatcher->dispatchAsync(std::bind(&AsyncRedisStorage::conditionalCommandCallback,
-                                            this,
-                                            std::placeholders::_1,
-                                            std::placeholders::_2,
-                                            modifyIfAck),
-                                  ns,
-                                  contentsBuilder->build("SETIE", ns, key, newData, oldData));
+        dispatchCommand(std::bind(&AsyncRedisStorage::conditionalCommandCallback,
+                                  this,
+                                  std::placeholders::_1,
+                                  std::placeholders::_2,
+                                  ack),
+                        ns,
+                        contentsBuilder->build("SETIE", ns, key, newData, oldData));
 }
 
 void AsyncRedisStorage::removeIfAsync(const Namespace& ns,
@@ -401,22 +652,25 @@ void AsyncRedisStorage::removeIfAsync(const Namespace& ns,
         return;
     }
 
+    const auto ack(withDeadline(modifyIfAck, false));
+    invalidateNearCache(ns, { key });
+
     if (namespaceConfigurations->areNotificationsEnabled(ns))
-        dispatcher->dispatchAsync(std::bind(&AsyncRedisStorage::conditionalCommandCallback,
-                                            this,
-                                            std::placeholders::_1,
-                                            std::placeholders::_2,
-                                            modifyIfAck),
-                                  ns,
-                                  contentsBuilder->build("DELIEPUB", ns, key, data, ns, getPublishMessage()));
+        dispatchCommand(std::bind(&AsyncRedisStorage::conditionalCommandCallback,
+                                  this,
+                                  std::placeholders::_1,
+                                  std::placeholders::_2,
+                                  ack),
+                        ns,
+                        contentsBuilder->build("DELIEPUB", ns, key, data, ns, getPublishMessage()));
     else
-        dispatcher->dispatchAsync(std::bind(&AsyncRedisStorage::conditionalCommandCallback,
-                                            this,
-                                            std::placeholders::_1,
-                                            std::placeholders::_2,
-                                            modifyIfAck),
-                                  ns,
-                                  contentsBuilder->build("DELIE", ns, key, data));
+        dispatchCommand(std::bind(&AsyncRedisStorage::conditionalCommandCallback,
+                                  this,
+                                  std::placeholders::_1,
+                                  std::placeholders::_2,
+                                  ack),
+                        ns,
+                        contentsBuilder->build("DELIE", ns, key, data));
 }
 
 std::string AsyncRedisStorage::getPublishMessage() const
@@ -440,22 +694,25 @@ void AsyncRedisStorage::setIfNotExistsAsync(const Namespace& ns,
         return;
     }
 
+    const auto ack(withDeadline(modifyIfAck, false));
+    invalidateNearCache(ns, { key });
+
     if (namespaceConfigurations->areNotificationsEnabled(ns))
-        dispatcher->dispatchAsync(std::bind(&AsyncRedisStorage::conditionalCommandCallback,
-                                            this,
-                                            std::placeholders::_1,
-                                            std::placeholders::_2,
-                                            modifyIfAck),
-                                  ns,
-                                  contentsBuilder->build("SETNXPUB", ns, key, data, ns ,getPublishMessage()));
+        dispatchCommand(std::bind(&AsyncRedisStorage::conditionalCommandCallback,
+                                  this,
+                                  std::placeholders::_1,
+                                  std::placeholders::_2,
+                                  ack),
+                        ns,
+                        contentsBuilder->build("SETNXPUB", ns, key, data, ns ,getPublishMessage()));
     else
-        dispatcher->dispatchAsync(std::bind(&AsyncRedisStorage::conditionalCommandCallback,
-                                            this,
-                                            std::placeholders::_1,
-                                            std::placeholders::_2,
-                                            modifyIfAck),
-                                  ns,
-                                  contentsBuilder->build("SETNX", ns, key, data));
+        dispatchCommand(std::bind(&AsyncRedisStorage::conditionalCommandCallback,
+                                  this,
+                                  std::placeholders::_1,
+                                  std::placeholders::_2,
+                                  ack),
+                        ns,
+                        contentsBuilder->build("SETNX", ns, key, data));
 }
 
 void AsyncRedisStorage::getAsync(const Namespace& ns,
@@ -470,16 +727,77 @@ void AsyncRedisStorage::getAsync(const Namespace& ns,
         return;
     }
 
-    dispatcher->dispatchAsync([getAck, keys](const std::error_code& error,
-                                                 const Reply& reply)
-                              {
-                                  if (error)
-                                      getAck(error, DataMap());
-                                  else
-                                      getAck(std::error_code(), buildDataMap(keys, *reply.getArray()));
-                              },
-                              ns,
-                              contentsBuilder->build("MGET", ns, keys));
+    const auto nearCache(getNearCache(ns));
+    if (nearCache)
+    {
+        getFromNearCacheAsync(ns, keys, getAck, nearCache);
+        return;
+    }
+
+    auto ack(withDeadline(getAck, DataMap()));
+
+    dispatchCommand(std::bind(&getCommandCallback,
+                              std::placeholders::_1,
+                              std::placeholders::_2,
+                              std::move(ack),
+                              keys),
+                    ns,
+                    contentsBuilder->build("MGET", ns, keys));
+}
+
+void AsyncRedisStorage::getViewsAsync(const Namespace& ns,
+                                      const Keys& keys,
+                                      const GetViewsAck& getViewsAck)
+{
+    std::error_code ec;
+
+    if (!canOperationBePerformed(ns, keys.empty(), ec))
+    {
+        engine->postCallback(std::bind(getViewsAck, ec, DataViews()));
+        return;
+    }
+
+    auto ack(withDeadline(getViewsAck, DataViews()));
+
+    dispatchCommand(std::bind(&getViewsCommandCallback,
+                              std::placeholders::_1,
+                              std::placeholders::_2,
+                              std::move(ack),
+                              keys),
+                    ns,
+                    contentsBuilder->build("MGET", ns, keys));
+}
+
+void AsyncRedisStorage::getViewsAsync(const Namespace& ns,
+                                      const Keys& keys,
+                                      const DataVisitor& dataVisitor,
+                                      const GetVisitAck& getVisitAck)
+{
+    std::error_code ec;
+
+    if (!canOperationBePerformed(ns, keys.empty(), ec))
+    {
+        engine->postCallback(std::bind(getVisitAck, ec));
+        return;
+    }
+
+    auto visitor(dataVisitor);
+    auto ack(getVisitAck);
+    if (operationTimeout != std::chrono::steady_clock::duration::zero())
+    {
+        const auto deadline(OperationDeadline::create(*engine, operationTimeout));
+        visitor = deadline->guard(dataVisitor);
+        ack = deadline->wrap(getVisitAck, std::error_code(ErrorCode::OPERATION_TIMEOUT));
+    }
+
+    dispatchCommand(std::bind(&visitCommandCallback,
+                              std::placeholders::_1,
+                              std::placeholders::_2,
+                              visitor,
+                              ack,
+                              std::make_shared<const Keys>(keys)),
+                    ns,
+                    contentsBuilder->build("MGET", ns, keys));
 }
 
 void AsyncRedisStorage::removeAsync(const Namespace& ns,
@@ -494,29 +812,92 @@ void AsyncRedisStorage::removeAsync(const Namespace& ns,
         return;
     }
 
+    const auto ack(withDeadline(modifyAck));
+    invalidateNearCache(ns, keys);
+
     if (namespaceConfigurations->areNotificationsEnabled(ns))
-        dispatcher->dispatchAsync(std::bind(&AsyncRedisStorage::modificationCommandCallback,
-                                            this,
-                                            std::placeholders::_1,
-                                            std::placeholders::_2,
-                                            modifyAck),
-                                  ns,
-                                  contentsBuilder->build("DELPUB", ns, keys, ns, getPublishMessage()));
+        dispatchCommand(std::bind(&AsyncRedisStorage::modificationCommandCallback,
+                                  this,
+                                  std::placeholders::_1,
+                                  std::placeholders::_2,
+                                  ack),
+                        ns,
+                        contentsBuilder->build("DELPUB", ns, keys, ns, getPublishMessage()));
     else
-        dispatcher->dispatchAsync(std::bind(&AsyncRedisStorage::modificationCommandCallback,
-                                            this,
-                                            std::placeholders::_1,
-                                            std::placeholders::_2,
-                                            modifyAck),
-                                  ns,
-                                  contentsBuilder->build("DEL", ns, keys));
+        dispatchCommand(std::bind(&AsyncRedisStorage::modificationCommandCallback,
+                                  this,
+                                  std::placeholders::_1,
+                                  std::placeholders::_2,
+                                  ack),
+                        ns,
+                        contentsBuilder->build("DEL", ns, keys));
+}
+
+void AsyncRedisStorage::scanKeys(const Namespace& ns,
+                                 const std::string& keyPattern,
+                                 const std::string& count,
+                                 const ScanKeysAck& scanKeysAck)
+{
+    scanKeysPage(std::make_shared<const ScanKeys>(ScanKeys { ns, keyPattern, count, scanKeysAck }), "0");
+}
+
+void AsyncRedisStorage::scanKeysPage(const std::shared_ptr<const ScanKeys>& scan, const std::string& cursor)
+{
+    auto ack(withDeadline(scan->scanKeysAck, Keys(), ScanKeysNext()));
+
+    dispatchCommand([this, scan, ack](const std::error_code& error,
+                                      const Reply& reply)
+                    {
+                        if (error)
+                        {
+                            ack(error, Keys(), ScanKeysNext());
+                            return;
+                        }
+                        const auto& array(*reply.getArray());
+                        const auto nextCursor(array[0]->getString()->toString());
+                        ScanKeysNext next;
+                        if (nextCursor != "0")
+                        {
+                            const std::weak_ptr<bool> weakAlive(alive);
+                            next = [this, weakAlive, scan, nextCursor]()
+                                   {
+                                       if (weakAlive.expired())
+                                           scan->scanKeysAck(std::error_code(ErrorCode::REDIS_NOT_YET_DISCOVERED),
+                                                             Keys(),
+                                                             ScanKeysNext());
+                                       else
+                                           scanKeysPage(scan, nextCursor);
+                                   };
+                        }
+                        ack(std::error_code(), getKeys(*array[1]->getArray()), next);
+                    },
+                    scan->ns,
+                    contentsBuilder->build("SCAN", cursor, "MATCH", scan->keyPattern, "COUNT", scan->count));
+}
+
+void AsyncRedisStorage::scanKeysAsync(const Namespace& ns,
+                                      const std::string& pattern,
+                                      std::size_t countHint,
+                                      const ScanKeysAck& scanKeysAck)
+{
+    std::error_code ec;
+
+    if (!canOperationBePerformed(ns, boost::none, ec))
+    {
+        engine->postCallback(std::bind(scanKeysAck, ec, Keys(), ScanKeysNext()));
+        return;
+    }
+
+    scanKeys(ns,
+             buildNamespaceKeySearchPattern(ns, pattern),
+             std::to_string(countHint ? countHint : DEFAULT_SCAN_COUNT),
+             scanKeysAck);
 }
 
 void AsyncRedisStorage::findKeys(const Namespace& ns,
                                  const std::string& keyPattern,
                                  const FindKeysAck& findKeysAck)
 {
-    //TODO: update to more optimal solution than current KEYS-based one.
     std::error_code ec;
 
     if (!canOperationBePerformed(ns, boost::none, ec))
@@ -525,15 +906,26 @@ void AsyncRedisStorage::findKeys(const Namespace& ns,
         return;
     }
 
-    dispatcher->dispatchAsync([findKeysAck](const std::error_code& error, const Reply& reply)
-                              {
-                                  if (error)
-                                      findKeysAck(error, Keys());
-                                  else
-                                      findKeysAck(std::error_code(), getKeys(*reply.getArray()));
-                              },
-                              ns,
-                              contentsBuilder->build("KEYS", keyPattern));
+    /* Keys are collected with SCAN, which unlike KEYS does not block the database
+     * for the whole keyspace walk. Operation timeout is applied to each page.
+     */
+    const auto foundKeys(std::make_shared<Keys>());
+    scanKeys(ns,
+             keyPattern,
+             std::to_string(DEFAULT_SCAN_COUNT),
+             [findKeysAck, foundKeys](const std::error_code& error, const Keys& keys, const ScanKeysNext& next)
+             {
+                 if (error)
+                 {
+                     findKeysAck(error, Keys());
+                     return;
+                 }
+                 foundKeys->insert(keys.begin(), keys.end());
+                 if (next)
+                     next();
+                 else
+                     findKeysAck(std::error_code(), *foundKeys);
+             });
 }
 
 void AsyncRedisStorage::findKeysAsync(const Namespace& ns,
@@ -552,8 +944,329 @@ void AsyncRedisStorage::listKeys(const Namespace& ns,
     findKeys(ns, keyPattern, findKeysAck);
 }
 
+void AsyncRedisStorage::removeKeys(const Namespace& ns,
+                                   const std::string& keyPattern,
+                                   const ModifyAck& modifyAck)
+{
+    std::error_code ec;
+
+    if (!canOperationBePerformed(ns, boost::none, ec))
+    {
+        engine->postCallback(std::bind(modifyAck, ec));
+        return;
+    }
+
+    /* Keys are found with SCAN and removed with UNLINK in batches of at most
+     * removeBatchSize keys, so that no single request blocks the database for long.
+     * The next page is scanned while the keys of the previous page are being removed.
+     */
+    const auto removal(std::make_shared<Removal>(Removal { ns, modifyAck, 1, false, std::error_code() }));
+    scanKeys(ns,
+             keyPattern,
+             std::to_string(removeBatchSize),
+             [this, removal](const std::error_code& error, const Keys& keys, const ScanKeysNext& next)
+             {
+                 if (error && !removal->error)
+                     removal->error = error;
+                 if (!error)
+                     unlinkKeys(removal, keys);
+                 if (next && !removal->error)
+                     next();
+                 else
+                     removalStepDone(removal);
+             });
+}
+
+void AsyncRedisStorage::unlinkKeys(const std::shared_ptr<Removal>& removal, const Keys& keys)
+{
+    auto i(keys.begin());
+    while (i != keys.end())
+    {
+        Keys batch;
+        while (i != keys.end() && batch.size() < removeBatchSize)
+            batch.insert(batch.end(), *i++);
+        ++removal->pending;
+        const auto ack(withDeadline(ModifyAck([this, removal](const std::error_code& error)
+                                              {
+                                                  if (error && !removal->error)
+                                                      removal->error = error;
+                                                  if (!error)
+                                                      removal->keysRemoved = true;
+                                                  removalStepDone(removal);
+                                              })));
+        invalidateNearCache(removal->ns, batch);
+        dispatchCommand(std::bind(&AsyncRedisStorage::modificationCommandCallback,
+                                            this,
+                                            std::placeholders::_1,
+                                            std::placeholders::_2,
+                                            ack),
+                                  removal->ns,
+                                  contentsBuilder->build("UNLINK", removal->ns, batch));
+    }
+}
+
+void AsyncRedisStorage::removalStepDone(const std::shared_ptr<Removal>& removal)
+{
+    if (--removal->pending)
+        return;
+
+    if (removal->error ||
+        !removal->keysRemoved ||
+        !namespaceConfigurations->areNotificationsEnabled(removal->ns))
+    {
+        removal->modifyAck(removal->error);
+        return;
+    }
+
+    /* UNLINK has no publishing variant, thus removal is notified once after all batches. */
+    dispatchCommand(std::bind(&AsyncRedisStorage::modificationCommandCallback,
+                                        this,
+                                        std::placeholders::_1,
+                                        std::placeholders::_2,
+                                        withDeadline(removal->modifyAck)),
+                              removal->ns,
+                              contentsBuilder->build("PUBLISH", removal->ns, getPublishMessage()));
+}
+
 void AsyncRedisStorage::removeAllAsync(const Namespace& ns,
                                        const ModifyAck& modifyAck)
+{
+    removeKeys(ns, buildKeyPrefixSearchPattern(ns, ""), modifyAck);
+}
+
+void AsyncRedisStorage::removeByPrefixAsync(const Namespace& ns,
+                                            const std::string& keyPrefix,
+                                            const ModifyAck& modifyAck)
+{
+    removeKeys(ns, buildKeyPrefixSearchPattern(ns, keyPrefix), modifyAck);
+}
+
+std::string AsyncRedisStorage::buildChannelName(const Namespace& ns, const Channel& channel) const
+{
+    /* Modification notifications are published on the namespace identifier as such. */
+    if (channel == MODIFICATIONS_CHANNEL)
+        return ns;
+    std::ostringstream oss;
+    oss << '{' << ns << '}' << SEPARATOR << channel;
+    return oss.str();
+}
+
+void AsyncRedisStorage::createSubscriber()
+{
+    /* A connection in subscribed state cannot be used for other commands, thus a
+     * dedicated connection is opened for the subscriptions.
+     */
+    subscriberConnected = false;
+    disableNearCaches();
+    subscriber = asyncCommandDispatcherCreator(*engine,
+                                               dbInfo,
+                                               contentsBuilder,
+                                               logger,
+                                               true);
+    subscriber->registerDisconnectCb([this]()
+                                     {
+                                         /* Modifications done while disconnected would go unnoticed. */
+                                         subscriberConnected = false;
+                                         disableNearCaches();
+                                         subscriber->waitConnectedAsync(std::bind(&AsyncRedisStorage::subscriberConnectionEstablished, this));
+                                     });
+    subscriber->waitConnectedAsync(std::bind(&AsyncRedisStorage::subscriberConnectionEstablished, this));
+}
+
+void AsyncRedisStorage::subscriberConnectionEstablished()
+{
+    subscriberConnected = true;
+
+    const auto waiting(std::move(subscribeRequestsWaitingConnection));
+    subscribeRequestsWaitingConnection.clear();
+    std::set<std::string> requested;
+    for (const auto& request : waiting)
+    {
+        auto& names(request->channelNames);
+        names.erase(std::remove_if(names.begin(),
+                                   names.end(),
+                                   [this](const std::string& name)
+                                   {
+                                       return !isSubscriptionNeeded(name);
+                                   }),
+                    names.end());
+        requested.insert(names.begin(), names.end());
+        subscribe(request);
+    }
+
+    /* Renew the subscriptions made before the connection was lost. */
+    const auto renewal(std::make_shared<SubscribeRequest>());
+    for (const auto& i : notifications->subscriptions)
+        if (requested.count(i.first) == 0)
+            renewal->channelNames.push_back(i.first);
+    for (const auto& i : nearCaches)
+        if (requested.count(i.first) == 0 && notifications->subscriptions.count(i.first) == 0)
+            renewal->channelNames.push_back(i.first);
+    subscribe(renewal);
+}
+
+void AsyncRedisStorage::subscribe(const std::shared_ptr<SubscribeRequest>& request)
+{
+    request->unconfirmed = request->channelNames.size();
+    if (request->channelNames.empty())
+    {
+        if (request->subscribeAck)
+            request->subscribeAck(std::error_code());
+        return;
+    }
+    subscriber->dispatchAsync(std::bind(&AsyncRedisStorage::subscriberCallback,
+                                        this,
+                                        std::placeholders::_1,
+                                        std::placeholders::_2,
+                                        request),
+                              std::string(), // Not meaningful, subscriber connection is not clustered
+                              contentsBuilder->build("SUBSCRIBE", request->channelNames));
+}
+
+void AsyncRedisStorage::subscriberCallback(const std::error_code& error,
+                                           const Reply& reply,
+                                           const std::shared_ptr<SubscribeRequest>& request)
+{
+    // refer to: https://redis.io/topics/pubsub#format-of-pushed-messages
+    if (error)
+    {
+        if (request->unconfirmed)
+        {
+            request->unconfirmed = 0;
+            if (request->subscribeAck)
+                request->subscribeAck(error);
+        }
+        return;
+    }
+    if (reply.getType() != Reply::Type::ARRAY)
+        return;
+    const auto& array(*reply.getArray());
+    if (array.size() < 3 ||
+        array[0]->getType() != Reply::Type::STRING ||
+        array[1]->getType() != Reply::Type::STRING)
+        return;
+    const auto kind(array[0]->getString()->toString());
+    const auto channelName(array[1]->getString()->toString());
+    if (kind == "subscribe")
+    {
+        enableNearCache(channelName);
+        if (request->unconfirmed && --request->unconfirmed == 0 && request->subscribeAck)
+            request->subscribeAck(std::error_code());
+    }
+    else if (kind == "message" && array[2]->getType() == Reply::Type::STRING)
+    {
+        clearNearCache(channelName);
+        queueNotification(channelName, array[2]->getString()->toString());
+    }
+}
+
+void AsyncRedisStorage::queueNotification(const std::string& channelName, const std::string& message)
+{
+    if (notifications->subscriptions.count(channelName) == 0)
+        return;
+    /* Messages received during one event loop iteration are delivered together. */
+    if (notifications->pending.empty())
+    {
+        const std::weak_ptr<Notifications> weak(notifications);
+        engine->postCallback([weak]() { deliverNotifications(weak); });
+    }
+    notifications->pending[channelName].push_back(message);
+}
+
+void AsyncRedisStorage::deliverNotifications(const std::weak_ptr<Notifications>& weak)
+{
+    const auto notifications(weak.lock());
+    if (!notifications)
+        return;
+    const auto pending(std::move(notifications->pending));
+    notifications->pending.clear();
+    for (const auto& i : pending)
+    {
+        /* Callback may unsubscribe, thus the subscription is copied. */
+        const auto found(notifications->subscriptions.find(i.first));
+        if (found == notifications->subscriptions.end())
+            continue;
+        const auto subscription(found->second);
+        subscription.notificationCb(subscription.channel, i.second);
+    }
+}
+
+void AsyncRedisStorage::subscribeChannelAsync(const Namespace& ns,
+                                              const Channels& channels,
+                                              const NotificationCb& notificationCb,
+                                              const ModifyAck& subscribeAck)
+{
+    std::error_code ec;
+
+    if (!canOperationBePerformed(ns, channels.empty(), ec))
+    {
+        engine->postCallback(std::bind(subscribeAck, ec));
+        return;
+    }
+
+    const auto request(std::make_shared<SubscribeRequest>());
+    request->unconfirmed = 0;
+    request->subscribeAck = withDeadline(subscribeAck);
+    for (const auto& channel : channels)
+    {
+        const auto name(buildChannelName(ns, channel));
+        notifications->subscriptions[name] = Subscription { channel, notificationCb };
+        request->channelNames.push_back(name);
+    }
+    requestSubscription(request);
+}
+
+void AsyncRedisStorage::requestSubscription(const std::shared_ptr<SubscribeRequest>& request)
+{
+    if (!subscriber)
+        createSubscriber();
+    if (subscriberConnected)
+        subscribe(request);
+    else
+        subscribeRequestsWaitingConnection.push_back(request);
+}
+
+bool AsyncRedisStorage::isSubscriptionNeeded(const std::string& channelName) const
+{
+    return notifications->subscriptions.count(channelName) || nearCaches.count(channelName);
+}
+
+void AsyncRedisStorage::unsubscribeChannelAsync(const Namespace& ns,
+                                                const Channels& channels,
+                                                const ModifyAck& unsubscribeAck)
+{
+    std::error_code ec;
+
+    if (!canOperationBePerformed(ns, channels.empty(), ec))
+    {
+        engine->postCallback(std::bind(unsubscribeAck, ec));
+        return;
+    }
+
+    std::vector<std::string> names;
+    for (const auto& channel : channels)
+    {
+        const auto name(buildChannelName(ns, channel));
+        if (notifications->subscriptions.erase(name))
+        {
+            notifications->pending.erase(name);
+            if (!isSubscriptionNeeded(name))
+                names.push_back(name);
+        }
+    }
+
+    /* Replies to UNSUBSCRIBE are delivered to the callbacks of the subscriptions. */
+    if (subscriberConnected && !names.empty())
+        subscriber->dispatchAsync([](const std::error_code&, const Reply&) { },
+                                  std::string(),
+                                  contentsBuilder->build("UNSUBSCRIBE", names));
+    engine->postCallback(std::bind(unsubscribeAck, std::error_code()));
+}
+
+void AsyncRedisStorage::publishAsync(const Namespace& ns,
+                                     const Channel& channel,
+                                     const std::string& message,
+                                     const ModifyAck& modifyAck)
 {
     std::error_code ec;
 
@@ -563,23 +1276,297 @@ void AsyncRedisStorage::removeAllAsync(const Namespace& ns,
         return;
     }
 
-    dispatcher->dispatchAsync([this, modifyAck, ns](const std::error_code& error, const Reply& reply)
-                              {
-                                  if (error)
-                                  {
-                                      modifyAck(error);
-                                      return;
-                                  }
-                                  const auto& array(*reply.getArray());
-                                  if (array.empty())
-                                      modifyAck(std::error_code());
-                                  else
-                                  {
-                                      removeAsync(ns, getKeys(array), modifyAck);
-                                  }
-                              },
-                              ns,
-                              contentsBuilder->build("KEYS", buildKeyPrefixSearchPattern(ns, "")));
+    dispatchCommand(std::bind(&AsyncRedisStorage::modificationCommandCallback,
+                              this,
+                              std::placeholders::_1,
+                              std::placeholders::_2,
+                              withDeadline(modifyAck)),
+                    ns,
+                    contentsBuilder->build("PUBLISH", buildChannelName(ns, channel), message));
+}
+
+void AsyncRedisStorage::getBatchAsync(const NamespaceKeys& namespaceKeys,
+                                      const GetBatchAck& getBatchAck)
+{
+    if (namespaceKeys.empty())
+    {
+        engine->postCallback(std::bind(getBatchAck, std::error_code(), NamespaceDataMaps()));
+        return;
+    }
+
+    struct Result
+    {
+        std::size_t pending;
+        std::error_code error;
+        NamespaceDataMaps namespaceDataMaps;
+    };
+    const auto result(std::make_shared<Result>(Result { namespaceKeys.size(), std::error_code(), NamespaceDataMaps() }));
+
+    /* The MGETs of all the namespaces are written to the connection together. */
+    const auto batchDispatcher(dispatcher);
+    if (batchDispatcher)
+        batchDispatcher->cork();
+    for (const auto& i : namespaceKeys)
+    {
+        const auto ns(i.first);
+        getAsync(ns,
+                 i.second,
+                 GetAck([result, ns, getBatchAck](const std::error_code& error, const DataMap& dataMap)
+                        {
+                            if (error && !result->error)
+                                result->error = error;
+                            if (!error)
+                                result->namespaceDataMaps[ns] = dataMap;
+                            if (--result->pending == 0)
+                                getBatchAck(result->error,
+                                            result->error ? NamespaceDataMaps() : result->namespaceDataMaps);
+                        }));
+    }
+    if (batchDispatcher)
+        batchDispatcher->uncork();
+}
+
+void AsyncRedisStorage::setBatchAsync(const NamespaceDataMaps& namespaceDataMaps,
+                                      const ModifyAck& modifyAck)
+{
+    if (namespaceDataMaps.empty())
+    {
+        engine->postCallback(std::bind(modifyAck, std::error_code()));
+        return;
+    }
+
+    struct Result
+    {
+        std::size_t pending;
+        std::error_code error;
+    };
+    const auto result(std::make_shared<Result>(Result { namespaceDataMaps.size(), std::error_code() }));
+
+    const auto batchDispatcher(dispatcher);
+    if (batchDispatcher)
+        batchDispatcher->cork();
+    for (const auto& i : namespaceDataMaps)
+        setAsync(i.first,
+                 i.second,
+                 [result, modifyAck](const std::error_code& error)
+                 {
+                     if (error && !result->error)
+                         result->error = error;
+                     if (--result->pending == 0)
+                         modifyAck(result->error);
+                 });
+    if (batchDispatcher)
+        batchDispatcher->uncork();
+}
+
+void AsyncRedisStorage::writeBatchAsync(const Namespace& ns,
+                                        const WriteBatch& writeBatch,
+                                        const WriteBatchAck& writeBatchAck)
+{
+    std::error_code ec;
+
+    if (!canOperationBePerformed(ns, writeBatch.empty(), ec))
+    {
+        engine->postCallback(std::bind(writeBatchAck, ec, std::vector<bool>()));
+        return;
+    }
+
+    auto ack(withDeadline(writeBatchAck, std::vector<bool>()));
+    std::vector<Key> keys;
+    std::vector<std::string> args;
+    Keys modifiedKeys;
+
+    if (namespaceConfigurations->areNotificationsEnabled(ns))
+        args.push_back(ns);
+    else
+        args.push_back("");
+    args.push_back(getPublishMessage());
+
+    for (const auto& operation : writeBatch.getOperations())
+    {
+        switch (operation.type)
+        {
+            case WriteBatch::OperationType::SET:
+                args.push_back("set");
+                args.push_back(std::to_string(operation.dataMap.size()));
+                for (const auto& i : operation.dataMap)
+                {
+                    keys.push_back(i.first);
+                    args.push_back(toString(i.second));
+                    modifiedKeys.insert(i.first);
+                }
+                break;
+            case WriteBatch::OperationType::REMOVE:
+                args.push_back("del");
+                args.push_back(std::to_string(operation.keys.size()));
+                for (const auto& i : operation.keys)
+                {
+                    keys.push_back(i);
+                    modifiedKeys.insert(i);
+                }
+                break;
+            case WriteBatch::OperationType::SET_IF:
+                args.push_back("setie");
+                args.push_back(toString(operation.oldData));
+                args.push_back(toString(operation.data));
+                keys.push_back(operation.key);
+                modifiedKeys.insert(operation.key);
+                break;
+            case WriteBatch::OperationType::SET_IF_NOT_EXISTS:
+                args.push_back("setnx");
+                args.push_back(toString(operation.data));
+                keys.push_back(operation.key);
+                modifiedKeys.insert(operation.key);
+                break;
+            case WriteBatch::OperationType::REMOVE_IF:
+                args.push_back("delie");
+                args.push_back(toString(operation.data));
+                keys.push_back(operation.key);
+                modifiedKeys.insert(operation.key);
+                break;
+        }
+    }
+
+    invalidateNearCache(ns, modifiedKeys);
+
+    /* All the keys of the namespace are in the same hash slot, thus the script can be
+     * executed also in a cluster.
+     */
+    dispatchScript([ack](const std::error_code& error, const Reply& reply)
+                   {
+                       if (error)
+                       {
+                           ack(error, std::vector<bool>());
+                           return;
+                       }
+                       if (reply.getType() != Reply::Type::ARRAY)
+                       {
+                           ack(std::error_code(AsyncRedisCommandDispatcherErrorCode::UNKNOWN_ERROR), std::vector<bool>());
+                           return;
+                       }
+                       std::vector<bool> statuses;
+                       for (const auto& i : *reply.getArray())
+                           statuses.push_back(i->getInteger() == 1);
+                       ack(std::error_code(), statuses);
+                   },
+                   ns,
+                   writeBatchScript,
+                   contentsBuilder->build(writeBatchScript, ns, keys, args));
+}
+
+std::shared_ptr<NearCache> AsyncRedisStorage::getNearCache(const Namespace& ns)
+{
+    if (!nearCacheUsed)
+        return nullptr;
+
+    /* Near caches are invalidated by the modification notifications, thus they
+     * are stored by the name of the modifications channel of the namespace.
+     */
+    const auto channelName(buildChannelName(ns, MODIFICATIONS_CHANNEL));
+    const auto found(nearCaches.find(channelName));
+    if (found != nearCaches.end())
+        return found->second;
+
+    const auto nearCacheSize(namespaceConfigurations->getNearCacheSize(ns));
+    if (!nearCacheSize)
+        return nullptr;
+
+    /* The cache is enabled when the subscription is confirmed. */
+    const auto nearCache(std::make_shared<NearCache>(nearCacheSize));
+    nearCaches.emplace(channelName, nearCache);
+    const auto request(std::make_shared<SubscribeRequest>());
+    request->unconfirmed = 0;
+    request->channelNames.push_back(channelName);
+    requestSubscription(request);
+    return nearCache;
+}
+
+void AsyncRedisStorage::invalidateNearCache(const Namespace& ns, const Keys& keys)
+{
+    if (nearCaches.empty())
+        return;
+    const auto found(nearCaches.find(buildChannelName(ns, MODIFICATIONS_CHANNEL)));
+    if (found != nearCaches.end())
+        found->second->invalidate(keys);
+}
+
+void AsyncRedisStorage::invalidateNearCache(const Namespace& ns, const DataMap& dataMap)
+{
+    if (nearCaches.empty())
+        return;
+    const auto found(nearCaches.find(buildChannelName(ns, MODIFICATIONS_CHANNEL)));
+    if (found == nearCaches.end())
+        return;
+    Keys keys;
+    for (const auto& i : dataMap)
+        keys.insert(keys.end(), i.first);
+    found->second->invalidate(keys);
+}
+
+void AsyncRedisStorage::enableNearCache(const std::string& channelName)
+{
+    const auto found(nearCaches.find(channelName));
+    if (found != nearCaches.end())
+        found->second->enable();
+}
+
+void AsyncRedisStorage::clearNearCache(const std::string& channelName)
+{
+    const auto found(nearCaches.find(channelName));
+    if (found != nearCaches.end())
+        found->second->clear();
+}
+
+void AsyncRedisStorage::disableNearCaches()
+{
+    for (const auto& i : nearCaches)
+        i.second->disable();
+}
+
+void AsyncRedisStorage::getFromNearCacheAsync(const Namespace& ns,
+                                              const Keys& keys,
+                                              const GetAck& getAck,
+                                              const std::shared_ptr<NearCache>& nearCache)
+{
+    DataMap cached;
+    Keys missing;
+    for (const auto& key : keys)
+    {
+        const auto data(nearCache->find(key));
+        if (data)
+            cached.emplace(key, *data);
+        else
+            missing.insert(missing.end(), key);
+    }
+
+    if (missing.empty())
+    {
+        engine->postCallback(std::bind(getAck, std::error_code(), cached));
+        return;
+    }
+
+    auto ack(withDeadline(getAck, DataMap()));
+    const auto read(std::make_shared<const NearCacheRead>(NearCacheRead { std::move(missing),
+                                                                          std::move(cached),
+                                                                          nearCache,
+                                                                          nearCache->getGeneration() }));
+
+    dispatchCommand([ack, read](const std::error_code& error,
+                                const Reply& reply)
+                    {
+                        if (error)
+                        {
+                            ack(error, DataMap());
+                            return;
+                        }
+                        auto dataMap(buildDataMap(read->missing, *reply.getArray()));
+                        for (const auto& i : dataMap)
+                            read->nearCache->insert(i.first, i.second, read->generation);
+                        dataMap.insert(read->cached.begin(), read->cached.end());
+                        ack(std::error_code(), dataMap);
+                    },
+                    ns,
+                    contentsBuilder->build("MGET", ns, read->missing));
 }
 
 std::string AsyncRedisStorage::buildKeyPrefixSearchPattern(const Namespace& ns, const std::string& keyPrefix) const
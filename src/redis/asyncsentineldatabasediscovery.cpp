@@ -248,7 +248,7 @@ namespace
             if (firstElementType == Reply::Type::STRING)
             {
                 auto subscribeReply = std::unique_ptr<SubscribeReply>(new SubscribeReply());
-                auto kind(replyVector[0]->getString()->str);
+                auto kind(replyVector[0]->getString()->toString());
                 if (kind == "subscribe")
                 {
                     subscribeReply->type = SubscribeReply::Type::SUBSCRIBE_REPLY;
@@ -260,7 +260,7 @@ namespace
                     auto thirdElementType = replyVector[2]->getType();
                     if (thirdElementType == Reply::Type::STRING)
                     {
-                        subscribeReply->message = replyVector[2]->getString()->str;
+                        subscribeReply->message = replyVector[2]->getString()->toString();
                         return subscribeReply;
                     }
                     else
@@ -288,11 +288,11 @@ namespace
             auto hostElementType = replyVector[0]->getType();
             if (hostElementType == Reply::Type::STRING)
             {
-                auto host(replyVector[0]->getString()->str);
+                auto host(replyVector[0]->getString()->toString());
                 auto portElementType = replyVector[1]->getType();
                 if (portElementType == Reply::Type::STRING)
                 {
-                    auto port(replyVector[1]->getString()->str);
+                    auto port(replyVector[1]->getString()->toString());
                     try
                     {
                         return std::unique_ptr<HostAndPort>(new HostAndPort(host+":"+port, 0));;
@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include "private/redis/commandcbslab.hpp"
+#include <climits>
+
+using namespace shareddatalayer;
+using namespace shareddatalayer::redis;
+
+namespace
+{
+    /* Half of the handle bits are used for the generation and the other half for the slot index.
+     * Slot index is stored incremented by one, so that a valid handle is never nullptr.
+     */
+    const unsigned int generationBits(sizeof(uintptr_t) * CHAR_BIT / 2);
+    const uintptr_t generationMask((uintptr_t(1) << generationBits) - 1);
+
+    CommandCbSlab::Handle encodeHandle(size_t index, uint32_t generation)
+    {
+        return reinterpret_cast<CommandCbSlab::Handle>(((static_cast<uintptr_t>(index) + 1) << generationBits) |
+                                                       (generation & generationMask));
+    }
+}
+
+CommandCbSlab::CommandCbSlab():
+    count(0)
+{
+}
+
+CommandCbSlab::Handle CommandCbSlab::add(CommandCb commandCb)
+{
+    size_t index;
+    if (freeSlots.empty())
+    {
+        index = slots.size();
+        slots.push_back(Slot { std::move(commandCb), 0, true });
+    }
+    else
+    {
+        index = freeSlots.back();
+        freeSlots.pop_back();
+        auto& slot(slots[index]);
+        slot.commandCb = std::move(commandCb);
+        slot.used = true;
+    }
+    ++count;
+    return encodeHandle(index, slots[index].generation);
+}
+
+CommandCbSlab::CommandCb* CommandCbSlab::find(Handle handle)
+{
+    size_t index;
+    if (!findIndex(handle, index))
+        return nullptr;
+    return &slots[index].commandCb;
+}
+
+void CommandCbSlab::remove(Handle handle)
+{
+    size_t index;
+    if (!findIndex(handle, index))
+        return;
+    auto& slot(slots[index]);
+    slot.commandCb = CommandCb();
+    slot.used = false;
+    ++slot.generation;
+    freeSlots.push_back(index);
+    --count;
+}
+
+size_t CommandCbSlab::size() const
+{
+    return count;
+}
+
+bool CommandCbSlab::findIndex(Handle handle, size_t& index) const
+{
+    const auto value(reinterpret_cast<uintptr_t>(handle));
+    const auto storedIndex(value >> generationBits);
+    if ((storedIndex == 0) || (storedIndex > slots.size()))
+        return false;
+    const auto& slot(slots[storedIndex - 1]);
+    if (!slot.used || ((slot.generation & generationMask) != (value & generationMask)))
+        return false;
+    index = storedIndex - 1;
+    return true;
+}
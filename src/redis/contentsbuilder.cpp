@@ -20,11 +20,29 @@
 */
 
 #include "private/redis/contentsbuilder.hpp"
+#include <algorithm>
+#include <functional>
 #include "private/redis/contents.hpp"
+#include "private/redis/script.hpp"
 
 using namespace shareddatalayer;
 using namespace shareddatalayer::redis;
 
+namespace
+{
+    /* Empty arguments have no buffer, but hiredis expects a valid pointer for each argument. */
+    const char emptyData[] = "";
+
+    void rebase(Contents& contents, const char* oldBegin, const char* oldEnd, const char* newBegin)
+    {
+        const std::less_equal<const char*> lessEqual;
+        const std::less<const char*> less;
+        for (auto& i : contents.stack)
+            if (lessEqual(oldBegin, i) && less(i, oldEnd))
+                i = newBegin + (i - oldBegin);
+    }
+}
+
 ContentsBuilder::ContentsBuilder(const char nsKeySeparator):
     nsKeySeparator(nsKeySeparator)
 {
@@ -61,6 +79,33 @@ Contents ContentsBuilder::build(const std::string& string,
     return contents;
 }
 
+Contents ContentsBuilder::build(const std::string& string,
+                                const std::string& string2,
+                                const std::string& string3,
+                                const std::string& string4,
+                                const std::string& string5,
+                                const std::string& string6) const
+{
+    Contents contents;
+    addString(contents, string);
+    addString(contents, string2);
+    addString(contents, string3);
+    addString(contents, string4);
+    addString(contents, string5);
+    addString(contents, string6);
+    return contents;
+}
+
+Contents ContentsBuilder::build(const std::string& string,
+                                const std::vector<std::string>& strings) const
+{
+    Contents contents;
+    addString(contents, string);
+    for (const auto& i : strings)
+        addString(contents, i);
+    return contents;
+}
+
 Contents ContentsBuilder::build(const std::string& string,
                                 const AsyncConnection::Namespace& ns,
                                 const AsyncConnection::DataMap& dataMap) const
@@ -169,20 +214,43 @@ Contents ContentsBuilder::build(const std::string& string,
     return contents;
 }
 
+Contents ContentsBuilder::build(const Script& script,
+                                const AsyncConnection::Namespace& ns,
+                                const std::vector<AsyncConnection::Key>& keys,
+                                const std::vector<std::string>& args) const
+{
+    Contents contents;
+    addString(contents, "EVALSHA");
+    addString(contents, script.getSha1());
+    addString(contents, std::to_string(keys.size()));
+    for (const auto& i : keys)
+        addKey(contents, ns, i);
+    for (const auto& i : args)
+        addString(contents, i);
+    return contents;
+}
+
 void ContentsBuilder::addString(Contents& contents,
                                 const std::string& string) const
 {
-    contents.stack.push_back(string);
-    contents.sizes.push_back(string.size());
+    addToStorage(contents, std::string(), string);
 }
 
 void ContentsBuilder::addDataMap(Contents& contents,
                                  const AsyncConnection::Namespace& ns,
                                  const AsyncConnection::DataMap& dataMap) const
 {
+    const auto prefix(buildKeyPrefix(ns));
+    size_t keysSize(0);
+    for (const auto& i : dataMap)
+        keysSize += prefix.size() + i.first.size();
+    contents.stack.reserve(contents.stack.size() + dataMap.size() * 2);
+    contents.sizes.reserve(contents.sizes.size() + dataMap.size() * 2);
+    reserveStorage(contents, keysSize);
+    contents.keyArguments = { contents.stack.size(), dataMap.size(), 2 };
     for (const auto& i : dataMap)
     {
-        addKey(contents, ns, i.first);
+        addToStorage(contents, prefix, i.first);
         addData(contents, i.second);
     }
 }
@@ -191,16 +259,20 @@ void ContentsBuilder::addKey(Contents& contents,
                              const AsyncConnection::Namespace& ns,
                              const AsyncConnection::Key& key) const
 {
-    auto content('{' + ns + '}' + nsKeySeparator + key);
-    contents.stack.push_back(content);
-    contents.sizes.push_back((content).size());
+    /* Consecutive keys, like the keys of a script, form one range. */
+    if (contents.keyArguments.count == 0)
+        contents.keyArguments = { contents.stack.size(), 0, 1 };
+    ++contents.keyArguments.count;
+    addToStorage(contents, buildKeyPrefix(ns), key);
 }
 
 void ContentsBuilder::addData(Contents& contents,
                               const AsyncConnection::Data& data) const
 {
-    contents.stack.push_back(std::string(reinterpret_cast<const char*>(data.data()),
-                                         static_cast<size_t>(data.size())));
+    if (data.empty())
+        contents.stack.push_back(emptyData);
+    else
+        contents.stack.push_back(reinterpret_cast<const char*>(data.data()));
     contents.sizes.push_back(data.size());
 }
 
@@ -208,6 +280,73 @@ void ContentsBuilder::addKeys(Contents& contents,
                               const AsyncConnection::Namespace& ns,
                               const AsyncConnection::Keys& keys) const
 {
+    const auto prefix(buildKeyPrefix(ns));
+    size_t keysSize(0);
     for (const auto& i : keys)
-        addKey(contents, ns, i);
+        keysSize += prefix.size() + i.size();
+    contents.stack.reserve(contents.stack.size() + keys.size());
+    contents.sizes.reserve(contents.sizes.size() + keys.size());
+    reserveStorage(contents, keysSize);
+    contents.keyArguments = { contents.stack.size(), keys.size(), 1 };
+    for (const auto& i : keys)
+        addToStorage(contents, prefix, i);
+}
+
+std::string ContentsBuilder::buildKeyPrefix(const AsyncConnection::Namespace& ns) const
+{
+    std::string prefix;
+    prefix.reserve(ns.size() + 3);
+    prefix += '{';
+    prefix += ns;
+    prefix += '}';
+    prefix += nsKeySeparator;
+    return prefix;
+}
+
+void ContentsBuilder::reserveStorage(Contents& contents,
+                                     size_t size) const
+{
+    /* Arguments in the storage are stored back to back. Growing the storage moves the
+     * earlier arguments, so the pointers to them have to be updated. Storage shared
+     * with copies of the contents is copied first, as the pointers of the copies
+     * cannot be updated.
+     */
+    if (!contents.storage)
+        contents.storage = std::make_shared<std::string>();
+    else if (contents.storage.use_count() > 1)
+    {
+        const auto& shared(*contents.storage);
+        auto copy(std::make_shared<std::string>());
+        copy->reserve(shared.size() + size);
+        copy->append(shared);
+        rebase(contents, shared.data(), shared.data() + shared.size(), copy->data());
+        contents.storage = copy;
+        return;
+    }
+    auto& storage(*contents.storage);
+    if (storage.capacity() - storage.size() >= size)
+        return;
+    const auto oldBegin(storage.data());
+    const auto oldEnd(oldBegin + storage.size());
+    storage.reserve(std::max(storage.size() + size, storage.capacity() * 2));
+    rebase(contents, oldBegin, oldEnd, storage.data());
+}
+
+void ContentsBuilder::addToStorage(Contents& contents,
+                                   const std::string& prefix,
+                                   const std::string& string) const
+{
+    if (prefix.empty() && string.empty())
+    {
+        contents.stack.push_back(emptyData);
+        contents.sizes.push_back(0);
+        return;
+    }
+    reserveStorage(contents, prefix.size() + string.size());
+    auto& storage(*contents.storage);
+    const auto offset(storage.size());
+    storage.append(prefix);
+    storage.append(string);
+    contents.stack.push_back(storage.data() + offset);
+    contents.sizes.push_back(prefix.size() + string.size());
 }
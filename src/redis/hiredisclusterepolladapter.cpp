@@ -22,6 +22,7 @@
 #include "private/redis/hiredisclusterepolladapter.hpp"
 #include <sys/epoll.h>
 #include "private/engine.hpp"
+#include "private/probes.hpp"
 #include "private/redis/hiredisclustersystem.hpp"
 
 using namespace shareddatalayer;
@@ -137,7 +138,10 @@ void HiredisClusterEpollAdapter::Node::eventHandler(unsigned int events)
             hiredisClusterSystem.redisAsyncHandleRead(ac);
     if (events & Engine::EVENT_OUT)
         if (writing && isMonitoring)
+        {
+            SHAREDDATALAYER_PROBE(socket_write, ac->c.fd);
             hiredisClusterSystem.redisAsyncHandleWrite(ac);
+        }
 }
 
 void HiredisClusterEpollAdapter::Node::addRead()
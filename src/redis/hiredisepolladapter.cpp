@@ -22,6 +22,7 @@
 #include "private/redis/hiredisepolladapter.hpp"
 #include <sys/epoll.h>
 #include "private/engine.hpp"
+#include "private/probes.hpp"
 #include "private/redis/hiredissystem.hpp"
 
 using namespace shareddatalayer;
@@ -71,9 +72,12 @@ HiredisEpollAdapter::HiredisEpollAdapter(Engine& engine, HiredisSystem& hiredisS
     engine(engine),
     ac(nullptr),
     eventState(0),
+    monitoredEventState(0),
     reading(false),
     writing(false),
-    isMonitoring(false)
+    isMonitoring(false),
+    corked(0),
+    writeDeferred(false)
 {
 }
 
@@ -86,8 +90,10 @@ HiredisEpollAdapter::~HiredisEpollAdapter()
 void HiredisEpollAdapter::attach(redisAsyncContext* ac)
 {
     eventState = 0;
+    monitoredEventState = 0;
     reading = false;
     writing = false;
+    writeDeferred = false;
     this->ac = ac;
     this->ac->ev.data = this;
     this->ac->ev.addRead = addReadWrap;
@@ -110,7 +116,10 @@ void HiredisEpollAdapter::eventHandler(unsigned int events)
             hiredisSystem.redisAsyncHandleRead(ac);
     if (events & Engine::EVENT_OUT)
         if (writing)
+        {
+            SHAREDDATALAYER_PROBE(socket_write, ac->c.fd);
             hiredisSystem.redisAsyncHandleWrite(ac);
+        }
 }
 
 void HiredisEpollAdapter::addRead()
@@ -119,37 +128,89 @@ void HiredisEpollAdapter::addRead()
         return;
     reading = true;
     eventState |= Engine::EVENT_IN;
-    engine.modifyMonitoredFD(ac->c.fd, eventState);
+    updateMonitoredEvents();
 }
 
 void HiredisEpollAdapter::delRead()
 {
     reading = false;
     eventState &= ~Engine::EVENT_IN;
-    engine.modifyMonitoredFD(ac->c.fd, eventState);
+    updateMonitoredEvents();
 }
 
 void HiredisEpollAdapter::addWrite()
 {
     if (writing)
         return;
+    if (corked)
+    {
+        writeDeferred = true;
+        return;
+    }
+    /* Commands are typically small enough to be written to the socket right away.
+     * Output events are monitored only if the whole output buffer could not be
+     * written without blocking.
+     */
+    if (flushOutputBuffer())
+    {
+        addRead();
+        return;
+    }
     writing = true;
     eventState |= Engine::EVENT_OUT;
-    engine.modifyMonitoredFD(ac->c.fd, eventState);
+    updateMonitoredEvents();
 }
 
 void HiredisEpollAdapter::delWrite()
 {
     writing = false;
     eventState &= ~Engine::EVENT_OUT;
-    engine.modifyMonitoredFD(ac->c.fd, eventState);
+    updateMonitoredEvents();
+}
+
+void HiredisEpollAdapter::cork()
+{
+    ++corked;
+}
+
+void HiredisEpollAdapter::uncork()
+{
+    if (--corked || !writeDeferred)
+        return;
+    writeDeferred = false;
+    addWrite();
 }
 
 void HiredisEpollAdapter::cleanUp()
 {
     reading = false;
     writing = false;
+    writeDeferred = false;
     eventState = 0;
+    monitoredEventState = 0;
     engine.deleteMonitoredFD(ac->c.fd);
     isMonitoring = false;
 }
+
+bool HiredisEpollAdapter::flushOutputBuffer()
+{
+    /* Until the connection is established, hiredis uses the output event to detect
+     * connection completion. Write errors are left to hiredis to handle in its output
+     * event handler.
+     */
+    if (!(ac->c.flags & REDIS_CONNECTED))
+        return false;
+    int done(0);
+    SHAREDDATALAYER_PROBE(socket_write, ac->c.fd);
+    if (hiredisSystem.redisBufferWrite(&ac->c, &done) != REDIS_OK)
+        return false;
+    return done != 0;
+}
+
+void HiredisEpollAdapter::updateMonitoredEvents()
+{
+    if (eventState == monitoredEventState)
+        return;
+    monitoredEventState = eventState;
+    engine.modifyMonitoredFD(ac->c.fd, eventState);
+}
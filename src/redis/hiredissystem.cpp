@@ -78,6 +78,11 @@ void HiredisSystem::redisAsyncHandleWrite(redisAsyncContext* ac)
     ::redisAsyncHandleWrite(ac);
 }
 
+int HiredisSystem::redisBufferWrite(redisContext* context, int* done)
+{
+    return ::redisBufferWrite(context, done);
+}
+
 void HiredisSystem::redisAsyncDisconnect(redisAsyncContext* ac)
 {
     ::redisAsyncDisconnect(ac);
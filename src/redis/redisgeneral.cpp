@@ -78,6 +78,10 @@ namespace
         if (startsWith("READONLY", rr->str, static_cast<size_t>(rr->len)))
             return AsyncRedisCommandDispatcherErrorCode::WRITING_TO_SLAVE;
 
+        /* Script is not in the script cache, for example after failover or restart. */
+        if (startsWith("NOSCRIPT", rr->str, static_cast<size_t>(rr->len)))
+            return AsyncRedisCommandDispatcherErrorCode::NO_SCRIPT;
+
         std::ostringstream oss;
         oss << "redis reply error: " << std::string(rr->str, static_cast<size_t>(rr->len));
         logErrorOnce(oss.str());
@@ -175,7 +179,7 @@ namespace shareddatalayer
             {
                 auto element = j->getArray();
                 auto command = element->front()->getString();
-                availableCommands.insert(command->str);
+                availableCommands.insert(command->toString());
             }
             return availableCommands;
         }
@@ -0,0 +1,116 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include "private/redis/script.hpp"
+#include <array>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+
+using namespace shareddatalayer::redis;
+
+namespace
+{
+    uint32_t rotateLeft(uint32_t value, unsigned int bits)
+    {
+        return (value << bits) | (value >> (32 - bits));
+    }
+
+    void processBlock(std::array<uint32_t, 5>& state, const unsigned char* block)
+    {
+        std::array<uint32_t, 80> w;
+        for (auto i(0U); i < 16; ++i)
+            w[i] = (uint32_t(block[i * 4]) << 24) |
+                   (uint32_t(block[i * 4 + 1]) << 16) |
+                   (uint32_t(block[i * 4 + 2]) << 8) |
+                   uint32_t(block[i * 4 + 3]);
+        for (auto i(16U); i < 80; ++i)
+            w[i] = rotateLeft(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+        auto a(state[0]);
+        auto b(state[1]);
+        auto c(state[2]);
+        auto d(state[3]);
+        auto e(state[4]);
+        for (auto i(0U); i < 80; ++i)
+        {
+            uint32_t f;
+            uint32_t k;
+            if (i < 20)
+            {
+                f = (b & c) | (~b & d);
+                k = 0x5a827999;
+            }
+            else if (i < 40)
+            {
+                f = b ^ c ^ d;
+                k = 0x6ed9eba1;
+            }
+            else if (i < 60)
+            {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8f1bbcdc;
+            }
+            else
+            {
+                f = b ^ c ^ d;
+                k = 0xca62c1d6;
+            }
+            const auto temp(rotateLeft(a, 5) + f + e + k + w[i]);
+            e = d;
+            d = c;
+            c = rotateLeft(b, 30);
+            b = a;
+            a = temp;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+    }
+}
+
+Script::Script(const std::string& source):
+    source(std::make_shared<const std::string>(source)),
+    sha1(calculateSha1(source))
+{
+}
+
+std::string Script::calculateSha1(const std::string& string)
+{
+    /* Redis identifies cached scripts by the SHA1 digest of their source (FIPS 180-4). */
+    std::array<uint32_t, 5> state { { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0 } };
+    std::string message(string);
+    const uint64_t bitLength(uint64_t(string.size()) * 8);
+    message += '\x80';
+    while (message.size() % 64 != 56)
+        message += '\0';
+    for (auto i(7); i >= 0; --i)
+        message += static_cast<char>((bitLength >> (i * 8)) & 0xff);
+    for (std::size_t i(0); i < message.size(); i += 64)
+        processBlock(state, reinterpret_cast<const unsigned char*>(message.data() + i));
+
+    std::ostringstream oss;
+    for (const auto& i : state)
+        oss << std::hex << std::setfill('0') << std::setw(8) << i;
+    return oss.str();
+}
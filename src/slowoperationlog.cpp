@@ -0,0 +1,98 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include "private/slowoperationlog.hpp"
+#include <ostream>
+#include "private/abort.hpp"
+
+using namespace shareddatalayer;
+
+const std::chrono::steady_clock::duration SlowOperationLog::LOG_INTERVAL(std::chrono::seconds(1));
+
+SlowOperationLog::SlowOperationLog(const SlowOperationLogConfiguration& configuration,
+                                   const GetConnection& getConnection,
+                                   std::shared_ptr<Logger> logger):
+    threshold(configuration.threshold),
+    size(configuration.size),
+    getConnection(getConnection),
+    logger(logger),
+    next(0),
+    nextLogTime(std::chrono::steady_clock::time_point::min()),
+    notLogged(0)
+{
+    if (size == 0)
+        SHAREDDATALAYER_ABORT("Slow operation log size must be greater than zero.");
+    ring.reserve(size);
+}
+
+void SlowOperationLog::add(const std::string& ns,
+                           Statistics::OperationType type,
+                           std::size_t keyCount,
+                           std::uint64_t bytes,
+                           const std::chrono::steady_clock::duration& latency,
+                           const std::chrono::steady_clock::time_point& now)
+{
+    Statistics::SlowOperation slowOperation{ std::chrono::system_clock::now(),
+                                             ns,
+                                             type,
+                                             keyCount,
+                                             bytes,
+                                             getConnection(ns),
+                                             std::chrono::duration_cast<std::chrono::nanoseconds>(latency) };
+    if (now >= nextLogTime)
+    {
+        log(slowOperation);
+        nextLogTime = now + LOG_INTERVAL;
+    }
+    else
+        ++notLogged;
+    if (ring.size() < size)
+        ring.push_back(std::move(slowOperation));
+    else
+        ring[next] = std::move(slowOperation);
+    next = (next + 1) % size;
+}
+
+Statistics::SlowOperations SlowOperationLog::getSlowOperations() const
+{
+    if (ring.size() < size)
+        return ring;
+    Statistics::SlowOperations slowOperations(ring.begin() + next, ring.end());
+    slowOperations.insert(slowOperations.end(), ring.begin(), ring.begin() + next);
+    return slowOperations;
+}
+
+void SlowOperationLog::log(const Statistics::SlowOperation& slowOperation)
+{
+    auto& out(logger->warning());
+    out << "Slow operation: namespace: " << slowOperation.ns
+        << ", operation: " << Statistics::getOperationName(slowOperation.type)
+        << ", keys: " << slowOperation.keyCount
+        << ", bytes: " << slowOperation.bytes
+        << ", connection: " << slowOperation.connection
+        << ", latency: " << std::chrono::duration_cast<std::chrono::microseconds>(slowOperation.latency).count() << " us";
+    if (notLogged)
+    {
+        out << " (" << notLogged << " slow operation(s) not logged)";
+        notLogged = 0;
+    }
+    out << std::endl;
+}
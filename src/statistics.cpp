@@ -0,0 +1,166 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <sdl/statistics.hpp>
+#include <sstream>
+#include "private/abort.hpp"
+
+using namespace shareddatalayer;
+
+namespace
+{
+    std::string escapeLabelValue(const std::string& value)
+    {
+        std::string escaped;
+        escaped.reserve(value.size());
+        for (const auto c : value)
+        {
+            if (c == '\\')
+                escaped += "\\\\";
+            else if (c == '"')
+                escaped += "\\\"";
+            else if (c == '\n')
+                escaped += "\\n";
+            else
+                escaped += c;
+        }
+        return escaped;
+    }
+
+    std::string buildLabels(const Statistics::Namespace& ns, Statistics::OperationType type)
+    {
+        return "namespace=\"" + escapeLabelValue(ns) + "\",operation=\"" + Statistics::getOperationName(type) + "\"";
+    }
+
+    template <typename Value>
+    void writeCounter(std::ostream& out,
+                      const char* name,
+                      const char* help,
+                      const Statistics::NamespaceStatisticsMap& namespaces,
+                      const Value& value)
+    {
+        out << "# HELP " << name << ' ' << help << '\n'
+            << "# TYPE " << name << " counter\n";
+        for (const auto& ns : namespaces)
+            for (const auto& operation : ns.second)
+                out << name << '{' << buildLabels(ns.first, operation.first) << "} " << value(operation.second) << '\n';
+    }
+
+    void writeLatencyHistogram(std::ostream& out, const Statistics::NamespaceStatisticsMap& namespaces)
+    {
+        static const char* name("sdl_operation_duration_seconds");
+        out << "# HELP " << name << " Latency of SDL operations from start to acknowledgement.\n"
+            << "# TYPE " << name << " histogram\n";
+        for (const auto& ns : namespaces)
+            for (const auto& operation : ns.second)
+            {
+                const auto labels(buildLabels(ns.first, operation.first));
+                const auto& statistics(operation.second);
+                std::uint64_t cumulative(0);
+                for (std::size_t i(0); i < Statistics::LATENCY_BUCKETS - 1; ++i)
+                {
+                    cumulative += statistics.latencyBuckets[i];
+                    out << name << "_bucket{" << labels << ",le=\""
+                        << Statistics::getLatencyBucketBound(i).count() / 1e6 << "\"} " << cumulative << '\n';
+                }
+                out << name << "_bucket{" << labels << ",le=\"+Inf\"} " << statistics.count << '\n'
+                    << name << "_sum{" << labels << "} "
+                    << std::chrono::duration<double>(statistics.latencySum).count() << '\n'
+                    << name << "_count{" << labels << "} " << statistics.count << '\n';
+            }
+    }
+}
+
+constexpr std::size_t Statistics::LATENCY_BUCKETS;
+
+Statistics::Statistics(const NamespaceStatisticsMap& namespaces):
+    namespaces(namespaces)
+{
+}
+
+Statistics::Statistics(const NamespaceStatisticsMap& namespaces, const SlowOperations& slowOperations):
+    namespaces(namespaces),
+    slowOperations(slowOperations)
+{
+}
+
+std::chrono::microseconds Statistics::getLatencyBucketBound(std::size_t bucket)
+{
+    if (bucket >= LATENCY_BUCKETS - 1)
+        return std::chrono::microseconds::max();
+    return std::chrono::microseconds(std::chrono::microseconds::rep(1) << bucket);
+}
+
+const char* Statistics::getOperationName(OperationType type)
+{
+    switch (type)
+    {
+        case OperationType::SET:
+            return "set";
+        case OperationType::SET_IF:
+            return "set_if";
+        case OperationType::SET_IF_NOT_EXISTS:
+            return "set_if_not_exists";
+        case OperationType::GET:
+            return "get";
+        case OperationType::REMOVE:
+            return "remove";
+        case OperationType::REMOVE_IF:
+            return "remove_if";
+        case OperationType::FIND_KEYS:
+            return "find_keys";
+        case OperationType::LIST_KEYS:
+            return "list_keys";
+        case OperationType::SCAN_KEYS:
+            return "scan_keys";
+        case OperationType::REMOVE_ALL:
+            return "remove_all";
+        case OperationType::REMOVE_BY_PREFIX:
+            return "remove_by_prefix";
+        case OperationType::PUBLISH:
+            return "publish";
+        case OperationType::GET_BATCH:
+            return "get_batch";
+        case OperationType::SET_BATCH:
+            return "set_batch";
+        case OperationType::WRITE_BATCH:
+            return "write_batch";
+        case OperationType::END_MARKER:
+            break;
+    }
+    SHAREDDATALAYER_ABORT("Invalid operation type");
+}
+
+std::string Statistics::toPrometheusText() const
+{
+    std::ostringstream out;
+    out.precision(10);
+    writeCounter(out, "sdl_operations_total", "Number of completed SDL operations.", namespaces,
+                 [](const OperationStatistics& statistics) { return statistics.count; });
+    writeCounter(out, "sdl_operation_errors_total", "Number of SDL operations completed with an error.", namespaces,
+                 [](const OperationStatistics& statistics) { return statistics.errors; });
+    writeCounter(out, "sdl_operation_sent_bytes_total", "Bytes of keys, data and other arguments given to SDL operations.", namespaces,
+                 [](const OperationStatistics& statistics) { return statistics.bytesSent; });
+    writeCounter(out, "sdl_operation_received_bytes_total", "Bytes of keys and data returned by SDL operations.", namespaces,
+                 [](const OperationStatistics& statistics) { return statistics.bytesReceived; });
+    writeLatencyHistogram(out, namespaces);
+    return out.str();
+}
@@ -0,0 +1,144 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include "private/statisticscollector.hpp"
+#include <algorithm>
+#include "private/probes.hpp"
+
+using namespace shareddatalayer;
+
+const std::string StatisticsCollector::OTHER_NAMESPACE("{other}");
+
+StatisticsCollector::Measurement::Measurement(std::shared_ptr<Record> record,
+                                              std::shared_ptr<SlowOperationLog> slowOperationLog,
+                                              const std::string& ns,
+                                              OperationType type,
+                                              std::uint64_t requestId,
+                                              std::size_t keyCount,
+                                              std::uint64_t bytesSent):
+    record(record),
+    slowOperationLog(slowOperationLog),
+    ns(slowOperationLog ? ns : std::string()),
+    type(type),
+    startTime(std::chrono::steady_clock::now()),
+    requestId(requestId),
+    keyCount(keyCount),
+    bytesSent(bytesSent)
+{
+}
+
+void StatisticsCollector::Measurement::done(const std::error_code& error, std::uint64_t bytesReceived) const
+{
+    SHAREDDATALAYER_PROBE(operation_done, requestId, error.value(), bytesReceived);
+    const auto now(std::chrono::steady_clock::now());
+    const auto latency(now - startTime);
+    if (record)
+    {
+        auto& statistics(record->statistics);
+        ++statistics.count;
+        if (error)
+            ++statistics.errors;
+        statistics.bytesSent += bytesSent;
+        statistics.bytesReceived += bytesReceived;
+        statistics.latencySum += std::chrono::duration_cast<std::chrono::nanoseconds>(latency);
+        ++statistics.latencyBuckets[getLatencyBucket(latency)];
+    }
+    if (slowOperationLog && slowOperationLog->isSlow(latency))
+        slowOperationLog->add(ns, type, keyCount, bytesSent + bytesReceived, latency, now);
+}
+
+StatisticsCollector::StatisticsCollector():
+    enabled(false),
+    maxNamespaces(StatisticsConfiguration().maxNamespaces),
+    nextRequestId(0)
+{
+}
+
+void StatisticsCollector::setSlowOperationLog(std::shared_ptr<SlowOperationLog> slowOperationLog)
+{
+    this->slowOperationLog = slowOperationLog;
+}
+
+void StatisticsCollector::setConfiguration(const StatisticsConfiguration& configuration)
+{
+    enabled = configuration.enabled;
+    maxNamespaces = configuration.maxNamespaces;
+}
+
+std::shared_ptr<StatisticsCollector::Measurement::Record>& StatisticsCollector::getRecord(const std::string& ns,
+                                                                                           OperationType type)
+{
+    auto i(namespaces.find(ns));
+    if (i == namespaces.end())
+    {
+        /* Namespaces beyond the limit share one bucket, so that the memory and the size
+         * of the exported statistics stay bounded.
+         */
+        if (namespaces.size() >= maxNamespaces)
+        {
+            auto& record(otherNamespaces[static_cast<std::size_t>(type)]);
+            if (!record)
+                record = std::make_shared<Measurement::Record>(Measurement::Record{ OTHER_NAMESPACE, type, Statistics::OperationStatistics() });
+            return record;
+        }
+        i = namespaces.emplace(ns, Records()).first;
+    }
+    auto& record(i->second[static_cast<std::size_t>(type)]);
+    if (!record)
+        record = std::make_shared<Measurement::Record>(Measurement::Record{ ns, type, Statistics::OperationStatistics() });
+    return record;
+}
+
+StatisticsCollector::Measurement StatisticsCollector::start(const std::string& ns,
+                                                            OperationType type,
+                                                            std::size_t keyCount,
+                                                            std::uint64_t bytesSent)
+{
+    const auto requestId(++nextRequestId);
+    SHAREDDATALAYER_PROBE(operation_start, requestId, ns.c_str(), Statistics::getOperationName(type), bytesSent);
+    return Measurement(enabled ? getRecord(ns, type) : nullptr, slowOperationLog, ns, type, requestId, keyCount, bytesSent);
+}
+
+Statistics StatisticsCollector::getStatistics() const
+{
+    Statistics::NamespaceStatisticsMap statistics;
+    for (const auto& ns : namespaces)
+        for (const auto& record : ns.second)
+            if (record && record->statistics.count)
+                statistics[ns.first][record->type] = record->statistics;
+    for (const auto& record : otherNamespaces)
+        if (record && record->statistics.count)
+            statistics[OTHER_NAMESPACE][record->type] = record->statistics;
+    if (slowOperationLog)
+        return Statistics(statistics, slowOperationLog->getSlowOperations());
+    return Statistics(statistics);
+}
+
+std::size_t StatisticsCollector::getLatencyBucket(const std::chrono::steady_clock::duration& latency)
+{
+    const auto nanoseconds(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count());
+    if (nanoseconds <= 1000)
+        return 0;
+    /* Smallest bucket whose bound of 2^i microseconds is not less than the latency. */
+    const auto microseconds((static_cast<std::uint64_t>(nanoseconds) + 999U) / 1000U);
+    const std::size_t bucket(64 - __builtin_clzll(microseconds - 1U));
+    return std::min(bucket, Statistics::LATENCY_BUCKETS - 1);
+}
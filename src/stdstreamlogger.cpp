@@ -21,15 +21,30 @@
 
 #include "private/stdstreamlogger.hpp"
 #include <iostream>
-#include <sstream>
 #include <syslog.h>
 #include <boost/iostreams/stream.hpp>
 #include <boost/iostreams/concepts.hpp>
+#include "private/asynclogwriter.hpp"
+#include "private/createlogger.hpp"
 
 using namespace shareddatalayer;
 
 namespace
 {
+    void output(int level, const char* text, std::size_t length)
+    {
+        if (level < LOG_ERR)
+            std::cout.write(text, length);
+        else
+            std::cerr.write(text, length);
+    }
+
+    AsyncLogWriter& getWriter()
+    {
+        static AsyncLogWriter& writer(AsyncLogWriter::createProcessWriter(SDL_LOG_PREFIX, output));
+        return writer;
+    }
+
     class Sink: public boost::iostreams::sink
     {
     public:
@@ -47,10 +62,7 @@ namespace
 
 std::streamsize Sink::write(const char* s, std::streamsize n)
 {
-    if (level < LOG_ERR)
-        std::cout << prefix << ": " << std::string(s, n);
-    else
-        std::cerr << prefix << ": " << std::string(s, n);
+    getWriter().write(level, prefix, s, static_cast<std::size_t>(n));
     return n;
 }
 
@@ -63,6 +75,11 @@ StdStreamLogger::~StdStreamLogger()
 {
 }
 
+void StdStreamLogger::waitFlushed()
+{
+    getWriter().waitFlushed(std::chrono::seconds(1));
+}
+
 std::ostream& StdStreamLogger::emerg()
 {
     if (osEmerg == nullptr)
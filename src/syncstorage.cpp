@@ -19,6 +19,7 @@
  * platform project (RICP).
 */
 
+#include "private/concurrentsyncstorage.hpp"
 #include "private/syncstorageimpl.hpp"
 #include <sdl/asyncstorage.hpp>
 #include <sdl/syncstorage.hpp>
@@ -29,3 +30,8 @@ std::unique_ptr<SyncStorage> SyncStorage::create()
 {
     return std::unique_ptr<SyncStorageImpl>(new SyncStorageImpl(AsyncStorage::create()));
 }
+
+std::unique_ptr<SyncStorage> SyncStorage::createThreadSafe()
+{
+    return std::unique_ptr<ConcurrentSyncStorage>(new ConcurrentSyncStorage(AsyncStorage::create()));
+}
@@ -20,44 +20,14 @@
 */
 
 #include <chrono>
-#include <sstream>
 #include <sdl/asyncstorage.hpp>
-#include <sdl/backenderror.hpp>
-#include <sdl/errorqueries.hpp>
-#include <sdl/invalidnamespace.hpp>
-#include <sdl/notconnected.hpp>
-#include <sdl/operationinterrupted.hpp>
-#include <sdl/rejectedbybackend.hpp>
 #include <sdl/rejectedbysdl.hpp>
-#include "private/redis/asyncredisstorage.hpp"
 #include "private/syncstorageimpl.hpp"
 #include "private/system.hpp"
+#include "private/throwexceptionforerrorcode.hpp"
 
 using namespace shareddatalayer;
 
-namespace
-{
-    void throwExceptionForErrorCode[[ noreturn ]](const std::error_code& ec)
-    {
-        if (ec == shareddatalayer::Error::BACKEND_FAILURE)
-            throw BackendError(ec.message());
-        else if (ec == shareddatalayer::Error::NOT_CONNECTED)
-            throw NotConnected(ec.message());
-        else if (ec == shareddatalayer::Error::OPERATION_INTERRUPTED)
-            throw OperationInterrupted(ec.message());
-        else if (ec == shareddatalayer::Error::REJECTED_BY_BACKEND)
-            throw RejectedByBackend(ec.message());
-        else if (ec == AsyncRedisStorage::ErrorCode::INVALID_NAMESPACE)
-            throw InvalidNamespace(ec.message());
-        else if (ec == shareddatalayer::Error::REJECTED_BY_SDL)
-            throw RejectedBySdl(ec.message());
-
-        std::ostringstream os;
-        os << "No corresponding SDL exception found for error code: " << ec.category().name() << " " << ec.value();
-        throw std::range_error(os.str());
-    }
-}
-
 /* TODO: This synchronous API implementation could probably be refactored to be boost::asio based
  * instead of current (bit error prone) poll based implementation.
  */
@@ -112,6 +82,13 @@ void SyncStorageImpl::findKeysAck(const std::error_code& error, const Keys& keys
     localKeys = keys;
 }
 
+void SyncStorageImpl::writeBatchAck(const std::error_code& error, const std::vector<bool>& statuses)
+{
+    synced = true;
+    localError = error;
+    localStatuses = statuses;
+}
+
 void SyncStorageImpl::verifyBackendResponse()
 {
     if(localError)
@@ -312,6 +289,36 @@ void SyncStorageImpl::removeAll(const Namespace& ns)
     verifyBackendResponse();
 }
 
+void SyncStorageImpl::removeByPrefix(const Namespace& ns, const std::string& keyPrefix)
+{
+    handlePendingEvents();
+    waitSdlToBeReady(ns);
+    synced = false;
+    asyncStorage->removeByPrefixAsync(ns,
+                                      keyPrefix,
+                                      std::bind(&shareddatalayer::SyncStorageImpl::modifyAck,
+                                                this,
+                                                std::placeholders::_1));
+    waitForOperationCallback();
+    verifyBackendResponse();
+}
+
+std::vector<bool> SyncStorageImpl::writeBatch(const Namespace& ns, const WriteBatch& writeBatch)
+{
+    handlePendingEvents();
+    waitSdlToBeReady(ns);
+    synced = false;
+    asyncStorage->writeBatchAsync(ns,
+                                  writeBatch,
+                                  std::bind(&shareddatalayer::SyncStorageImpl::writeBatchAck,
+                                            this,
+                                            std::placeholders::_1,
+                                            std::placeholders::_2));
+    waitForOperationCallback();
+    verifyBackendResponse();
+    return localStatuses;
+}
+
 void SyncStorageImpl::handlePendingEvents()
 {
     int pollRetVal = system.poll(&events, 1, 0);
@@ -326,4 +333,5 @@ void SyncStorageImpl::handlePendingEvents()
 void SyncStorageImpl::setOperationTimeout(const std::chrono::steady_clock::duration& timeout)
 {
     operationTimeout = timeout;
+    asyncStorage->setOperationTimeout(timeout);
 }
@@ -21,15 +21,27 @@
 
 #include "private/systemlogger.hpp"
 #include <ostream>
-#include <sstream>
 #include <syslog.h>
 #include <boost/iostreams/stream.hpp>
 #include <boost/iostreams/concepts.hpp>
+#include "private/asynclogwriter.hpp"
+#include "private/createlogger.hpp"
 
 using namespace shareddatalayer;
 
 namespace
 {
+    void output(int level, const char* text, std::size_t length)
+    {
+        syslog(level, "%.*s", static_cast<int>(length), text);
+    }
+
+    AsyncLogWriter& getWriter()
+    {
+        static AsyncLogWriter& writer(AsyncLogWriter::createProcessWriter(SDL_LOG_PREFIX, output));
+        return writer;
+    }
+
     class Sink: public boost::iostreams::sink
     {
     public:
@@ -47,9 +59,7 @@ namespace
 
 std::streamsize Sink::write(const char* s, std::streamsize n)
 {
-    std::ostringstream os;
-    os << "%s: %." << n << 's';
-    syslog(level, os.str().c_str(), prefix.c_str(), s);
+    getWriter().write(level, prefix, s, static_cast<std::size_t>(n));
     return n;
 }
 
@@ -62,6 +72,11 @@ SystemLogger::~SystemLogger()
 {
 }
 
+void SystemLogger::waitFlushed()
+{
+    getWriter().waitFlushed(std::chrono::seconds(1));
+}
+
 std::ostream& SystemLogger::emerg()
 {
     if (osEmerg == nullptr)
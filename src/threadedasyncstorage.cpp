@@ -0,0 +1,280 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include "private/threadedasyncstorage.hpp"
+#include <type_traits>
+#include "private/abort.hpp"
+#include "private/engine.hpp"
+#include "private/error.hpp"
+
+using namespace shareddatalayer;
+
+ThreadedAsyncStorage::ThreadedAsyncStorage(std::shared_ptr<Engine> engine,
+                                           std::unique_ptr<AsyncStorage> asyncStorage,
+                                           const Executor& executor):
+    engine(engine),
+    asyncStorage(std::move(asyncStorage)),
+    executor(executor),
+    alive(std::make_shared<bool>(true))
+{
+    /* The callback queue of the engine is created on first use. Create it before other
+     * threads can post to it, this also gives the I/O thread an event source to wait on.
+     */
+    this->engine->postCallback([] () { });
+    ioThread = std::thread([engine] () { engine->run(); });
+}
+
+ThreadedAsyncStorage::~ThreadedAsyncStorage()
+{
+    /* The I/O thread cannot join itself, and operations queued for it refer to this instance. */
+    if (std::this_thread::get_id() == ioThread.get_id())
+        SHAREDDATALAYER_ABORT("ThreadedAsyncStorage destroyed in its own I/O thread, for example in an acknowledgement");
+    /* Scan continuations called from now on fail instead of posting to the stopped engine. */
+    alive.reset();
+    /* Operations posted before stopping are still started, but their acknowledgements
+     * are not called as the wrapped AsyncStorage is destroyed after the I/O thread exits.
+     */
+    engine->stop();
+    ioThread.join();
+}
+
+int ThreadedAsyncStorage::fd() const
+{
+    return -1;
+}
+
+void ThreadedAsyncStorage::handleEvents()
+{
+}
+
+template <typename... Args>
+std::function<void(Args...)> ThreadedAsyncStorage::deliver(const std::function<void(Args...)>& ack) const
+{
+    if (!executor)
+        return ack;
+    const auto executor(this->executor);
+    return [executor, ack] (Args... args)
+           {
+               executor(std::bind(ack, typename std::decay<Args>::type(args)...));
+           };
+}
+
+void ThreadedAsyncStorage::waitReadyAsync(const Namespace& ns, const ReadyAck& readyAck)
+{
+    const auto ack(deliver(readyAck));
+    engine->postCallback([this, ns, ack] () { asyncStorage->waitReadyAsync(ns, ack); });
+}
+
+void ThreadedAsyncStorage::setAsync(const Namespace& ns, const DataMap& dataMap, const ModifyAck& modifyAck)
+{
+    const auto ack(deliver(modifyAck));
+    engine->postCallback([this, ns, dataMap, ack] () { asyncStorage->setAsync(ns, dataMap, ack); });
+}
+
+void ThreadedAsyncStorage::setIfAsync(const Namespace& ns, const Key& key, const Data& oldData, const Data& newData, const ModifyIfAck& modifyIfAck)
+{
+    const auto ack(deliver(modifyIfAck));
+    engine->postCallback([this, ns, key, oldData, newData, ack] () { asyncStorage->setIfAsync(ns, key, oldData, newData, ack); });
+}
+
+void ThreadedAsyncStorage::setIfNotExistsAsync(const Namespace& ns, const Key& key, const Data& data, const ModifyIfAck& modifyIfAck)
+{
+    const auto ack(deliver(modifyIfAck));
+    engine->postCallback([this, ns, key, data, ack] () { asyncStorage->setIfNotExistsAsync(ns, key, data, ack); });
+}
+
+void ThreadedAsyncStorage::getAsync(const Namespace& ns, const Keys& keys, const GetAck& getAck)
+{
+    const auto ack(deliver(getAck));
+    engine->postCallback([this, ns, keys, ack] () { asyncStorage->getAsync(ns, keys, ack); });
+}
+
+void ThreadedAsyncStorage::getViewsAsync(const Namespace& ns, const Keys& keys, const GetViewsAck& getViewsAck)
+{
+    if (!executor)
+    {
+        engine->postCallback([this, ns, keys, getViewsAck] () { asyncStorage->getViewsAsync(ns, keys, getViewsAck); });
+        return;
+    }
+    /* Views are valid only during the acknowledgement, thus the data is copied for the
+     * task run by the executor.
+     */
+    const auto executor(this->executor);
+    const auto ack([executor, getViewsAck] (const std::error_code& error, const DataViews& dataViews)
+                   {
+                       auto copies(std::make_shared<std::vector<std::pair<Key, Data>>>());
+                       copies->reserve(dataViews.size());
+                       for (const auto& i : dataViews)
+                           copies->emplace_back(*i.first, Data(i.second.data, i.second.data + i.second.size));
+                       executor([getViewsAck, error, copies] ()
+                                {
+                                    DataViews copiedViews;
+                                    copiedViews.reserve(copies->size());
+                                    for (const auto& i : *copies)
+                                        copiedViews.push_back({ &i.first, { i.second.data(), i.second.size() } });
+                                    getViewsAck(error, copiedViews);
+                                });
+                   });
+    engine->postCallback([this, ns, keys, ack] () { asyncStorage->getViewsAsync(ns, keys, ack); });
+}
+
+void ThreadedAsyncStorage::getViewsAsync(const Namespace& ns, const Keys& keys, const DataVisitor& dataVisitor, const GetVisitAck& getVisitAck)
+{
+    if (!executor)
+    {
+        engine->postCallback([this, ns, keys, dataVisitor, getVisitAck] ()
+                             {
+                                 asyncStorage->getViewsAsync(ns, keys, dataVisitor, getVisitAck);
+                             });
+        return;
+    }
+    /* Visited data is copied and the visitor is called for the copies in the task run by
+     * the executor, right before the acknowledgement.
+     */
+    const auto executor(this->executor);
+    auto visited(std::make_shared<std::vector<std::pair<Key, Data>>>());
+    const DataVisitor visitor([visited] (const Key& key, const DataView& data)
+                              {
+                                  visited->emplace_back(key, Data(data.data, data.data + data.size));
+                              });
+    const GetVisitAck ack([executor, dataVisitor, getVisitAck, visited] (const std::error_code& error)
+                          {
+                              executor([dataVisitor, getVisitAck, visited, error] ()
+                                       {
+                                           for (const auto& i : *visited)
+                                               dataVisitor(i.first, { i.second.data(), i.second.size() });
+                                           getVisitAck(error);
+                                       });
+                          });
+    engine->postCallback([this, ns, keys, visitor, ack] () { asyncStorage->getViewsAsync(ns, keys, visitor, ack); });
+}
+
+void ThreadedAsyncStorage::removeAsync(const Namespace& ns, const Keys& keys, const ModifyAck& modifyAck)
+{
+    const auto ack(deliver(modifyAck));
+    engine->postCallback([this, ns, keys, ack] () { asyncStorage->removeAsync(ns, keys, ack); });
+}
+
+void ThreadedAsyncStorage::removeIfAsync(const Namespace& ns, const Key& key, const Data& data, const ModifyIfAck& modifyIfAck)
+{
+    const auto ack(deliver(modifyIfAck));
+    engine->postCallback([this, ns, key, data, ack] () { asyncStorage->removeIfAsync(ns, key, data, ack); });
+}
+
+void ThreadedAsyncStorage::findKeysAsync(const Namespace& ns, const std::string& keyPrefix, const FindKeysAck& findKeysAck)
+{
+    const auto ack(deliver(findKeysAck));
+    engine->postCallback([this, ns, keyPrefix, ack] () { asyncStorage->findKeysAsync(ns, keyPrefix, ack); });
+}
+
+void ThreadedAsyncStorage::listKeys(const Namespace& ns, const std::string& pattern, const FindKeysAck& findKeysAck)
+{
+    const auto ack(deliver(findKeysAck));
+    engine->postCallback([this, ns, pattern, ack] () { asyncStorage->listKeys(ns, pattern, ack); });
+}
+
+void ThreadedAsyncStorage::scanKeysAsync(const Namespace& ns, const std::string& pattern, std::size_t countHint, const ScanKeysAck& scanKeysAck)
+{
+    /* The next page can be requested from any thread, thus the request is posted to
+     * the I/O thread.
+     */
+    const auto engine(this->engine);
+    const std::weak_ptr<bool> weakAlive(alive);
+    const auto userAck(deliver(scanKeysAck));
+    const ScanKeysAck ack([engine, weakAlive, userAck] (const std::error_code& error, const Keys& keys, const ScanKeysNext& next)
+                          {
+                              if (!next)
+                              {
+                                  userAck(error, keys, next);
+                                  return;
+                              }
+                              userAck(error, keys, [engine, weakAlive, userAck, next] ()
+                                                   {
+                                                       if (weakAlive.expired())
+                                                           userAck(std::error_code(redis::AsyncRedisCommandDispatcherErrorCode::NOT_CONNECTED),
+                                                                   Keys(),
+                                                                   ScanKeysNext());
+                                                       else
+                                                           engine->postCallback(next);
+                                                   });
+                          });
+    engine->postCallback([this, ns, pattern, countHint, ack] () { asyncStorage->scanKeysAsync(ns, pattern, countHint, ack); });
+}
+
+void ThreadedAsyncStorage::removeAllAsync(const Namespace& ns, const ModifyAck& modifyAck)
+{
+    const auto ack(deliver(modifyAck));
+    engine->postCallback([this, ns, ack] () { asyncStorage->removeAllAsync(ns, ack); });
+}
+
+void ThreadedAsyncStorage::removeByPrefixAsync(const Namespace& ns, const std::string& keyPrefix, const ModifyAck& modifyAck)
+{
+    const auto ack(deliver(modifyAck));
+    engine->postCallback([this, ns, keyPrefix, ack] () { asyncStorage->removeByPrefixAsync(ns, keyPrefix, ack); });
+}
+
+void ThreadedAsyncStorage::subscribeChannelAsync(const Namespace& ns, const Channels& channels, const NotificationCb& notificationCb, const ModifyAck& subscribeAck)
+{
+    const auto cb(deliver(notificationCb));
+    const auto ack(deliver(subscribeAck));
+    engine->postCallback([this, ns, channels, cb, ack] () { asyncStorage->subscribeChannelAsync(ns, channels, cb, ack); });
+}
+
+void ThreadedAsyncStorage::unsubscribeChannelAsync(const Namespace& ns, const Channels& channels, const ModifyAck& unsubscribeAck)
+{
+    const auto ack(deliver(unsubscribeAck));
+    engine->postCallback([this, ns, channels, ack] () { asyncStorage->unsubscribeChannelAsync(ns, channels, ack); });
+}
+
+void ThreadedAsyncStorage::publishAsync(const Namespace& ns, const Channel& channel, const std::string& message, const ModifyAck& modifyAck)
+{
+    const auto ack(deliver(modifyAck));
+    engine->postCallback([this, ns, channel, message, ack] () { asyncStorage->publishAsync(ns, channel, message, ack); });
+}
+
+void ThreadedAsyncStorage::getBatchAsync(const NamespaceKeys& namespaceKeys, const GetBatchAck& getBatchAck)
+{
+    const auto ack(deliver(getBatchAck));
+    engine->postCallback([this, namespaceKeys, ack] () { asyncStorage->getBatchAsync(namespaceKeys, ack); });
+}
+
+void ThreadedAsyncStorage::setBatchAsync(const NamespaceDataMaps& namespaceDataMaps, const ModifyAck& modifyAck)
+{
+    const auto ack(deliver(modifyAck));
+    engine->postCallback([this, namespaceDataMaps, ack] () { asyncStorage->setBatchAsync(namespaceDataMaps, ack); });
+}
+
+void ThreadedAsyncStorage::writeBatchAsync(const Namespace& ns, const WriteBatch& writeBatch, const WriteBatchAck& writeBatchAck)
+{
+    const auto ack(deliver(writeBatchAck));
+    engine->postCallback([this, ns, writeBatch, ack] () { asyncStorage->writeBatchAsync(ns, writeBatch, ack); });
+}
+
+void ThreadedAsyncStorage::getStatisticsAsync(const GetStatisticsAck& getStatisticsAck)
+{
+    const auto ack(deliver(getStatisticsAck));
+    engine->postCallback([this, ack] () { asyncStorage->getStatisticsAsync(ack); });
+}
+
+void ThreadedAsyncStorage::setOperationTimeout(const std::chrono::steady_clock::duration& timeout)
+{
+    engine->postCallback([this, timeout] () { asyncStorage->setOperationTimeout(timeout); });
+}
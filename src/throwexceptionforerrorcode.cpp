@@ -0,0 +1,54 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <sstream>
+#include <stdexcept>
+#include <sdl/backenderror.hpp>
+#include <sdl/errorqueries.hpp>
+#include <sdl/invalidnamespace.hpp>
+#include <sdl/notconnected.hpp>
+#include <sdl/operationinterrupted.hpp>
+#include <sdl/rejectedbybackend.hpp>
+#include <sdl/rejectedbysdl.hpp>
+#include "private/redis/asyncredisstorage.hpp"
+#include "private/throwexceptionforerrorcode.hpp"
+
+using namespace shareddatalayer;
+
+void shareddatalayer::throwExceptionForErrorCode(const std::error_code& ec)
+{
+    if (ec == shareddatalayer::Error::BACKEND_FAILURE)
+        throw BackendError(ec.message());
+    else if (ec == shareddatalayer::Error::NOT_CONNECTED)
+        throw NotConnected(ec.message());
+    else if (ec == shareddatalayer::Error::OPERATION_INTERRUPTED)
+        throw OperationInterrupted(ec.message());
+    else if (ec == shareddatalayer::Error::REJECTED_BY_BACKEND)
+        throw RejectedByBackend(ec.message());
+    else if (ec == AsyncRedisStorage::ErrorCode::INVALID_NAMESPACE)
+        throw InvalidNamespace(ec.message());
+    else if (ec == shareddatalayer::Error::REJECTED_BY_SDL)
+        throw RejectedBySdl(ec.message());
+
+    std::ostringstream os;
+    os << "No corresponding SDL exception found for error code: " << ec.category().name() << " " << ec.value();
+    throw std::range_error(os.str());
+}
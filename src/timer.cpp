@@ -27,7 +27,11 @@ using namespace shareddatalayer;
 
 Timer::Timer(Engine& engine):
     engine(engine),
-    armed(false)
+    armed(false),
+    expiry(0U),
+    slot(0U),
+    previous(nullptr),
+    next(nullptr)
 {
 }
 
@@ -36,13 +40,15 @@ Timer::~Timer()
     disarm();
 }
 
-void Timer::arm(const Duration& duration, const Callback& cb)
+void Timer::arm(const Duration& duration, Function cb)
 {
     if (!cb)
         SHAREDDATALAYER_ABORT("Timer::arm: a null callback");
 
     disarm();
-    engine.armTimer(*this, duration, [this, cb] () { armed = false; cb(); });
+    function = std::move(cb);
+    /* Capturing only this keeps the engine callback within std::function small object storage. */
+    engine.armTimer(*this, duration, [this] () { expire(); });
     armed = true;
 }
 
@@ -53,4 +59,13 @@ void Timer::disarm()
 
     engine.disarmTimer(*this);
     armed = false;
+    function = nullptr;
+}
+
+void Timer::expire()
+{
+    /* The callback may arm this timer again, so it is moved out before calling. */
+    armed = false;
+    const auto cb(std::move(function));
+    cb();
 }
@@ -20,11 +20,19 @@
 */
 
 #include "private/timerfd.hpp"
+#include <algorithm>
+#include <limits>
 #include "private/engine.hpp"
 #include "private/system.hpp"
 
 using namespace shareddatalayer;
 
+namespace
+{
+    const Timer::Duration RESOLUTION(std::chrono::milliseconds(1));
+    const uint64_t NOT_ARMED(std::numeric_limits<uint64_t>::max());
+}
+
 TimerFD::TimerFD(Engine& engine):
     TimerFD(System::getSystem(), engine)
 {
@@ -32,7 +40,12 @@ TimerFD::TimerFD(Engine& engine):
 
 TimerFD::TimerFD(System& system, Engine& engine):
     system(system),
-    fd(system, system.timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC))
+    fd(system, system.timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC)),
+    slots(),
+    occupied(),
+    currentTicks(0U),
+    armedTicks(NOT_ARMED),
+    count(0U)
 {
     engine.addMonitoredFD(fd, Engine::EVENT_IN, std::bind(&TimerFD::handleEvents, this));
 }
@@ -43,38 +56,95 @@ TimerFD::~TimerFD()
 
 void TimerFD::arm(Timer& timer, const Timer::Duration& duration, const Timer::Callback& cb)
 {
-    const auto absolute(toAbsolute(duration));
-    const auto i(queue.insert(std::make_pair(absolute, std::make_pair(&timer, cb))));
-    timer.iterator = i;
-    if (isFirst(i))
-        armTimerFD(absolute);
+    const auto current(now());
+    const auto absolute(current + duration);
+    /* Time of the wheel is never moved backwards, as callbacks may arm timers while it is ahead of now. */
+    if (count == 0U)
+        currentTicks = std::max(currentTicks, toTicks(current));
+    timer.callback = cb;
+    timer.expiry = toTicks(absolute + RESOLUTION - Timer::Duration(1));
+    insert(timer);
+    ++count;
+    /* A timer armed by a callback may expire before the current time of the wheel. */
+    const auto ticks(std::max(timer.expiry, currentTicks));
+    if (ticks < armedTicks)
+        armTimerFD(ticks);
 }
 
-bool TimerFD::isFirst(Queue::iterator it) const
+void TimerFD::disarm(const Timer& timer)
 {
-    return queue.begin() == it;
+    unlink(timer);
+    timer.callback = Timer::Callback();
+    --count;
+    if (count == 0U)
+        disarmTimerFD();
 }
 
-void TimerFD::disarm(const Timer& timer)
+uint64_t TimerFD::toTicks(const Timer::Duration& duration) const
 {
-    const bool wasFirst(isFirst(timer.iterator));
-    queue.erase(timer.iterator);
+    return static_cast<uint64_t>(duration / RESOLUTION);
+}
 
-    if (queue.empty())
-        disarmTimerFD();
-    else if (wasFirst)
-        armTimerFD(nextTrigger());
+Timer::Duration TimerFD::now() const
+{
+    return std::chrono::duration_cast<Timer::Duration>(system.time_since_epoch());
 }
 
-Timer::Duration TimerFD::toAbsolute(const Timer::Duration& duration)
+void TimerFD::insert(Timer& timer)
 {
-    return std::chrono::duration_cast<Timer::Duration>(system.time_since_epoch()) + duration;
+    /*
+     * The level of the timer is selected by the most significant bit group in
+     * which the expiration time differs from the current time. Thus timers on
+     * lower levels always expire before the timers on higher levels and a slot
+     * is cascaded to lower levels when the current time reaches its start.
+     */
+    const uint64_t ticks(std::max(timer.expiry, currentTicks));
+    const uint64_t difference(ticks ^ currentTicks);
+    if ((difference >> (LEVELS * SLOT_BITS)) != 0U)
+        timer.slot = OVERFLOW_SLOT;
+    else
+    {
+        const unsigned int level((difference == 0U) ? 0U : (63U - __builtin_clzll(difference)) / SLOT_BITS);
+        const unsigned int index((ticks >> (level * SLOT_BITS)) & (SLOTS_PER_LEVEL - 1U));
+        timer.slot = level * SLOTS_PER_LEVEL + index;
+        occupied[level] |= (1ULL << index);
+    }
+    auto& slot(slots[timer.slot]);
+    timer.previous = slot.last;
+    timer.next = nullptr;
+    if (slot.last != nullptr)
+        slot.last->next = &timer;
+    else
+        slot.first = &timer;
+    slot.last = &timer;
+}
+
+void TimerFD::unlink(const Timer& timer)
+{
+    auto& slot(slots[timer.slot]);
+    if (timer.previous != nullptr)
+        timer.previous->next = timer.next;
+    else
+        slot.first = timer.next;
+    if (timer.next != nullptr)
+        timer.next->previous = timer.previous;
+    else
+        slot.last = timer.previous;
+    if ((slot.first == nullptr) && (timer.slot < OVERFLOW_SLOT))
+        occupied[timer.slot / SLOTS_PER_LEVEL] &= ~(1ULL << (timer.slot % SLOTS_PER_LEVEL));
 }
 
 void TimerFD::handleEvents()
 {
-    if (timerExpired())
-        handleExpiredTimers();
+    if (!timerExpired())
+        return;
+
+    /* The timerfd has expired, so at least the armed time has passed. */
+    auto nowTicks(toTicks(now()));
+    if ((armedTicks != NOT_ARMED) && (armedTicks > nowTicks))
+        nowTicks = armedTicks;
+    handleExpiredTimers(nowTicks);
+    updateTimerFD();
 }
 
 bool TimerFD::timerExpired() const
@@ -83,45 +153,120 @@ bool TimerFD::timerExpired() const
     return (system.read(fd, &count, sizeof(count)) == sizeof(count)) && (count > 0U);
 }
 
-void TimerFD::handleExpiredTimers()
+void TimerFD::handleExpiredTimers(uint64_t nowTicks)
 {
-    const auto now(system.time_since_epoch());
-    do
+    unsigned int slot;
+    uint64_t startTicks;
+    while (nextSlot(slot, startTicks) && (startTicks <= nowTicks))
     {
-        popAndExecuteFirstTimer();
-        if (queue.empty())
+        currentTicks = startTicks;
+        if (slot < SLOTS_PER_LEVEL)
+            moveToExpired(slot);
+        else
+            cascadeSlot(slot);
+    }
+    currentTicks = std::max(currentTicks, nowTicks);
+    callExpiredTimers();
+}
+
+bool TimerFD::nextSlot(unsigned int& slot, uint64_t& startTicks) const
+{
+    for (unsigned int level(0U); level < LEVELS; ++level)
+        if (occupied[level] != 0U)
         {
-            disarmTimerFD();
-            return;
+            const unsigned int index(__builtin_ctzll(occupied[level]));
+            const unsigned int shift(level * SLOT_BITS);
+            slot = level * SLOTS_PER_LEVEL + index;
+            startTicks = ((currentTicks >> (shift + SLOT_BITS)) << (shift + SLOT_BITS)) | (static_cast<uint64_t>(index) << shift);
+            return true;
         }
+    if (slots[OVERFLOW_SLOT].first != nullptr)
+    {
+        slot = OVERFLOW_SLOT;
+        startTicks = ((currentTicks >> (LEVELS * SLOT_BITS)) + 1U) << (LEVELS * SLOT_BITS);
+        return true;
     }
-    while (queue.begin()->first <= now);
-    armTimerFD(nextTrigger());
+    return false;
 }
 
-void TimerFD::popAndExecuteFirstTimer()
+void TimerFD::moveToExpired(unsigned int slot)
 {
-    const auto i(queue.begin());
-    const auto cb(i->second.second);
-    queue.erase(i);
-    cb();
+    auto& expired(slots[EXPIRED_SLOT]);
+    const auto first(slots[slot].first);
+    for (auto timer(first); timer != nullptr; timer = timer->next)
+        timer->slot = EXPIRED_SLOT;
+    if (expired.last != nullptr)
+        expired.last->next = first;
+    else
+        expired.first = first;
+    first->previous = expired.last;
+    expired.last = slots[slot].last;
+    slots[slot] = Slot { nullptr, nullptr };
+    occupied[slot / SLOTS_PER_LEVEL] &= ~(1ULL << (slot % SLOTS_PER_LEVEL));
 }
 
-Timer::Duration TimerFD::nextTrigger() const
+void TimerFD::callExpiredTimers()
 {
-    return queue.begin()->first;
+    /* Callbacks may arm and disarm timers, so the list is re-read after each callback. */
+    while (slots[EXPIRED_SLOT].first != nullptr)
+    {
+        const auto& timer(*slots[EXPIRED_SLOT].first);
+        unlink(timer);
+        --count;
+        const auto cb(std::move(timer.callback));
+        timer.callback = Timer::Callback();
+        cb();
+    }
+}
+
+void TimerFD::cascadeSlot(unsigned int slot)
+{
+    auto timer(slots[slot].first);
+    slots[slot] = Slot { nullptr, nullptr };
+    if (slot != OVERFLOW_SLOT)
+        occupied[slot / SLOTS_PER_LEVEL] &= ~(1ULL << (slot % SLOTS_PER_LEVEL));
+    while (timer != nullptr)
+    {
+        const auto next(timer->next);
+        insert(*timer);
+        timer = next;
+    }
+}
+
+uint64_t TimerFD::earliestExpiry() const
+{
+    unsigned int slot;
+    uint64_t startTicks;
+    if (!nextSlot(slot, startTicks) || (slot < SLOTS_PER_LEVEL))
+        return startTicks;
+    /* Timers on higher levels are not sorted, so the whole slot is checked. */
+    auto ticks(NOT_ARMED);
+    for (auto timer(slots[slot].first); timer != nullptr; timer = timer->next)
+        ticks = std::min(ticks, timer->expiry);
+    return ticks;
+}
+
+void TimerFD::updateTimerFD()
+{
+    if (count == 0U)
+        disarmTimerFD();
+    else
+        armTimerFD(earliestExpiry());
 }
 
 void TimerFD::disarmTimerFD()
 {
+    armedTicks = NOT_ARMED;
     setTimeForTimerFD(0, 0);
 }
 
-void TimerFD::armTimerFD(const Timer::Duration& duration)
+void TimerFD::armTimerFD(uint64_t ticks)
 {
     static const long int NANOSECONDS_IN_ONE_SECOND(1E9);
+    const auto duration(std::chrono::duration_cast<std::chrono::nanoseconds>(ticks * RESOLUTION));
+    armedTicks = ticks;
     setTimeForTimerFD(std::chrono::duration_cast<std::chrono::seconds>(duration).count(),
-                      std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() % NANOSECONDS_IN_ONE_SECOND);
+                      duration.count() % NANOSECONDS_IN_ONE_SECOND);
 }
 
 void TimerFD::setTimeForTimerFD(time_t seconds, long int nanoseconds)
@@ -0,0 +1,54 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <sdl/writebatch.hpp>
+
+using namespace shareddatalayer;
+
+WriteBatch& WriteBatch::set(const DataMap& dataMap)
+{
+    operations.push_back({ OperationType::SET, dataMap, Keys(), Key(), Data(), Data() });
+    return *this;
+}
+
+WriteBatch& WriteBatch::remove(const Keys& keys)
+{
+    operations.push_back({ OperationType::REMOVE, DataMap(), keys, Key(), Data(), Data() });
+    return *this;
+}
+
+WriteBatch& WriteBatch::setIf(const Key& key, const Data& oldData, const Data& newData)
+{
+    operations.push_back({ OperationType::SET_IF, DataMap(), Keys(), key, oldData, newData });
+    return *this;
+}
+
+WriteBatch& WriteBatch::setIfNotExists(const Key& key, const Data& data)
+{
+    operations.push_back({ OperationType::SET_IF_NOT_EXISTS, DataMap(), Keys(), key, Data(), data });
+    return *this;
+}
+
+WriteBatch& WriteBatch::removeIf(const Key& key, const Data& data)
+{
+    operations.push_back({ OperationType::REMOVE_IF, DataMap(), Keys(), key, Data(), data });
+    return *this;
+}
@@ -20,10 +20,67 @@
 */
 
 #include <type_traits>
+#include <memory>
 #include <gtest/gtest.h>
+#include "private/error.hpp"
 #include "private/redis/asynccommanddispatcher.hpp"
+#include "private/redis/contents.hpp"
+#include "private/redis/contentsbuilder.hpp"
+#include "private/redis/script.hpp"
+#include "private/tst/asynccommanddispatchermock.hpp"
+#include "private/tst/moveargaction.hpp"
+#include "private/tst/replymock.hpp"
+#include "private/tst/wellknownerrorcode.hpp"
 
+using namespace shareddatalayer;
 using namespace shareddatalayer::redis;
+using namespace shareddatalayer::tst;
+using namespace testing;
+
+namespace
+{
+    class AsyncCommandDispatcherScriptTest: public testing::Test
+    {
+    public:
+        StrictMock<AsyncCommandDispatcherMock> dispatcherMock;
+        ContentsBuilder contentsBuilder;
+        Script script;
+        AsyncConnection::Namespace ns;
+        Contents evalShaContents;
+        Contents evalContents;
+        AsyncCommandDispatcher::CommandCb savedCommandCb;
+        ReplyMock replyMock;
+
+        AsyncCommandDispatcherScriptTest():
+            contentsBuilder(','),
+            script("return ARGV[1]"),
+            ns("ns"),
+            evalShaContents(contentsBuilder.build(script, ns, { "key" }, { "arg" })),
+            evalContents(contentsBuilder.build("EVAL", { script.getSource(), "1", "{ns},key", "arg" }))
+        {
+        }
+
+        MOCK_METHOD2(ack, void(const std::error_code&, const Reply&));
+
+        void expectDispatchAsync(const Contents& contents)
+        {
+            EXPECT_CALL(dispatcherMock, dispatchAsync(_, ns, contents))
+                .Times(1)
+                .WillOnce(SaveMovedArg<0>(&savedCommandCb));
+        }
+
+        void dispatchScriptAsync()
+        {
+            dispatcherMock.dispatchScriptAsync(std::bind(&AsyncCommandDispatcherScriptTest::ack,
+                                                         this,
+                                                         std::placeholders::_1,
+                                                         std::placeholders::_2),
+                                               ns,
+                                               script,
+                                               evalShaContents);
+        }
+    };
+}
 
 TEST(AsyncCommandDispatcherTest, IsNotCopyable)
 {
@@ -40,3 +97,55 @@ TEST(AsyncCommandDispatcherTest, IsAbstract)
 {
     EXPECT_TRUE(std::is_abstract<AsyncCommandDispatcher>::value);
 }
+
+TEST_F(AsyncCommandDispatcherScriptTest, ScriptIsInvokedBySha1AndReplyIsForwarded)
+{
+    InSequence dummy;
+    expectDispatchAsync(evalShaContents);
+    dispatchScriptAsync();
+    EXPECT_CALL(*this, ack(std::error_code(), Ref(replyMock)))
+        .Times(1);
+    savedCommandCb(std::error_code(), replyMock);
+}
+
+TEST_F(AsyncCommandDispatcherScriptTest, ScriptIsSentAsSuchIfItIsMissingFromScriptCache)
+{
+    InSequence dummy;
+    expectDispatchAsync(evalShaContents);
+    dispatchScriptAsync();
+    expectDispatchAsync(evalContents);
+    savedCommandCb(AsyncRedisCommandDispatcherErrorCode::NO_SCRIPT, replyMock);
+    EXPECT_CALL(*this, ack(std::error_code(), Ref(replyMock)))
+        .Times(1);
+    savedCommandCb(std::error_code(), replyMock);
+}
+
+TEST_F(AsyncCommandDispatcherScriptTest, OtherErrorsAreForwardedWithoutRetry)
+{
+    InSequence dummy;
+    expectDispatchAsync(evalShaContents);
+    dispatchScriptAsync();
+    EXPECT_CALL(*this, ack(getWellKnownErrorCode(), _))
+        .Times(1);
+    savedCommandCb(getWellKnownErrorCode(), replyMock);
+}
+
+TEST_F(AsyncCommandDispatcherScriptTest, MissingScriptErrorIsForwardedIfDispatcherHasBeenDestroyed)
+{
+    InSequence dummy;
+    std::unique_ptr<StrictMock<AsyncCommandDispatcherMock>> destroyedDispatcherMock(new StrictMock<AsyncCommandDispatcherMock>());
+    EXPECT_CALL(*destroyedDispatcherMock, dispatchAsync(_, ns, evalShaContents))
+        .Times(1)
+        .WillOnce(SaveMovedArg<0>(&savedCommandCb));
+    destroyedDispatcherMock->dispatchScriptAsync(std::bind(&AsyncCommandDispatcherScriptTest::ack,
+                                                           this,
+                                                           std::placeholders::_1,
+                                                           std::placeholders::_2),
+                                                 ns,
+                                                 script,
+                                                 evalShaContents);
+    destroyedDispatcherMock.reset();
+    EXPECT_CALL(*this, ack(std::error_code(AsyncRedisCommandDispatcherErrorCode::NO_SCRIPT), Ref(replyMock)))
+        .Times(1);
+    savedCommandCb(AsyncRedisCommandDispatcherErrorCode::NO_SCRIPT, replyMock);
+}
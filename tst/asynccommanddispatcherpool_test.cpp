@@ -0,0 +1,376 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <type_traits>
+#include <memory>
+#include <gtest/gtest.h>
+#include <sdl/asyncstorage.hpp>
+#include "private/redis/asynccommanddispatcherpool.hpp"
+#include "private/redis/contentsbuilder.hpp"
+#include "private/tst/asynccommanddispatchermock.hpp"
+#include "private/tst/moveargaction.hpp"
+#include "private/tst/replymock.hpp"
+#include "private/tst/systemmock.hpp"
+#include "private/tst/wellknownerrorcode.hpp"
+
+using namespace shareddatalayer;
+using namespace shareddatalayer::redis;
+using namespace shareddatalayer::tst;
+using namespace testing;
+
+namespace
+{
+    class AsyncCommandDispatcherPoolTest: public testing::Test
+    {
+    public:
+        static const std::size_t POOL_SIZE = 3;
+        std::vector<std::shared_ptr<StrictMock<AsyncCommandDispatcherMock>>> dispatcherMocks;
+        std::shared_ptr<AsyncCommandDispatcherPool> pool;
+        ContentsBuilder contentsBuilder;
+        const AsyncConnection::Namespace ns;
+        std::vector<AsyncCommandDispatcher::CommandCb> savedCommandCbs;
+        std::vector<AsyncCommandDispatcher::ConnectAck> savedConnectAcks;
+        std::vector<AsyncCommandDispatcher::DisconnectCb> savedDisconnectCbs;
+        ReplyMock replyMock;
+
+        AsyncCommandDispatcherPoolTest():
+            contentsBuilder(AsyncStorage::SEPARATOR),
+            ns("tag1"),
+            savedCommandCbs(POOL_SIZE),
+            savedConnectAcks(POOL_SIZE),
+            savedDisconnectCbs(POOL_SIZE)
+        {
+            AsyncCommandDispatcherPool::Dispatchers dispatchers;
+            for (std::size_t i(0); i < POOL_SIZE; ++i)
+            {
+                dispatcherMocks.push_back(std::make_shared<StrictMock<AsyncCommandDispatcherMock>>());
+                dispatchers.push_back(dispatcherMocks.back());
+            }
+            pool = std::make_shared<AsyncCommandDispatcherPool>(dispatchers);
+        }
+
+        Contents get(const AsyncConnection::Keys& keys)
+        {
+            return contentsBuilder.build("MGET", ns, keys);
+        }
+
+        void expectDispatchAsync(std::size_t dispatcher, const Contents& contents)
+        {
+            EXPECT_CALL(*dispatcherMocks[dispatcher], dispatchAsync(_, ns, contents))
+                .Times(1)
+                .WillOnce(SaveMovedArg<0>(&savedCommandCbs[dispatcher]));
+        }
+
+        void expectConnectionTracking()
+        {
+            for (std::size_t i(0); i < POOL_SIZE; ++i)
+            {
+                EXPECT_CALL(*dispatcherMocks[i], registerDisconnectCb(_))
+                    .Times(1)
+                    .WillOnce(SaveArg<0>(&savedDisconnectCbs[i]));
+                expectWaitConnectedAsync(i);
+            }
+        }
+
+        void expectWaitConnectedAsync(std::size_t dispatcher)
+        {
+            EXPECT_CALL(*dispatcherMocks[dispatcher], waitConnectedAsync(_))
+                .Times(1)
+                .WillOnce(SaveArg<0>(&savedConnectAcks[dispatcher]));
+        }
+
+        void waitConnected()
+        {
+            pool->waitConnectedAsync(std::bind(&AsyncCommandDispatcherPoolTest::connectAck, this));
+        }
+
+        void connectAll()
+        {
+            expectConnectionTracking();
+            waitConnected();
+            EXPECT_CALL(*this, connectAck())
+                .Times(1);
+            for (std::size_t i(0); i < POOL_SIZE; ++i)
+                savedConnectAcks[i]();
+        }
+
+        void dispatch(const Contents& contents)
+        {
+            pool->dispatchAsync(std::bind(&AsyncCommandDispatcherPoolTest::commandCb,
+                                          this,
+                                          std::placeholders::_1,
+                                          std::placeholders::_2),
+                                ns,
+                                contents);
+        }
+
+        MOCK_METHOD2(commandCb, void(const std::error_code&, const Reply&));
+
+        MOCK_METHOD0(connectAck, void());
+
+        MOCK_METHOD0(disconnectCb, void());
+    };
+
+    class AsyncCommandDispatcherPoolSizeTest: public testing::Test
+    {
+    public:
+        StrictMock<SystemMock> systemMock;
+
+        void expectGetenv(const char* value)
+        {
+            EXPECT_CALL(systemMock, getenv(StrEq(DB_CONNECTION_POOL_SIZE_ENV_VAR_NAME)))
+                .Times(1)
+                .WillOnce(Return(value));
+        }
+    };
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, IsNotCopyable)
+{
+    EXPECT_FALSE(std::is_copy_constructible<AsyncCommandDispatcherPool>::value);
+    EXPECT_FALSE(std::is_copy_assignable<AsyncCommandDispatcherPool>::value);
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, ImplementsAsyncCommandDispatcher)
+{
+    EXPECT_TRUE((std::is_base_of<AsyncCommandDispatcher, AsyncCommandDispatcherPool>::value));
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, ConnectAckIsCalledWhenAllDispatchersAreConnected)
+{
+    expectConnectionTracking();
+    waitConnected();
+    savedConnectAcks[0]();
+    savedConnectAcks[2]();
+    EXPECT_CALL(*this, connectAck())
+        .Times(1);
+    savedConnectAcks[1]();
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, ConnectAckIsCalledByFirstDispatcherWhenAllDispatchersAreAlreadyConnected)
+{
+    connectAll();
+    expectWaitConnectedAsync(0);
+    waitConnected();
+    EXPECT_CALL(*this, connectAck())
+        .Times(1);
+    savedConnectAcks[0]();
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, DisconnectCbIsCalledWhenAnyDispatcherIsDisconnected)
+{
+    expectConnectionTracking();
+    pool->registerDisconnectCb(std::bind(&AsyncCommandDispatcherPoolTest::disconnectCb, this));
+    expectWaitConnectedAsync(1);
+    EXPECT_CALL(*this, disconnectCb())
+        .Times(1);
+    savedDisconnectCbs[1]();
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, DisconnectedDispatcherIsNotSelectedUntilReconnected)
+{
+    connectAll();
+    InSequence dummy;
+    expectWaitConnectedAsync(0);
+    savedDisconnectCbs[0]();
+    expectDispatchAsync(1, get({ "key1" }));
+    expectDispatchAsync(2, get({ "key2" }));
+    expectDispatchAsync(1, get({ "key3" }));
+    dispatch(get({ "key1" }));
+    dispatch(get({ "key2" }));
+    dispatch(get({ "key3" }));
+    savedConnectAcks[0]();
+    expectDispatchAsync(0, get({ "key4" }));
+    dispatch(get({ "key4" }));
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, AnyDispatcherIsSelectedWhenAllDispatchersAreDisconnected)
+{
+    connectAll();
+    InSequence dummy;
+    for (std::size_t i(0); i < POOL_SIZE; ++i)
+    {
+        expectWaitConnectedAsync(i);
+        savedDisconnectCbs[i]();
+    }
+    expectDispatchAsync(0, get({ "key1" }));
+    expectDispatchAsync(1, get({ "key2" }));
+    dispatch(get({ "key1" }));
+    dispatch(get({ "key2" }));
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, DisableCommandCallbacksIsForwardedToAllDispatchers)
+{
+    for (std::size_t i(0); i < POOL_SIZE; ++i)
+        EXPECT_CALL(*dispatcherMocks[i], disableCommandCallbacks())
+            .Times(1);
+    pool->disableCommandCallbacks();
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, CorkAndUncorkAreForwardedToAllDispatchers)
+{
+    for (std::size_t i(0); i < POOL_SIZE; ++i)
+        EXPECT_CALL(*dispatcherMocks[i], cork())
+            .Times(1);
+    pool->cork();
+    for (std::size_t i(0); i < POOL_SIZE; ++i)
+        EXPECT_CALL(*dispatcherMocks[i], uncork())
+            .Times(1);
+    pool->uncork();
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, CommandsAreSpreadToDispatchersWithFewestOutstandingCommands)
+{
+    InSequence dummy;
+    expectDispatchAsync(0, get({ "key1" }));
+    expectDispatchAsync(1, get({ "key2" }));
+    expectDispatchAsync(2, get({ "key3" }));
+    dispatch(get({ "key1" }));
+    dispatch(get({ "key2" }));
+    dispatch(get({ "key3" }));
+    EXPECT_CALL(*this, commandCb(std::error_code(), Ref(replyMock)))
+        .Times(1);
+    savedCommandCbs[1](std::error_code(), replyMock);
+    expectDispatchAsync(1, get({ "key4" }));
+    dispatch(get({ "key4" }));
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, ErrorIsForwardedToCommandCb)
+{
+    InSequence dummy;
+    expectDispatchAsync(0, get({ "key1" }));
+    dispatch(get({ "key1" }));
+    EXPECT_CALL(*this, commandCb(getWellKnownErrorCode(), Ref(replyMock)))
+        .Times(1);
+    savedCommandCbs[0](getWellKnownErrorCode(), replyMock);
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, CommandsOnSameKeyAreSentToSameDispatcherWhileOutstanding)
+{
+    InSequence dummy;
+    expectDispatchAsync(0, get({ "key1" }));
+    expectDispatchAsync(0, get({ "key1" }));
+    dispatch(get({ "key1" }));
+    dispatch(get({ "key1" }));
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, KeyIsReleasedWhenItsCommandsHaveCompleted)
+{
+    InSequence dummy;
+    expectDispatchAsync(0, get({ "key1" }));
+    dispatch(get({ "key1" }));
+    EXPECT_CALL(*this, commandCb(_, _))
+        .Times(1);
+    savedCommandCbs[0](std::error_code(), replyMock);
+    expectDispatchAsync(1, get({ "key1" }));
+    dispatch(get({ "key1" }));
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, CommandWithKeysInSeveralDispatchersIsDeferredUntilKeysAreInOneDispatcher)
+{
+    InSequence dummy;
+    const AsyncConnection::DataMap dataMap({ { "key1", { 1, 2, 3 } }, { "key2", { 4, 5, 6 } } });
+    expectDispatchAsync(0, get({ "key1" }));
+    expectDispatchAsync(1, get({ "key2" }));
+    dispatch(get({ "key1" }));
+    dispatch(get({ "key2" }));
+    std::unique_ptr<AsyncConnection::DataMap> callerDataMap(new AsyncConnection::DataMap(dataMap));
+    dispatch(contentsBuilder.build("MSET", ns, *callerDataMap));
+    /* Deferred contents must not refer to the data given by the caller. */
+    callerDataMap.reset();
+    EXPECT_CALL(*this, commandCb(_, _))
+        .Times(1);
+    expectDispatchAsync(1, contentsBuilder.build("MSET", ns, dataMap));
+    savedCommandCbs[0](std::error_code(), replyMock);
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, CommandIsNotSentBeforeEarlierDeferredCommandWithCommonKey)
+{
+    InSequence dummy;
+    expectDispatchAsync(0, get({ "key1" }));
+    expectDispatchAsync(1, get({ "key2" }));
+    dispatch(get({ "key1" }));
+    dispatch(get({ "key2" }));
+    dispatch(get({ "key1", "key2" }));
+    dispatch(get({ "key2" }));
+    EXPECT_CALL(*this, commandCb(_, _))
+        .Times(1);
+    expectDispatchAsync(0, get({ "key1", "key2" }));
+    expectDispatchAsync(0, get({ "key2" }));
+    savedCommandCbs[1](std::error_code(), replyMock);
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, CommandsWithoutKeysCanBeSentToAnyDispatcher)
+{
+    InSequence dummy;
+    expectDispatchAsync(0, contentsBuilder.build("PING"));
+    expectDispatchAsync(1, contentsBuilder.build("PING"));
+    dispatch(contentsBuilder.build("PING"));
+    dispatch(contentsBuilder.build("PING"));
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, KeyPatternIsNotTakenAsKey)
+{
+    InSequence dummy;
+    const auto scan(contentsBuilder.build("SCAN", "0", "MATCH", "{tag1},key1", "COUNT", "100"));
+    expectDispatchAsync(0, get({ "key1" }));
+    expectDispatchAsync(1, scan);
+    dispatch(get({ "key1" }));
+    dispatch(scan);
+}
+
+TEST_F(AsyncCommandDispatcherPoolTest, DataWhichLooksLikeKeyIsNotTakenAsKey)
+{
+    InSequence dummy;
+    const auto set(contentsBuilder.build("SET", ns, "key2", { '{', 't', 'a', 'g', '1', '}', ',', 'k', 'e', 'y', '1' }));
+    expectDispatchAsync(0, get({ "key1" }));
+    expectDispatchAsync(1, set);
+    dispatch(get({ "key1" }));
+    dispatch(set);
+}
+
+TEST_F(AsyncCommandDispatcherPoolSizeTest, SizeIsOneByDefault)
+{
+    expectGetenv(nullptr);
+    EXPECT_EQ(1U, AsyncCommandDispatcherPool::getSize(systemMock));
+}
+
+TEST_F(AsyncCommandDispatcherPoolSizeTest, SizeCanBeSetWithEnvironmentVariable)
+{
+    expectGetenv("4");
+    EXPECT_EQ(4U, AsyncCommandDispatcherPool::getSize(systemMock));
+}
+
+TEST_F(AsyncCommandDispatcherPoolSizeTest, InvalidSizeIsIgnored)
+{
+    expectGetenv("four");
+    EXPECT_EQ(1U, AsyncCommandDispatcherPool::getSize(systemMock));
+    expectGetenv("0");
+    EXPECT_EQ(1U, AsyncCommandDispatcherPool::getSize(systemMock));
+    expectGetenv("4x");
+    EXPECT_EQ(1U, AsyncCommandDispatcherPool::getSize(systemMock));
+}
+
+TEST_F(AsyncCommandDispatcherPoolSizeTest, SizeIsLimited)
+{
+    expectGetenv("100000");
+    EXPECT_EQ(AsyncCommandDispatcherPool::MAX_SIZE, AsyncCommandDispatcherPool::getSize(systemMock));
+}
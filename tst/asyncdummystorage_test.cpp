@@ -25,6 +25,7 @@
 #include <sys/eventfd.h>
 #include "private/asyncdummystorage.hpp"
 #include "private/tst/enginemock.hpp"
+#include "private/tst/moveargaction.hpp"
 
 using namespace shareddatalayer;
 using namespace shareddatalayer::tst;
@@ -57,6 +58,14 @@ namespace
 
         MOCK_METHOD2(ack4, void(const std::error_code&, const AsyncStorage::Keys&));
 
+        MOCK_METHOD2(ack5, void(const std::error_code&, const AsyncStorage::DataViews&));
+
+        MOCK_METHOD3(ack6, void(const std::error_code&, const AsyncStorage::Keys&, bool));
+
+        MOCK_METHOD2(ack7, void(const std::error_code&, const AsyncStorage::NamespaceDataMaps&));
+
+        MOCK_METHOD2(ack8, void(const std::error_code&, const std::vector<bool>&));
+
         void expectAck1()
         {
             EXPECT_CALL(*this, ack1(std::error_code()))
@@ -81,11 +90,29 @@ namespace
                 .Times(1);
         }
 
+        void expectAck5()
+        {
+            EXPECT_CALL(*this, ack5(std::error_code(), IsEmpty()))
+                .Times(1);
+        }
+
+        void expectAck6()
+        {
+            EXPECT_CALL(*this, ack6(std::error_code(), IsEmpty(), false))
+                .Times(1);
+        }
+
+        void expectAck7()
+        {
+            EXPECT_CALL(*this, ack7(std::error_code(), IsEmpty()))
+                .Times(1);
+        }
+
         void expectPostCallback()
         {
             EXPECT_CALL(*engineMock, postCallback(_))
                 .Times(1)
-                .WillOnce(SaveArg<0>(&storedCallback));
+                .WillOnce(SaveMovedArg<0>(&storedCallback));
         }
     };
 }
@@ -160,6 +187,22 @@ TEST_F(AsyncDummyStorageTest, AcksAreImmediatelyScheduled)
     expectAck3();
     storedCallback();
 
+    expectPostCallback();
+    dummyStorage->getViewsAsync(ns, { }, std::bind(&AsyncDummyStorageTest::ack5,
+                                                   this,
+                                                   std::placeholders::_1,
+                                                   std::placeholders::_2));
+    expectAck5();
+    storedCallback();
+
+    expectPostCallback();
+    dummyStorage->getViewsAsync(ns, { }, [](const AsyncStorage::Key&, const AsyncStorage::DataView&) { },
+                                std::bind(&AsyncDummyStorageTest::ack1,
+                                          this,
+                                          std::placeholders::_1));
+    expectAck1();
+    storedCallback();
+
     expectPostCallback();
     dummyStorage->removeAsync(ns, { }, std::bind(&AsyncDummyStorageTest::ack1,
                                                  this,
@@ -185,10 +228,78 @@ TEST_F(AsyncDummyStorageTest, AcksAreImmediatelyScheduled)
     expectAck4();
     storedCallback();
 
+    expectPostCallback();
+    dummyStorage->scanKeysAsync(ns,
+                                "*",
+                                0,
+                                [this](const std::error_code& error,
+                                       const AsyncStorage::Keys& keys,
+                                       const AsyncStorage::ScanKeysNext& next)
+                                {
+                                    ack6(error, keys, static_cast<bool>(next));
+                                });
+    expectAck6();
+    storedCallback();
+
     expectPostCallback();
     dummyStorage->removeAllAsync(ns, std::bind(&AsyncDummyStorageTest::ack1,
                                                this,
                                                std::placeholders::_1));
     expectAck1();
     storedCallback();
+
+    expectPostCallback();
+    dummyStorage->removeByPrefixAsync(ns, "key", std::bind(&AsyncDummyStorageTest::ack1,
+                                                           this,
+                                                           std::placeholders::_1));
+    expectAck1();
+    storedCallback();
+
+    expectPostCallback();
+    dummyStorage->subscribeChannelAsync(ns,
+                                        { "channel" },
+                                        [](const AsyncStorage::Channel&, const AsyncStorage::Messages&) { },
+                                        std::bind(&AsyncDummyStorageTest::ack1,
+                                                  this,
+                                                  std::placeholders::_1));
+    expectAck1();
+    storedCallback();
+
+    expectPostCallback();
+    dummyStorage->unsubscribeChannelAsync(ns, { "channel" }, std::bind(&AsyncDummyStorageTest::ack1,
+                                                                       this,
+                                                                       std::placeholders::_1));
+    expectAck1();
+    storedCallback();
+
+    expectPostCallback();
+    dummyStorage->publishAsync(ns, "channel", "message", std::bind(&AsyncDummyStorageTest::ack1,
+                                                                   this,
+                                                                   std::placeholders::_1));
+    expectAck1();
+    storedCallback();
+
+    expectPostCallback();
+    dummyStorage->getBatchAsync({ { ns, { "key" } } }, std::bind(&AsyncDummyStorageTest::ack7,
+                                                                 this,
+                                                                 std::placeholders::_1,
+                                                                 std::placeholders::_2));
+    expectAck7();
+    storedCallback();
+
+    expectPostCallback();
+    dummyStorage->setBatchAsync({ { ns, { } } }, std::bind(&AsyncDummyStorageTest::ack1,
+                                                            this,
+                                                            std::placeholders::_1));
+    expectAck1();
+    storedCallback();
+
+    expectPostCallback();
+    dummyStorage->writeBatchAsync(ns, WriteBatch().remove({ "key" }), std::bind(&AsyncDummyStorageTest::ack8,
+                                                                              this,
+                                                                              std::placeholders::_1,
+                                                                              std::placeholders::_2));
+    EXPECT_CALL(*this, ack8(std::error_code(), std::vector<bool>({ true })))
+        .Times(1);
+    storedCallback();
 }
@@ -40,6 +40,7 @@
 #include "private/tst/contentsbuildermock.hpp"
 #include "private/tst/enginemock.hpp"
 #include "private/tst/hiredisclusterepolladaptermock.hpp"
+#include "private/tst/moveargaction.hpp"
 #include "private/tst/redisreplybuilder.hpp"
 
 using namespace shareddatalayer;
@@ -221,7 +222,7 @@ namespace
         {
             EXPECT_EQ(Reply::Type::NIL, reply.getType());
             EXPECT_EQ(0, reply.getInteger());
-            EXPECT_TRUE(reply.getString()->str.empty());
+            EXPECT_TRUE(reply.getString()->len == 0);
             EXPECT_EQ(static_cast<ReplyStringLength>(0), reply.getString()->len);
             EXPECT_TRUE(reply.getArray()->empty());
         }
@@ -445,7 +446,7 @@ TEST_F(AsyncHiredisClusterCommandDispatcherDisconnectedTest, CannotDispatchComma
     Engine::Callback storedCallback;
     EXPECT_CALL(engineMock, postCallback(_))
         .Times(1)
-        .WillOnce(SaveArg<0>(&storedCallback));
+        .WillOnce(SaveMovedArg<0>(&storedCallback));
     dispatcher->dispatchAsync(std::bind(&AsyncHiredisClusterCommandDispatcherDisconnectedTest::ack,
                                         this,
                                         std::placeholders::_1,
@@ -540,7 +541,7 @@ TEST_F(AsyncHiredisClusterCommandDispatcherConnectedTest, ConnectAckCalledIfConn
     Engine::Callback storedCallback;
     EXPECT_CALL(engineMock, postCallback(_))
         .Times(1)
-        .WillOnce(SaveArg<0>(&storedCallback));
+        .WillOnce(SaveMovedArg<0>(&storedCallback));
     dispatcher->waitConnectedAsync(std::bind(&AsyncHiredisClusterCommandDispatcherDisconnectedTest::connectAck,
                                              this));
     expectConnectAck();
@@ -562,11 +563,11 @@ TEST_F(AsyncHiredisClusterCommandDispatcherConnectedTest, CanDispatchCommands)
                              EXPECT_EQ(contents.sizes[2], argvlen[2]);
                              EXPECT_EQ(contents.sizes[3], argvlen[3]);
                              EXPECT_EQ(contents.sizes[4], argvlen[4]);
-                             EXPECT_FALSE(std::memcmp(argv[0], contents.stack[0].c_str(), contents.sizes[0]));
-                             EXPECT_FALSE(std::memcmp(argv[1], contents.stack[1].c_str(), contents.sizes[1]));
-                             EXPECT_FALSE(std::memcmp(argv[2], contents.stack[2].c_str(), contents.sizes[2]));
-                             EXPECT_FALSE(std::memcmp(argv[3], contents.stack[3].c_str(), contents.sizes[3]));
-                             EXPECT_FALSE(std::memcmp(argv[4], contents.stack[4].c_str(), contents.sizes[4]));
+                             EXPECT_FALSE(std::memcmp(argv[0], contents.stack[0], contents.sizes[0]));
+                             EXPECT_FALSE(std::memcmp(argv[1], contents.stack[1], contents.sizes[1]));
+                             EXPECT_FALSE(std::memcmp(argv[2], contents.stack[2], contents.sizes[2]));
+                             EXPECT_FALSE(std::memcmp(argv[3], contents.stack[3], contents.sizes[3]));
+                             EXPECT_FALSE(std::memcmp(argv[4], contents.stack[4], contents.sizes[4]));
                              cb(acc, &redisReplyBuilder.buildNilReply(), pd);
                              return REDIS_OK;
                          }));
@@ -588,7 +589,7 @@ TEST_F(AsyncHiredisClusterCommandDispatcherConnectedTest, CanParseNilReply)
                          {
                              EXPECT_EQ(Reply::Type::NIL, reply.getType());
                              EXPECT_EQ(0, reply.getInteger());
-                             EXPECT_TRUE(reply.getString()->str.empty());
+                             EXPECT_TRUE(reply.getString()->len == 0);
                              EXPECT_EQ(static_cast<ReplyStringLength>(0), reply.getString()->len);
                              EXPECT_TRUE(reply.getArray()->empty());
                          }));
@@ -629,7 +630,7 @@ TEST_F(AsyncHiredisClusterCommandDispatcherConnectedTest, CanParseStatusReply)
                              auto expected(redisReplyBuilder.buildStatusReply());
                              EXPECT_EQ(Reply::Type::STATUS, reply.getType());
                              EXPECT_EQ(expected.len, reply.getString()->len);
-                             EXPECT_FALSE(std::memcmp(reply.getString()->str.c_str(), expected.str, expected.len));
+                             EXPECT_FALSE(std::memcmp(reply.getString()->str, expected.str, expected.len));
                          }));
     dispatcher->dispatchAsync(std::bind(&AsyncHiredisClusterCommandDispatcherConnectedTest::ack,
                                         this,
@@ -649,7 +650,7 @@ TEST_F(AsyncHiredisClusterCommandDispatcherConnectedTest, CanParseStringReply)
                              auto expected(redisReplyBuilder.buildStringReply());
                              EXPECT_EQ(Reply::Type::STRING, reply.getType());
                              EXPECT_EQ(expected.len, reply.getString()->len);
-                             EXPECT_FALSE(std::memcmp(reply.getString()->str.c_str(), expected.str, expected.len));
+                             EXPECT_FALSE(std::memcmp(reply.getString()->str, expected.str, expected.len));
                          }));
     dispatcher->dispatchAsync(std::bind(&AsyncHiredisClusterCommandDispatcherConnectedTest::ack,
                                         this,
@@ -692,7 +693,7 @@ TEST_F(AsyncHiredisClusterCommandDispatcherConnectedTest, CanHandleDispatchHired
     Engine::Callback storedCallback;
     EXPECT_CALL(engineMock, postCallback(_))
         .Times(1)
-        .WillOnce(SaveArg<0>(&storedCallback));
+        .WillOnce(SaveMovedArg<0>(&storedCallback));
     dispatcher->dispatchAsync(std::bind(&AsyncHiredisClusterCommandDispatcherConnectedTest::ack,
                                         this,
                                         std::placeholders::_1,
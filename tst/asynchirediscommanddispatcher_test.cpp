@@ -39,6 +39,7 @@
 #include "private/tst/enginemock.hpp"
 #include "private/tst/hiredissystemmock.hpp"
 #include "private/tst/hiredisepolladaptermock.hpp"
+#include "private/tst/moveargaction.hpp"
 #include "private/tst/redisreplybuilder.hpp"
 
 using namespace shareddatalayer;
@@ -222,7 +223,7 @@ namespace
         {
             EXPECT_EQ(Reply::Type::NIL, reply.getType());
             EXPECT_EQ(0, reply.getInteger());
-            EXPECT_TRUE(reply.getString()->str.empty());
+            EXPECT_TRUE(reply.getString()->len == 0);
             EXPECT_EQ(static_cast<ReplyStringLength>(0), reply.getString()->len);
             EXPECT_TRUE(reply.getArray()->empty());
         }
@@ -449,7 +450,7 @@ TEST_F(AsyncHiredisCommandDispatcherDisconnectedTest, CannotDispatchCommandsIfDi
     Engine::Callback storedCallback;
     EXPECT_CALL(engineMock, postCallback(_))
         .Times(1)
-        .WillOnce(SaveArg<0>(&storedCallback));
+        .WillOnce(SaveMovedArg<0>(&storedCallback));
     dispatcher->dispatchAsync(std::bind(&AsyncHiredisCommandDispatcherDisconnectedTest::ack,
                                         this,
                                         std::placeholders::_1,
@@ -552,7 +553,7 @@ TEST_F(AsyncHiredisCommandDispatcherDisconnectedTest, ConnectAckCalledIfConnecte
     Engine::Callback storedCallback;
     EXPECT_CALL(engineMock, postCallback(_))
         .Times(1)
-        .WillOnce(SaveArg<0>(&storedCallback));
+        .WillOnce(SaveMovedArg<0>(&storedCallback));
     expectCommandListQuery();
     connected(&ac, 0);
     dispatcher->waitConnectedAsync(std::bind(&AsyncHiredisCommandDispatcherDisconnectedTest::connectAck, this));
@@ -574,11 +575,11 @@ TEST_F(AsyncHiredisCommandDispatcherConnectedTest, CanDispatchCommands)
                              EXPECT_EQ(contents.sizes[2], argvlen[2]);
                              EXPECT_EQ(contents.sizes[3], argvlen[3]);
                              EXPECT_EQ(contents.sizes[4], argvlen[4]);
-                             EXPECT_FALSE(std::memcmp(argv[0], contents.stack[0].c_str(), contents.sizes[0]));
-                             EXPECT_FALSE(std::memcmp(argv[1], contents.stack[1].c_str(), contents.sizes[1]));
-                             EXPECT_FALSE(std::memcmp(argv[2], contents.stack[2].c_str(), contents.sizes[2]));
-                             EXPECT_FALSE(std::memcmp(argv[3], contents.stack[3].c_str(), contents.sizes[3]));
-                             EXPECT_FALSE(std::memcmp(argv[4], contents.stack[4].c_str(), contents.sizes[4]));
+                             EXPECT_FALSE(std::memcmp(argv[0], contents.stack[0], contents.sizes[0]));
+                             EXPECT_FALSE(std::memcmp(argv[1], contents.stack[1], contents.sizes[1]));
+                             EXPECT_FALSE(std::memcmp(argv[2], contents.stack[2], contents.sizes[2]));
+                             EXPECT_FALSE(std::memcmp(argv[3], contents.stack[3], contents.sizes[3]));
+                             EXPECT_FALSE(std::memcmp(argv[4], contents.stack[4], contents.sizes[4]));
                              cb(ac, &redisReplyBuilder.buildNilReply(), pd);
                              return REDIS_OK;
                          }));
@@ -600,7 +601,7 @@ TEST_F(AsyncHiredisCommandDispatcherConnectedTest, CanParseNilReply)
                          {
                              EXPECT_EQ(Reply::Type::NIL, reply.getType());
                              EXPECT_EQ(0, reply.getInteger());
-                             EXPECT_TRUE(reply.getString()->str.empty());
+                             EXPECT_TRUE(reply.getString()->len == 0);
                              EXPECT_EQ(static_cast<ReplyStringLength>(0), reply.getString()->len);
                              EXPECT_TRUE(reply.getArray()->empty());
                          }));
@@ -641,7 +642,7 @@ TEST_F(AsyncHiredisCommandDispatcherConnectedTest, CanParseStatusReply)
                              auto expected(redisReplyBuilder.buildStatusReply());
                              EXPECT_EQ(Reply::Type::STATUS, reply.getType());
                              EXPECT_EQ(expected.len, reply.getString()->len);
-                             EXPECT_FALSE(std::memcmp(reply.getString()->str.c_str(), expected.str, expected.len));
+                             EXPECT_FALSE(std::memcmp(reply.getString()->str, expected.str, expected.len));
                          }));
     dispatcher->dispatchAsync(std::bind(&AsyncHiredisCommandDispatcherConnectedTest::ack,
                                         this,
@@ -661,7 +662,7 @@ TEST_F(AsyncHiredisCommandDispatcherConnectedTest, CanParseStringReply)
                              auto expected(redisReplyBuilder.buildStringReply());
                              EXPECT_EQ(Reply::Type::STRING, reply.getType());
                              EXPECT_EQ(expected.len, reply.getString()->len);
-                             EXPECT_FALSE(std::memcmp(reply.getString()->str.c_str(), expected.str, expected.len));
+                             EXPECT_FALSE(std::memcmp(reply.getString()->str, expected.str, expected.len));
                          }));
     dispatcher->dispatchAsync(std::bind(&AsyncHiredisCommandDispatcherConnectedTest::ack,
                                         this,
@@ -691,6 +692,43 @@ TEST_F(AsyncHiredisCommandDispatcherConnectedTest, CanParseArrayReply)
                                         contents);
 }
 
+TEST_F(AsyncHiredisCommandDispatcherConnectedTest, StringReplyIsNotCopied)
+{
+    auto& rr(redisReplyBuilder.buildStringReply());
+    expectRedisAsyncCommandArgv(rr);
+    EXPECT_CALL(*this, ack(std::error_code(), _))
+        .Times(1)
+        .WillOnce(Invoke([&rr](const std::error_code&, const Reply& reply)
+                         {
+                             EXPECT_EQ(rr.str, reply.getString()->str);
+                         }));
+    dispatcher->dispatchAsync(std::bind(&AsyncHiredisCommandDispatcherConnectedTest::ack,
+                                        this,
+                                        std::placeholders::_1,
+                                        std::placeholders::_2),
+                                        defaultNamespace,
+                                        contents);
+}
+
+TEST_F(AsyncHiredisCommandDispatcherConnectedTest, ArrayElementsAreCreatedOnlyOnce)
+{
+    expectRedisAsyncCommandArgv(redisReplyBuilder.buildArrayReply());
+    EXPECT_CALL(*this, ack(std::error_code(), _))
+        .Times(1)
+        .WillOnce(Invoke([](const std::error_code&, const Reply& reply)
+                         {
+                             EXPECT_EQ(reply.getArray(), reply.getArray());
+                             EXPECT_EQ((*reply.getArray())[0], (*reply.getArray())[0]);
+                             EXPECT_EQ(size_t(2), reply.getArray()->size());
+                         }));
+    dispatcher->dispatchAsync(std::bind(&AsyncHiredisCommandDispatcherConnectedTest::ack,
+                                        this,
+                                        std::placeholders::_1,
+                                        std::placeholders::_2),
+                                        defaultNamespace,
+                                        contents);
+}
+
 TEST_F(AsyncHiredisCommandDispatcherConnectedTest, CanHandleDispatchHiredisBufferErrors)
 {
     EXPECT_CALL(hiredisSystemMock, redisAsyncCommandArgv(&ac, _, _, _, _, _))
@@ -703,7 +741,7 @@ TEST_F(AsyncHiredisCommandDispatcherConnectedTest, CanHandleDispatchHiredisBuffe
     Engine::Callback storedCallback;
     EXPECT_CALL(engineMock, postCallback(_))
         .Times(1)
-        .WillOnce(SaveArg<0>(&storedCallback));
+        .WillOnce(SaveMovedArg<0>(&storedCallback));
     dispatcher->dispatchAsync(std::bind(&AsyncHiredisCommandDispatcherConnectedTest::ack,
                                         this,
                                         std::placeholders::_1,
@@ -745,6 +783,19 @@ TEST_F(AsyncHiredisCommandDispatcherConnectedTest, DatasetStillBeingLoadedInMemo
                                         contents);
 }
 
+TEST_F(AsyncHiredisCommandDispatcherConnectedTest, ScriptMissingFromScriptCacheIsRecognizedFromReply)
+{
+    expectReplyError("NOSCRIPT No matching script. Please use EVAL.");
+    EXPECT_CALL(*this, ack(std::error_code(AsyncRedisCommandDispatcherErrorCode::NO_SCRIPT), _))
+        .Times(1);
+    dispatcher->dispatchAsync(std::bind(&AsyncHiredisCommandDispatcherConnectedTest::ack,
+                                        this,
+                                        std::placeholders::_1,
+                                        std::placeholders::_2),
+                                        defaultNamespace,
+                                        contents);
+}
+
 TEST_F(AsyncHiredisCommandDispatcherConnectedTest, ProtocolErrorIsRecognizedFromReply)
 {
     expectReplyError("ERR Protocol error: invalid bulk length");
@@ -30,6 +30,7 @@
 #include "private/redis/asynchiredisdatabasediscovery.hpp"
 #include "private/redis/databaseinfo.hpp"
 #include "private/tst/enginemock.hpp"
+#include "private/tst/moveargaction.hpp"
 
 using namespace shareddatalayer;
 using namespace shareddatalayer::redis;
@@ -95,7 +96,7 @@ namespace
         {
             EXPECT_CALL(*engineMock, postCallback(_))
                 .Times(1)
-                .WillOnce(SaveArg<0>(&postedCallback));
+                .WillOnce(SaveMovedArg<0>(&postedCallback));
         }
 
         void callPostedCallback()
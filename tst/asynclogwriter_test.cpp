@@ -0,0 +1,178 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <syslog.h>
+#include <utility>
+#include <vector>
+#include "private/asynclogwriter.hpp"
+
+using namespace shareddatalayer;
+using namespace testing;
+
+namespace
+{
+    class AsyncLogWriterTest: public testing::Test
+    {
+    public:
+        std::mutex mutex;
+        std::vector<std::pair<int, std::string>> lines;
+        std::unique_ptr<AsyncLogWriter> writer;
+        std::chrono::steady_clock::time_point now;
+
+        AsyncLogWriterTest():
+            now(std::chrono::steady_clock::now())
+        {
+            createWriter(AsyncLogWriter::DEFAULT_CAPACITY);
+        }
+
+        ~AsyncLogWriterTest()
+        {
+            writer.reset();
+        }
+
+        void createWriter(std::size_t capacity)
+        {
+            writer.reset(new AsyncLogWriter("writer", [this](int level, const char* text, std::size_t length)
+                                            {
+                                                std::lock_guard<std::mutex> lock(mutex);
+                                                lines.emplace_back(level, std::string(text, length));
+                                            },
+                                            capacity));
+        }
+
+        bool write(int level, const std::string& message)
+        {
+            return writer->write(level, "prefix", message.data(), message.size());
+        }
+
+        std::vector<std::pair<int, std::string>> getLines()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return lines;
+        }
+    };
+}
+
+TEST_F(AsyncLogWriterTest, MessagesArePassedToOutputWithPrefixWhenFlushed)
+{
+    EXPECT_TRUE(write(LOG_ERR, "first\n"));
+    EXPECT_TRUE(write(LOG_DEBUG, "second\n"));
+    EXPECT_TRUE(getLines().empty());
+    writer->flush(now);
+    EXPECT_EQ((std::vector<std::pair<int, std::string>> { { LOG_ERR, "prefix: first\n" }, { LOG_DEBUG, "prefix: second\n" } }),
+              getLines());
+}
+
+TEST_F(AsyncLogWriterTest, CriticalMessagesArePassedSynchronously)
+{
+    write(LOG_CRIT, "critical\n");
+    EXPECT_EQ((std::vector<std::pair<int, std::string>> { { LOG_CRIT, "prefix: critical\n" } }), getLines());
+}
+
+TEST_F(AsyncLogWriterTest, CriticalMessageIsPassedAfterQueuedMessages)
+{
+    write(LOG_ERR, "queued\n");
+    write(LOG_CRIT, "critical\n");
+    EXPECT_EQ((std::vector<std::pair<int, std::string>> { { LOG_ERR, "prefix: queued\n" }, { LOG_CRIT, "prefix: critical\n" } }),
+              getLines());
+}
+
+TEST_F(AsyncLogWriterTest, LongMessageIsTruncatedWithMarkerKeepingNewline)
+{
+    write(LOG_ERR, std::string(AsyncLogWriter::MAX_MESSAGE_LENGTH, 'x') + "\n");
+    writer->flush(now);
+    ASSERT_EQ(1U, getLines().size());
+    const auto line(getLines().front().second);
+    EXPECT_EQ(AsyncLogWriter::MAX_MESSAGE_LENGTH, line.size());
+    EXPECT_EQ("prefix: xxx", line.substr(0, 11));
+    EXPECT_EQ("xxx... [truncated]\n", line.substr(line.size() - 19));
+}
+
+TEST_F(AsyncLogWriterTest, MessageWhichFitsIsNotTruncated)
+{
+    const std::string message(std::string(AsyncLogWriter::MAX_MESSAGE_LENGTH - 9, 'x') + "\n");
+    write(LOG_CRIT, message);
+    ASSERT_EQ(1U, getLines().size());
+    EXPECT_EQ("prefix: " + message, getLines().front().second);
+}
+
+TEST_F(AsyncLogWriterTest, MessagesAreDroppedAndCountedWhenRingIsFull)
+{
+    createWriter(2);
+    EXPECT_TRUE(write(LOG_ERR, "a\n"));
+    EXPECT_TRUE(write(LOG_ERR, "b\n"));
+    EXPECT_FALSE(write(LOG_ERR, "c\n"));
+    EXPECT_FALSE(write(LOG_ERR, "d\n"));
+    EXPECT_EQ(2U, writer->getDroppedCount());
+    writer->flush(now);
+    EXPECT_EQ((std::vector<std::pair<int, std::string>> { { LOG_ERR, "prefix: a\n" },
+                                                          { LOG_ERR, "prefix: b\n" },
+                                                          { LOG_WARNING, "writer: 2 log message(s) dropped, log buffer full\n" } }),
+              getLines());
+    EXPECT_TRUE(write(LOG_ERR, "e\n"));
+}
+
+TEST_F(AsyncLogWriterTest, MessagesOfOneSiteAreRateLimited)
+{
+    for (unsigned int i(0); i < AsyncLogWriter::RATE_LIMIT_BURST + 2; ++i)
+        write(LOG_ERR, "request " + std::to_string(i) + " failed\n");
+    writer->flush(now);
+    const auto burst(getLines());
+    ASSERT_EQ(AsyncLogWriter::RATE_LIMIT_BURST, burst.size());
+    EXPECT_EQ("prefix: request 0 failed\n", burst.front().second);
+    EXPECT_EQ(2U, writer->getSuppressedCount());
+    writer->flush(now + AsyncLogWriter::RATE_LIMIT_INTERVAL + std::chrono::seconds(1));
+    const auto afterInterval(getLines());
+    ASSERT_EQ(AsyncLogWriter::RATE_LIMIT_BURST + 1, afterInterval.size());
+    EXPECT_EQ(std::make_pair(LOG_ERR, std::string("prefix: 2 similar message(s) suppressed, last: request 11 failed\n")),
+              afterInterval.back());
+}
+
+TEST_F(AsyncLogWriterTest, SitesAreRateLimitedSeparately)
+{
+    for (unsigned int i(0); i < AsyncLogWriter::RATE_LIMIT_BURST; ++i)
+        write(LOG_ERR, "request failed\n");
+    write(LOG_WARNING, "request failed\n");
+    write(LOG_ERR, "connection lost\n");
+    writer->flush(now);
+    EXPECT_EQ(AsyncLogWriter::RATE_LIMIT_BURST + 2, getLines().size());
+    EXPECT_EQ(0U, writer->getSuppressedCount());
+}
+
+TEST_F(AsyncLogWriterTest, StartedWriterFlushesInBackground)
+{
+    ASSERT_TRUE(writer->start());
+    write(LOG_ERR, "message\n");
+    writer->waitFlushed(std::chrono::seconds(10));
+    EXPECT_EQ((std::vector<std::pair<int, std::string>> { { LOG_ERR, "prefix: message\n" } }), getLines());
+}
+
+TEST_F(AsyncLogWriterTest, StopFlushesRemainingMessagesAndSwitchesToSynchronousWriting)
+{
+    write(LOG_ERR, "queued\n");
+    writer->stop();
+    write(LOG_ERR, "synchronous\n");
+    EXPECT_EQ((std::vector<std::pair<int, std::string>> { { LOG_ERR, "prefix: queued\n" }, { LOG_ERR, "prefix: synchronous\n" } }),
+              getLines());
+}
@@ -38,8 +38,10 @@
 #include "private/tst/asyncdatabasediscoverymock.hpp"
 #include "private/tst/contentsbuildermock.hpp"
 #include "private/tst/enginemock.hpp"
+#include "private/tst/moveargaction.hpp"
 #include "private/tst/namespaceconfigurationsmock.hpp"
 #include "private/tst/replymock.hpp"
+#include "private/tst/systemmock.hpp"
 #include "private/tst/wellknownerrorcode.hpp"
 
 using namespace shareddatalayer;
@@ -74,6 +76,7 @@ namespace
         std::shared_ptr<StrictMock<EngineMock>> engineMock;
         std::shared_ptr<StrictMock<AsyncDatabaseDiscoveryMock>> discoveryMock;
         std::shared_ptr<StrictMock<AsyncCommandDispatcherMock>> dispatcherMock;
+        std::shared_ptr<StrictMock<AsyncCommandDispatcherMock>> subscriberMock;
         std::unique_ptr<AsyncRedisStorage> sdlStorage;
         AsyncStorage::Namespace ns;
         std::shared_ptr<StrictMock<ContentsBuilderMock>> contentsBuilderMock;
@@ -91,8 +94,13 @@ namespace
         AsyncCommandDispatcher::CommandCb savedCommandCb;
         AsyncCommandDispatcher::CommandCb savedPublishCommandCb;
         AsyncCommandDispatcher::CommandCb savedCommandListQueryCb;
+        AsyncCommandDispatcher::CommandCb savedNextPageCommandCb;
+        Timer::Callback savedTimerCallback;
         ReplyMock replyMock;
+        ReplyMock scanReplyMock;
+        ReplyMock scanCursorReplyMock;
         Reply::ReplyVector replyVector;
+        Reply::ReplyVector scanReplyVector;
         Reply::ReplyVector commandListReplyVector;
         Reply::ReplyVector commandListReplyElementVector;
         std::string expectedStr1;
@@ -106,16 +114,18 @@ namespace
         AsyncStorage::DataMap dataMap;
         std::string keyPrefix;
         std::shared_ptr<Logger> logger;
+        std::size_t removeBatchSize;
 
         AsyncRedisStorageTestBase():
             engineMock(std::make_shared<StrictMock<EngineMock>>()),
             discoveryMock(std::make_shared<StrictMock<AsyncDatabaseDiscoveryMock>>()),
             dispatcherMock(std::make_shared<StrictMock<AsyncCommandDispatcherMock>>()),
+            subscriberMock(std::make_shared<StrictMock<AsyncCommandDispatcherMock>>()),
             ns("tag1"),
             contentsBuilderMock(std::make_shared<StrictMock<ContentsBuilderMock>>(AsyncStorage::SEPARATOR)),
             namespaceConfigurationsMock(std::make_shared<StrictMock<NamespaceConfigurationsMock>>()),
             contents({{"aaa","bbb"},{3,3}}),
-            publishContentsWithoutPubId({ { "PUBLISH", ns, "shareddatalayer::NO_PUBLISHER" }, { 7, 4, 29 } }),
+            publishContentsWithoutPubId({ { "PUBLISH", ns.c_str(), "shareddatalayer::NO_PUBLISHER" }, { 7, 4, 29 } }),
             fd(10),
             discoveryFd(20),
             dispatcherFd(30),
@@ -127,22 +137,36 @@ namespace
             data2({4,5,6}),
             dataMap({{key1,data1},{key2,data2}}),
             keyPrefix("{tag1},*"),
-            logger(createLogger(SDL_LOG_PREFIX))
+            logger(createLogger(SDL_LOG_PREFIX)),
+            removeBatchSize(AsyncRedisStorage::DEFAULT_REMOVE_BATCH_SIZE)
         {
+            scanReplyVector.push_back(&scanCursorReplyMock);
+            scanReplyVector.push_back(&replyMock);
+            EXPECT_CALL(*namespaceConfigurationsMock, getNearCacheSize(_)).WillRepeatedly(Return(0));
+            EXPECT_CALL(*namespaceConfigurationsMock, isNearCacheUsed()).WillRepeatedly(Return(false));
         }
 
         virtual ~AsyncRedisStorageTestBase() = default;
 
         std::shared_ptr<AsyncCommandDispatcher> asyncCommandDispatcherCreator(Engine&,
                                                                               const DatabaseInfo&,
-                                                                              std::shared_ptr<ContentsBuilder>)
+                                                                              std::shared_ptr<ContentsBuilder>,
+                                                                              std::shared_ptr<Logger>,
+                                                                              bool usePermanentCommandCallbacks)
         {
+            if (usePermanentCommandCallbacks)
+            {
+                newSubscriberCreated();
+                return subscriberMock;
+            }
             newDispatcherCreated();
             return dispatcherMock;
         }
 
         MOCK_METHOD0(newDispatcherCreated, void());
 
+        MOCK_METHOD0(newSubscriberCreated, void());
+
         MOCK_METHOD1(readyAck, void(const std::error_code&));
 
         MOCK_METHOD1(modifyAck, void(const std::error_code&));
@@ -151,8 +175,26 @@ namespace
 
         MOCK_METHOD2(getAck, void(const std::error_code&, const AsyncStorage::DataMap&));
 
+        MOCK_METHOD2(getBatchAck, void(const std::error_code&, const AsyncStorage::NamespaceDataMaps&));
+
         MOCK_METHOD2(findKeysAck, void(const std::error_code&, const AsyncStorage::Keys&));
 
+        MOCK_METHOD2(writeBatchAck, void(const std::error_code&, const std::vector<bool>&));
+
+        MOCK_METHOD3(scanKeysAck, void(const std::error_code&, const AsyncStorage::Keys&, bool hasNext));
+
+        AsyncStorage::ScanKeysAck scanKeysAckContinuingWhile(const bool& continueScan)
+        {
+            return [this, &continueScan](const std::error_code& error,
+                                         const AsyncStorage::Keys& keys,
+                                         const AsyncStorage::ScanKeysNext& next)
+                   {
+                       scanKeysAck(error, keys, static_cast<bool>(next));
+                       if (next && continueScan)
+                           next();
+                   };
+        }
+
         DatabaseInfo getDatabaseInfo(DatabaseInfo::Type type = DatabaseInfo::Type::SINGLE,
                                      DatabaseInfo::Discovery discovery = DatabaseInfo::Discovery::HIREDIS,
                                      std::string address = defaultAddress,
@@ -237,7 +279,7 @@ namespace
         {
             EXPECT_CALL(*engineMock, postCallback(_))
                 .Times(1)
-                .WillOnce(SaveArg<0>(&storedCallback));
+                .WillOnce(SaveMovedArg<0>(&storedCallback));
         }
 
         void createAsyncStorageInstance(const boost::optional<PublisherId>& pId)
@@ -253,9 +295,12 @@ namespace
                                                              this,
                                                              std::placeholders::_1,
                                                              std::placeholders::_2,
-                                                             std::placeholders::_3),
+                                                             std::placeholders::_3,
+                                                             std::placeholders::_4,
+                                                             std::placeholders::_5),
                                                    contentsBuilderMock,
-                                                   logger));
+                                                   logger,
+                                                   removeBatchSize));
         }
 
         void createAndConnectAsyncStorageInstance(const boost::optional<PublisherId>& pId)
@@ -277,6 +322,19 @@ namespace
                 .Times(1);
         }
 
+        void expectArmTimer(const Timer::Duration& duration)
+        {
+            EXPECT_CALL(*engineMock, armTimer(_, duration, _))
+                .Times(1)
+                .WillOnce(SaveArg<2>(&savedTimerCallback));
+        }
+
+        void expectDisarmTimer()
+        {
+            EXPECT_CALL(*engineMock, disarmTimer(_))
+                .Times(1);
+        }
+
         void expectNoDispatchAsync()
         {
             EXPECT_CALL(*dispatcherMock, dispatchAsync(_, ns, _))
@@ -287,19 +345,33 @@ namespace
         {
             EXPECT_CALL(*dispatcherMock, dispatchAsync(_, ns, contents))
                 .Times(1)
-                .WillOnce(SaveArg<0>(&savedCommandCb));
+                .WillOnce(SaveMovedArg<0>(&savedCommandCb));
+        }
+
+        void expectNextPageDispatchAsync()
+        {
+            EXPECT_CALL(*dispatcherMock, dispatchAsync(_, ns, contents))
+                .Times(1)
+                .WillOnce(SaveMovedArg<0>(&savedNextPageCommandCb));
+        }
+
+        void expectUnlinkContentsBuild(const AsyncStorage::Keys& keys)
+        {
+            EXPECT_CALL(*contentsBuilderMock, build("UNLINK", ns, keys))
+                .Times(1)
+                .WillOnce(Return(contents));
         }
 
         void expectPublishDispatch()
         {
             EXPECT_CALL(*dispatcherMock, dispatchAsync(_, ns, contents))
                 .Times(1)
-                .WillOnce(SaveArg<0>(&savedPublishCommandCb));
+                .WillOnce(SaveMovedArg<0>(&savedPublishCommandCb));
         }
 
-        std::shared_ptr<Reply> getMockPtr()
+        const Reply* getMockPtr()
         {
-            return std::shared_ptr<Reply>(&replyMock, [](Reply*){ });
+            return &replyMock;
         }
 
         void expectGetType(const Reply::Type& type)
@@ -324,6 +396,17 @@ namespace
                 .WillOnce(Return(&replyVector));
         }
 
+        void expectGetScanPage(const Reply::DataItem& cursor)
+        {
+            EXPECT_CALL(scanReplyMock, getArray())
+                .Times(1)
+                .WillOnce(Return(&scanReplyVector));
+            EXPECT_CALL(scanCursorReplyMock, getString())
+                .Times(1)
+                .WillOnce(Return(&cursor));
+            expectGetArray();
+        }
+
         void expectGetInteger(int value)
         {
             EXPECT_CALL(replyMock, getInteger())
@@ -404,13 +487,41 @@ namespace
                 .Times(1)
                 .WillOnce(Return(contents));
         }
+
+        void expectWriteBatchContentsBuild(const std::vector<AsyncStorage::Key>& keys,
+                                           const std::vector<std::string>& args)
+        {
+            EXPECT_CALL(*contentsBuilderMock, build(An<const Script&>(), ns, keys, args))
+                .Times(1)
+                .WillOnce(Return(contents));
+        }
+
+        void writeBatch(const WriteBatch& writeBatch)
+        {
+            sdlStorage->writeBatchAsync(ns,
+                                        writeBatch,
+                                        std::bind(&AsyncRedisStorageTestBase::writeBatchAck,
+                                                  this,
+                                                  std::placeholders::_1,
+                                                  std::placeholders::_2));
+        }
+
+        void expectScanContentsBuild(const std::string& cursor,
+                                     const std::string& pattern,
+                                     std::size_t count)
+        {
+            EXPECT_CALL(*contentsBuilderMock, build("SCAN", cursor, "MATCH", pattern, "COUNT", std::to_string(count)))
+                .Times(1)
+                .WillOnce(Return(contents));
+        }
     };
 
     class AsyncRedisStorageTest: public AsyncRedisStorageTestBase
     {
     public:
-        AsyncRedisStorageTest()
+        explicit AsyncRedisStorageTest(bool nearCacheUsed = false)
         {
+            EXPECT_CALL(*namespaceConfigurationsMock, isNearCacheUsed()).WillRepeatedly(Return(nearCacheUsed));
             InSequence dummy;
             for (auto i(0U); i < 3; ++i)
                 replyVector.push_back(getMockPtr());
@@ -448,6 +559,210 @@ namespace
     };
 
 
+    class AsyncRedisStorageSubscriberTest: public AsyncRedisStorageTest
+    {
+    public:
+        AsyncCommandDispatcher::ConnectAck subscriberConnectAck;
+        AsyncCommandDispatcher::DisconnectCb subscriberDisconnectCb;
+        AsyncCommandDispatcher::CommandCb savedSubscribeCommandCb;
+        NiceMock<ReplyMock> pubSubReplyMock;
+        NiceMock<ReplyMock> pubSubElementReplyMocks[3];
+        Reply::ReplyVector pubSubReplyVector;
+        std::string pubSubStrings[3];
+        Reply::DataItem pubSubDataItems[3];
+
+        explicit AsyncRedisStorageSubscriberTest(bool nearCacheUsed = false):
+            AsyncRedisStorageTest(nearCacheUsed)
+        {
+            ON_CALL(pubSubReplyMock, getType())
+                .WillByDefault(Return(Reply::Type::ARRAY));
+            ON_CALL(pubSubReplyMock, getArray())
+                .WillByDefault(Return(&pubSubReplyVector));
+            for (auto i(0U); i < 3; ++i)
+            {
+                pubSubReplyVector.push_back(&pubSubElementReplyMocks[i]);
+                ON_CALL(pubSubElementReplyMocks[i], getType())
+                    .WillByDefault(Return(Reply::Type::STRING));
+                ON_CALL(pubSubElementReplyMocks[i], getString())
+                    .WillByDefault(Return(&pubSubDataItems[i]));
+            }
+        }
+
+        ~AsyncRedisStorageSubscriberTest()
+        {
+            EXPECT_CALL(*subscriberMock, disableCommandCallbacks())
+                .Times(1);
+        }
+
+        MOCK_METHOD2(notificationCb, void(const AsyncStorage::Channel&, const AsyncStorage::Messages&));
+
+        AsyncStorage::NotificationCb getNotificationCb()
+        {
+            return std::bind(&AsyncRedisStorageSubscriberTest::notificationCb,
+                             this,
+                             std::placeholders::_1,
+                             std::placeholders::_2);
+        }
+
+        const Reply& pubSubReply(const std::string& kind, const std::string& channelName, const std::string& payload)
+        {
+            pubSubStrings[0] = kind;
+            pubSubStrings[1] = channelName;
+            pubSubStrings[2] = payload;
+            for (auto i(0U); i < 3; ++i)
+                pubSubDataItems[i] = Reply::DataItem { pubSubStrings[i].c_str(), ReplyStringLength(pubSubStrings[i].size()) };
+            return pubSubReplyMock;
+        }
+
+        void expectSubscriberCreation()
+        {
+            EXPECT_CALL(*this, newSubscriberCreated())
+                .Times(1);
+            EXPECT_CALL(*subscriberMock, registerDisconnectCb(_))
+                .Times(1)
+                .WillOnce(SaveArg<0>(&subscriberDisconnectCb));
+            expectSubscriberWaitConnectedAsync();
+        }
+
+        void expectSubscriberWaitConnectedAsync()
+        {
+            EXPECT_CALL(*subscriberMock, waitConnectedAsync(_))
+                .Times(1)
+                .WillOnce(SaveArg<0>(&subscriberConnectAck));
+        }
+
+        void expectSubscriberCommand(const std::string& command, const std::vector<std::string>& channelNames)
+        {
+            EXPECT_CALL(*contentsBuilderMock, build(command, channelNames))
+                .Times(1)
+                .WillOnce(Return(contents));
+            EXPECT_CALL(*subscriberMock, dispatchAsync(_, _, contents))
+                .Times(1)
+                .WillOnce(SaveMovedArg<0>(&savedSubscribeCommandCb));
+        }
+
+        void subscribe(const AsyncStorage::Channels& channels, const std::vector<std::string>& channelNames)
+        {
+            InSequence dummy;
+            expectSubscriberCreation();
+            sdlStorage->subscribeChannelAsync(ns,
+                                              channels,
+                                              getNotificationCb(),
+                                              std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+            expectSubscriberCommand("SUBSCRIBE", channelNames);
+            subscriberConnectAck();
+            for (const auto& name : channelNames)
+            {
+                if (name == channelNames.back())
+                    expectModifyAck(std::error_code());
+                savedSubscribeCommandCb(std::error_code(), pubSubReply("subscribe", name, ""));
+            }
+        }
+    };
+
+    class AsyncRedisStorageNearCacheTest: public AsyncRedisStorageSubscriberTest
+    {
+    public:
+        const Reply::DataItem dataItem1;
+        const Reply::DataItem dataItem2;
+
+        AsyncRedisStorageNearCacheTest():
+            AsyncRedisStorageSubscriberTest(true),
+            dataItem1({ reinterpret_cast<const char*>(data1.data()), ReplyStringLength(data1.size()) }),
+            dataItem2({ reinterpret_cast<const char*>(data2.data()), ReplyStringLength(data2.size()) })
+        {
+            EXPECT_CALL(*namespaceConfigurationsMock, getNearCacheSize(ns)).WillRepeatedly(Return(2));
+        }
+
+        void getAsync(const AsyncStorage::Keys& keys)
+        {
+            sdlStorage->getAsync(ns,
+                                 keys,
+                                 std::bind(&AsyncRedisStorageTest::getAck,
+                                           this,
+                                           std::placeholders::_1,
+                                           std::placeholders::_2));
+        }
+
+        void expectMgetDispatch(const AsyncStorage::Keys& keys)
+        {
+            expectContentsBuild("MGET", keys);
+            expectDispatchAsync();
+        }
+
+        void replyToMget()
+        {
+            expectGetArray();
+            expectGetDataString(dataItem1);
+            expectGetDataString(dataItem2);
+            expectGetAck(std::error_code(), dataMap);
+            savedCommandCb(std::error_code(), replyMock);
+        }
+
+        void createNearCache()
+        {
+            InSequence dummy;
+            expectSubscriberCreation();
+            expectMgetDispatch(keys);
+            getAsync(keys);
+            expectSubscriberCommand("SUBSCRIBE", { ns });
+            subscriberConnectAck();
+            savedSubscribeCommandCb(std::error_code(), pubSubReply("subscribe", ns, ""));
+        }
+
+        void fillNearCache()
+        {
+            createNearCache();
+            InSequence dummy;
+            replyToMget();
+            expectMgetDispatch(keys);
+            getAsync(keys);
+            replyToMget();
+        }
+
+        void expectGetFromNearCache(const AsyncStorage::Keys& keys, const AsyncStorage::DataMap& dataMap)
+        {
+            expectPostCallback();
+            getAsync(keys);
+            expectGetAck(std::error_code(), dataMap);
+            storedCallback();
+        }
+    };
+
+    class AsyncRedisStorageTestRemoveBatchSizeOne: public AsyncRedisStorageTestBase
+    {
+    public:
+        AsyncRedisStorageTestRemoveBatchSizeOne()
+        {
+            InSequence dummy;
+            removeBatchSize = 1;
+            for (auto i(0U); i < 3; ++i)
+                replyVector.push_back(getMockPtr());
+            createAndConnectAsyncStorageInstance(boost::none);
+            EXPECT_CALL(*namespaceConfigurationsMock, areNotificationsEnabled(_)).WillRepeatedly(Return(false));
+        }
+
+        ~AsyncRedisStorageTestRemoveBatchSizeOne()
+        {
+            expectClearStateChangedCb();
+            EXPECT_CALL(*dispatcherMock, disableCommandCallbacks())
+                .Times(1);
+        }
+    };
+
+    class AsyncRedisStorageRemoveBatchSizeTest: public testing::Test
+    {
+    public:
+        StrictMock<SystemMock> systemMock;
+
+        void expectGetenv(const char* value)
+        {
+            EXPECT_CALL(systemMock, getenv(StrEq(DB_REMOVE_BATCH_SIZE_ENV_VAR_NAME)))
+                .Times(1)
+                .WillOnce(Return(value));
+        }
+    };
+
     class AsyncRedisStorageTestDispatcherNotCreated: public AsyncRedisStorageTestBase
     {
     public:
@@ -494,6 +809,10 @@ TEST_F(AsyncRedisStorageErrorCodeTest, AllErrorCodeEnumsHaveCorrectDescriptionMe
                 ec = aec;
                 EXPECT_EQ("invalid namespace identifier passed to SDL API", getErrorCodeMessage(ec));
                 break;
+            case AsyncRedisStorage::ErrorCode::OPERATION_TIMEOUT:
+                ec = aec;
+                EXPECT_EQ("operation did not complete before the deadline", getErrorCodeMessage(ec));
+                break;
             case AsyncRedisStorage::ErrorCode::END_MARKER:
                 ec = aec;
                 EXPECT_EQ("unsupported error code for message()", getErrorCodeMessage(ec));
@@ -528,6 +847,10 @@ TEST_F(AsyncRedisStorageErrorCodeTest, AllErrorCodeEnumsAreMappedToCorrectSDLInt
                 ec = aec;
                 EXPECT_TRUE(ec == InternalError::SDL_RECEIVED_INVALID_PARAMETER);
                 break;
+            case AsyncRedisStorage::ErrorCode::OPERATION_TIMEOUT:
+                ec = aec;
+                EXPECT_TRUE(ec == InternalError::BACKEND_REPLY_TIMEOUT);
+                break;
             case AsyncRedisStorage::ErrorCode::END_MARKER:
                 ec = aec;
                 EXPECT_TRUE(ec == InternalError::SDL_ERROR_CODE_LOGIC_ERROR);
@@ -547,6 +870,8 @@ TEST_F(AsyncRedisStorageErrorCodeTest, AllErrorCodeEnumsAreMappedToCorrectClient
     EXPECT_TRUE(ec == shareddatalayer::Error::SUCCESS);
     ec = AsyncRedisStorage::ErrorCode::REDIS_NOT_YET_DISCOVERED;
     EXPECT_TRUE(ec == shareddatalayer::Error::NOT_CONNECTED);
+    ec = AsyncRedisStorage::ErrorCode::OPERATION_TIMEOUT;
+    EXPECT_TRUE(ec == shareddatalayer::Error::OPERATION_INTERRUPTED);
     ec = AsyncRedisStorage::ErrorCode::END_MARKER;
     EXPECT_TRUE(ec == shareddatalayer::Error::BACKEND_FAILURE);
 }
@@ -598,7 +923,9 @@ TEST_F(AsyncRedisStorageTest, PassingEmptyPublisherIdThrows)
                          this,
                          std::placeholders::_1,
                          std::placeholders::_2,
-                         std::placeholders::_3),
+                         std::placeholders::_3,
+                         std::placeholders::_4,
+                         std::placeholders::_5),
                      contentsBuilderMock,
                      logger)),
                  std::invalid_argument);
@@ -644,6 +971,55 @@ TEST_F(AsyncRedisStorageTest, SetAsyncSuccessfullyAndErrorIsForwarded)
     savedCommandCb(getWellKnownErrorCode(), replyMock);
 }
 
+TEST_F(AsyncRedisStorageTest, SetAsyncIsAckedWithTimeoutErrorWhenOperationTimeoutExpires)
+{
+    InSequence dummy;
+    sdlStorage->setOperationTimeout(std::chrono::seconds(2));
+    expectArmTimer(std::chrono::seconds(2));
+    expectContentsBuild("MSETPUB", dataMap, ns, shareddatalayer::NO_PUBLISHER);
+    expectDispatchAsync();
+    sdlStorage->setAsync(ns,
+                         dataMap,
+                         std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    expectModifyAck(std::error_code(AsyncRedisStorage::ErrorCode::OPERATION_TIMEOUT));
+    savedTimerCallback();
+    EXPECT_CALL(*this, modifyAck(_))
+        .Times(0);
+    savedCommandCb(std::error_code(), replyMock);
+}
+
+TEST_F(AsyncRedisStorageTest, SetAsyncReplyBeforeOperationTimeoutDisarmsTimer)
+{
+    InSequence dummy;
+    sdlStorage->setOperationTimeout(std::chrono::seconds(2));
+    expectArmTimer(std::chrono::seconds(2));
+    expectContentsBuild("MSETPUB", dataMap, ns, shareddatalayer::NO_PUBLISHER);
+    expectDispatchAsync();
+    sdlStorage->setAsync(ns,
+                         dataMap,
+                         std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    expectDisarmTimer();
+    expectModifyAck(std::error_code());
+    savedCommandCb(std::error_code(), replyMock);
+}
+
+TEST_F(AsyncRedisStorageTest, GetAsyncIsAckedWithEmptyDataMapWhenOperationTimeoutExpires)
+{
+    InSequence dummy;
+    sdlStorage->setOperationTimeout(std::chrono::milliseconds(500));
+    expectArmTimer(std::chrono::milliseconds(500));
+    expectContentsBuild("MGET", keysWithNonExistKey);
+    expectDispatchAsync();
+    sdlStorage->getAsync(ns,
+                         keysWithNonExistKey,
+                         std::bind(&AsyncRedisStorageTest::getAck,
+                                   this,
+                                   std::placeholders::_1,
+                                   std::placeholders::_2));
+    expectGetAck(std::error_code(AsyncRedisStorage::ErrorCode::OPERATION_TIMEOUT), { });
+    savedTimerCallback();
+}
+
 TEST_F(AsyncRedisStorageTestNotificationsDisabled, SetAsyncSuccessfullyAndErrorIsForwardedNoPublish)
 {
     InSequence dummy;
@@ -670,6 +1046,20 @@ TEST_F(AsyncRedisStorageTest, EmptyMapIsCheckedInSetAsyncAndAckIsScheduled)
     storedCallback();
 }
 
+TEST_F(AsyncRedisStorageTest, NearCacheSizeIsNotQueriedWhenNearCacheIsNotUsed)
+{
+    InSequence dummy;
+    EXPECT_CALL(*namespaceConfigurationsMock, getNearCacheSize(_)).Times(0);
+    expectContentsBuild("MGET", keys);
+    expectDispatchAsync();
+    sdlStorage->getAsync(ns,
+                         keys,
+                         std::bind(&AsyncRedisStorageTest::getAck,
+                                   this,
+                                   std::placeholders::_1,
+                                   std::placeholders::_2));
+}
+
 TEST_F(AsyncRedisStorageTest, GetAsyncSuccessfullyAndErrorIsForwarded)
 {
     InSequence dummy;
@@ -682,8 +1072,8 @@ TEST_F(AsyncRedisStorageTest, GetAsyncSuccessfullyAndErrorIsForwarded)
                                    std::placeholders::_1,
                                    std::placeholders::_2));
     expectGetArray();
-    auto expectedDataItem1(Reply::DataItem { std::string(data1.begin(),data1.end()), ReplyStringLength(data1.size()) });
-    auto expectedDataItem2(Reply::DataItem { std::string(data2.begin(),data2.end()), ReplyStringLength(data2.size()) });
+    auto expectedDataItem1(Reply::DataItem { reinterpret_cast<const char*>(data1.data()), ReplyStringLength(data1.size()) });
+    auto expectedDataItem2(Reply::DataItem { reinterpret_cast<const char*>(data2.data()), ReplyStringLength(data2.size()) });
     expectGetDataString(expectedDataItem1);
     expectGetDataString(expectedDataItem2);
     expectGetType(Reply::Type::NIL);
@@ -708,6 +1098,81 @@ TEST_F(AsyncRedisStorageTest, EmptyEntriesIsCheckedInGetAsyncAndAckIsScheduled)
     storedCallback();
 }
 
+TEST_F(AsyncRedisStorageTest, GetViewsAsyncSuccessfullyAndErrorIsForwarded)
+{
+    InSequence dummy;
+    expectContentsBuild("MGET", keysWithNonExistKey);
+    expectDispatchAsync();
+    std::vector<std::pair<AsyncStorage::Key, AsyncStorage::Data>> viewedData;
+    std::error_code viewedError;
+    sdlStorage->getViewsAsync(ns,
+                              keysWithNonExistKey,
+                              [&viewedData, &viewedError](const std::error_code& error, const AsyncStorage::DataViews& dataViews)
+                              {
+                                  viewedError = error;
+                                  viewedData.clear();
+                                  for (const auto& i : dataViews)
+                                      viewedData.push_back({ *i.first, AsyncStorage::Data(i.second.data, i.second.data + i.second.size) });
+                              });
+    expectGetArray();
+    auto expectedDataItem1(Reply::DataItem { reinterpret_cast<const char*>(data1.data()), ReplyStringLength(data1.size()) });
+    auto expectedDataItem2(Reply::DataItem { reinterpret_cast<const char*>(data2.data()), ReplyStringLength(data2.size()) });
+    expectGetDataString(expectedDataItem1);
+    expectGetDataString(expectedDataItem2);
+    expectGetType(Reply::Type::NIL);
+    savedCommandCb(std::error_code(), replyMock);
+    EXPECT_EQ(std::error_code(), viewedError);
+    ASSERT_EQ(size_t(2), viewedData.size());
+    EXPECT_EQ(key1, viewedData[0].first);
+    EXPECT_EQ(data1, viewedData[0].second);
+    EXPECT_EQ(key2, viewedData[1].first);
+    EXPECT_EQ(data2, viewedData[1].second);
+    savedCommandCb(getWellKnownErrorCode(), replyMock);
+    EXPECT_EQ(getWellKnownErrorCode(), viewedError);
+    EXPECT_TRUE(viewedData.empty());
+}
+
+TEST_F(AsyncRedisStorageTest, GetViewsAsyncWithVisitorSuccessfullyAndErrorIsForwarded)
+{
+    InSequence dummy;
+    expectContentsBuild("MGET", keysWithNonExistKey);
+    expectDispatchAsync();
+    AsyncStorage::DataMap visitedData;
+    sdlStorage->getViewsAsync(ns,
+                              keysWithNonExistKey,
+                              [&visitedData](const AsyncStorage::Key& key, const AsyncStorage::DataView& data)
+                              {
+                                  visitedData[key] = AsyncStorage::Data(data.data, data.data + data.size);
+                              },
+                              std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    expectGetArray();
+    auto expectedDataItem1(Reply::DataItem { reinterpret_cast<const char*>(data1.data()), ReplyStringLength(data1.size()) });
+    auto expectedDataItem2(Reply::DataItem { reinterpret_cast<const char*>(data2.data()), ReplyStringLength(data2.size()) });
+    expectGetDataString(expectedDataItem1);
+    expectGetDataString(expectedDataItem2);
+    expectGetType(Reply::Type::NIL);
+    expectModifyAck(std::error_code());
+    savedCommandCb(std::error_code(), replyMock);
+    EXPECT_EQ((AsyncStorage::DataMap { { key1, data1 }, { key2, data2 } }), visitedData);
+    visitedData.clear();
+    expectModifyAck(getWellKnownErrorCode());
+    savedCommandCb(getWellKnownErrorCode(), replyMock);
+    EXPECT_TRUE(visitedData.empty());
+}
+
+TEST_F(AsyncRedisStorageTest, EmptyEntriesIsCheckedInGetViewsAsyncWithVisitorAndAckIsScheduled)
+{
+    InSequence dummy;
+    expectNoDispatchAsync();
+    expectPostCallback();
+    sdlStorage->getViewsAsync(ns,
+                              { },
+                              [](const AsyncStorage::Key&, const AsyncStorage::DataView&) { },
+                              std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    expectModifyAck(std::error_code());
+    storedCallback();
+}
+
 TEST_F(AsyncRedisStorageTest, RemoveAsyncSuccessfullyAndErrorIsForwarded)
 {
     InSequence dummy;
@@ -755,7 +1220,7 @@ TEST_F(AsyncRedisStorageTest, EmptyEntriesIsCheckedInRemoveAsyncAndAckIsSchedule
 TEST_F(AsyncRedisStorageTest, FindKeysAsyncSuccessfullyAndErrorIsTranslated)
 {
     InSequence dummy;
-    expectContentsBuild("KEYS", keyPrefix);
+    expectScanContentsBuild("0", keyPrefix, AsyncRedisStorage::DEFAULT_SCAN_COUNT);
     expectDispatchAsync();
     sdlStorage->findKeysAsync(ns,
                               "",
@@ -763,22 +1228,23 @@ TEST_F(AsyncRedisStorageTest, FindKeysAsyncSuccessfullyAndErrorIsTranslated)
                                         this,
                                         std::placeholders::_1,
                                         std::placeholders::_2));
-    expectGetArray();
-    auto expectedDataItem1(Reply::DataItem { key1, ReplyStringLength(key1.size()) });
-    auto expectedDataItem2(Reply::DataItem { key2, ReplyStringLength(key2.size()) });
+    const Reply::DataItem lastCursor { "0", 1 };
+    expectGetScanPage(lastCursor);
+    auto expectedDataItem1(Reply::DataItem { key1.c_str(), ReplyStringLength(key1.size()) });
+    auto expectedDataItem2(Reply::DataItem { key2.c_str(), ReplyStringLength(key2.size()) });
     expectGetDataString(expectedDataItem1);
     expectGetType(Reply::Type::NIL);
     expectGetDataString(expectedDataItem2);
     expectFindKeysAck(std::error_code(), { key1, key2 });
-    savedCommandCb(std::error_code(), replyMock);
+    savedCommandCb(std::error_code(), scanReplyMock);
     expectFindKeysAck(getWellKnownErrorCode(), { });
-    savedCommandCb(getWellKnownErrorCode(), replyMock);
+    savedCommandCb(getWellKnownErrorCode(), scanReplyMock);
 }
 
 TEST_F(AsyncRedisStorageTest, ListKeysPatternSuccessfullyAndErrorIsTranslated)
 {
     InSequence dummy;
-    expectContentsBuild("KEYS", "{tag1},key[12]");
+    expectScanContentsBuild("0", "{tag1},key[12]", AsyncRedisStorage::DEFAULT_SCAN_COUNT);
     expectDispatchAsync();
     sdlStorage->listKeys(ns,
                          "key[12]",
@@ -786,86 +1252,742 @@ TEST_F(AsyncRedisStorageTest, ListKeysPatternSuccessfullyAndErrorIsTranslated)
                                    this,
                                    std::placeholders::_1,
                                    std::placeholders::_2));
-    expectGetArray();
-    auto expectedDataItem1(Reply::DataItem { key1, ReplyStringLength(key1.size()) });
-    auto expectedDataItem2(Reply::DataItem { key2, ReplyStringLength(key2.size()) });
+    const Reply::DataItem lastCursor { "0", 1 };
+    expectGetScanPage(lastCursor);
+    auto expectedDataItem1(Reply::DataItem { key1.c_str(), ReplyStringLength(key1.size()) });
+    auto expectedDataItem2(Reply::DataItem { key2.c_str(), ReplyStringLength(key2.size()) });
     expectGetDataString(expectedDataItem1);
     expectGetType(Reply::Type::NIL);
     expectGetDataString(expectedDataItem2);
     expectFindKeysAck(std::error_code(), { key1, key2 });
-    savedCommandCb(std::error_code(), replyMock);
+    savedCommandCb(std::error_code(), scanReplyMock);
     expectFindKeysAck(getWellKnownErrorCode(), { });
-    savedCommandCb(getWellKnownErrorCode(), replyMock);
+    savedCommandCb(getWellKnownErrorCode(), scanReplyMock);
 }
 
-TEST_F(AsyncRedisStorageTest, RemoveAllAsyncSuccessfully)
+TEST_F(AsyncRedisStorageTest, ListKeysCollectsKeysFromAllScanPages)
 {
     InSequence dummy;
-    expectContentsBuild("KEYS", keyPrefix);
+    expectScanContentsBuild("0", "{tag1},*", AsyncRedisStorage::DEFAULT_SCAN_COUNT);
     expectDispatchAsync();
-    sdlStorage->removeAllAsync(ns,
-                               std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
-    expectGetArray();
-    auto expectedDataItem1(Reply::DataItem { key1, ReplyStringLength(key1.size()) });
-    auto expectedDataItem2(Reply::DataItem { key2, ReplyStringLength(key2.size()) });
+    sdlStorage->listKeys(ns,
+                         "*",
+                         std::bind(&AsyncRedisStorageTest::findKeysAck,
+                                   this,
+                                   std::placeholders::_1,
+                                   std::placeholders::_2));
+    const Reply::DataItem nextCursor { "17", 2 };
+    expectGetScanPage(nextCursor);
+    auto expectedDataItem1(Reply::DataItem { key1.c_str(), ReplyStringLength(key1.size()) });
+    auto expectedDataItem2(Reply::DataItem { key2.c_str(), ReplyStringLength(key2.size()) });
     expectGetDataString(expectedDataItem1);
     expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    expectScanContentsBuild("17", "{tag1},*", AsyncRedisStorage::DEFAULT_SCAN_COUNT);
+    expectNextPageDispatchAsync();
+    savedCommandCb(std::error_code(), scanReplyMock);
+    const Reply::DataItem lastCursor { "0", 1 };
+    expectGetScanPage(lastCursor);
     expectGetDataString(expectedDataItem2);
-    expectContentsBuild("DELPUB", keys, ns, shareddatalayer::NO_PUBLISHER);
-    expectDispatchAsync();
-    savedCommandCb(std::error_code(), replyMock);
-    expectModifyAck(std::error_code());
-    savedCommandCb(std::error_code(), replyMock);
+    expectGetDataString(expectedDataItem1);
+    expectGetType(Reply::Type::NIL);
+    expectFindKeysAck(std::error_code(), { key1, key2 });
+    savedNextPageCommandCb(std::error_code(), scanReplyMock);
 }
 
-TEST_F(AsyncRedisStorageTestNotificationsDisabled, RemoveAllAsyncSuccessfullyNoPublish)
+TEST_F(AsyncRedisStorageTest, ListKeysIsAckedWithErrorIfLaterScanPageFails)
 {
     InSequence dummy;
-    expectContentsBuild("KEYS", keyPrefix);
+    expectScanContentsBuild("0", "{tag1},*", AsyncRedisStorage::DEFAULT_SCAN_COUNT);
     expectDispatchAsync();
-    sdlStorage->removeAllAsync(ns,
-                               std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
-    expectGetArray();
-    auto expectedDataItem1(Reply::DataItem { key1, ReplyStringLength(key1.size()) });
-    auto expectedDataItem2(Reply::DataItem { key2, ReplyStringLength(key2.size()) });
+    sdlStorage->listKeys(ns,
+                         "*",
+                         std::bind(&AsyncRedisStorageTest::findKeysAck,
+                                   this,
+                                   std::placeholders::_1,
+                                   std::placeholders::_2));
+    const Reply::DataItem nextCursor { "17", 2 };
+    expectGetScanPage(nextCursor);
+    auto expectedDataItem1(Reply::DataItem { key1.c_str(), ReplyStringLength(key1.size()) });
     expectGetDataString(expectedDataItem1);
     expectGetType(Reply::Type::NIL);
-    expectGetDataString(expectedDataItem2);
-    expectContentsBuild("DEL", keys);
-    expectDispatchAsync();
-    savedCommandCb(std::error_code(), replyMock);
+    expectGetType(Reply::Type::NIL);
+    expectScanContentsBuild("17", "{tag1},*", AsyncRedisStorage::DEFAULT_SCAN_COUNT);
+    expectNextPageDispatchAsync();
+    savedCommandCb(std::error_code(), scanReplyMock);
+    expectFindKeysAck(getWellKnownErrorCode(), { });
+    savedNextPageCommandCb(getWellKnownErrorCode(), scanReplyMock);
 }
 
-TEST_F(AsyncRedisStorageTest, NothingIsIssuedToBeRemovedIfNoKeysAreFoundUnderNamespace)
+TEST_F(AsyncRedisStorageTest, ScanKeysAsyncDeliversKeysPageByPage)
 {
     InSequence dummy;
-    Reply::ReplyVector empty;
-    expectContentsBuild("KEYS", keyPrefix);
+    bool continueScan(true);
+    expectScanContentsBuild("0", "{tag1},key*", 50);
+    expectDispatchAsync();
+    sdlStorage->scanKeysAsync(ns, "key*", 50, scanKeysAckContinuingWhile(continueScan));
+    const Reply::DataItem nextCursor { "17", 2 };
+    expectGetScanPage(nextCursor);
+    auto expectedDataItem1(Reply::DataItem { key1.c_str(), ReplyStringLength(key1.size()) });
+    auto expectedDataItem2(Reply::DataItem { key2.c_str(), ReplyStringLength(key2.size()) });
+    expectGetDataString(expectedDataItem1);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    EXPECT_CALL(*this, scanKeysAck(std::error_code(), AsyncStorage::Keys({ key1 }), true))
+        .Times(1);
+    expectScanContentsBuild("17", "{tag1},key*", 50);
+    expectNextPageDispatchAsync();
+    savedCommandCb(std::error_code(), scanReplyMock);
+    const Reply::DataItem lastCursor { "0", 1 };
+    expectGetScanPage(lastCursor);
+    expectGetDataString(expectedDataItem2);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    EXPECT_CALL(*this, scanKeysAck(std::error_code(), AsyncStorage::Keys({ key2 }), false))
+        .Times(1);
+    savedNextPageCommandCb(std::error_code(), scanReplyMock);
+}
+
+TEST_F(AsyncRedisStorageTest, ScanKeysAsyncIsStoppedIfNextPageIsNotRequested)
+{
+    InSequence dummy;
+    bool continueScan(false);
+    expectScanContentsBuild("0", "{tag1},*", 50);
+    expectDispatchAsync();
+    sdlStorage->scanKeysAsync(ns, "*", 50, scanKeysAckContinuingWhile(continueScan));
+    const Reply::DataItem nextCursor { "17", 2 };
+    expectGetScanPage(nextCursor);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    EXPECT_CALL(*this, scanKeysAck(std::error_code(), IsEmpty(), true))
+        .Times(1);
+    expectNoDispatchAsync();
+    savedCommandCb(std::error_code(), scanReplyMock);
+}
+
+TEST_F(AsyncRedisStorageTest, ScanKeysNextAcksWithErrorIfStorageHasBeenDestroyed)
+{
+    InSequence dummy;
+    AsyncStorage::ScanKeysNext savedNext;
+    expectScanContentsBuild("0", "{tag1},*", 50);
+    expectDispatchAsync();
+    sdlStorage->scanKeysAsync(ns,
+                              "*",
+                              50,
+                              [this, &savedNext](const std::error_code& error,
+                                                 const AsyncStorage::Keys& keys,
+                                                 const AsyncStorage::ScanKeysNext& next)
+                              {
+                                  scanKeysAck(error, keys, static_cast<bool>(next));
+                                  savedNext = next;
+                              });
+    const Reply::DataItem nextCursor { "17", 2 };
+    expectGetScanPage(nextCursor);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    EXPECT_CALL(*this, scanKeysAck(std::error_code(), IsEmpty(), true))
+        .Times(1);
+    savedCommandCb(std::error_code(), scanReplyMock);
+    expectClearStateChangedCb();
+    EXPECT_CALL(*dispatcherMock, disableCommandCallbacks())
+        .Times(1);
+    sdlStorage.reset();
+    expectNoDispatchAsync();
+    EXPECT_CALL(*this, scanKeysAck(std::error_code(AsyncRedisStorage::ErrorCode::REDIS_NOT_YET_DISCOVERED), IsEmpty(), false))
+        .Times(1);
+    savedNext();
+    createAndConnectAsyncStorageInstance(boost::none);
+}
+
+TEST_F(AsyncRedisStorageTest, ScanKeysAsyncUsesDefaultCountIfHintIsZero)
+{
+    InSequence dummy;
+    bool continueScan(true);
+    expectScanContentsBuild("0", "{tag1},*", AsyncRedisStorage::DEFAULT_SCAN_COUNT);
+    expectDispatchAsync();
+    sdlStorage->scanKeysAsync(ns, "*", 0, scanKeysAckContinuingWhile(continueScan));
+    EXPECT_CALL(*this, scanKeysAck(getWellKnownErrorCode(), IsEmpty(), false))
+        .Times(1);
+    savedCommandCb(getWellKnownErrorCode(), scanReplyMock);
+}
+
+TEST_F(AsyncRedisStorageTest, ScanKeysAsyncOperationTimeoutIsAppliedPerPage)
+{
+    InSequence dummy;
+    bool continueScan(true);
+    sdlStorage->setOperationTimeout(std::chrono::seconds(2));
+    expectArmTimer(std::chrono::seconds(2));
+    expectScanContentsBuild("0", "{tag1},*", 50);
+    expectDispatchAsync();
+    sdlStorage->scanKeysAsync(ns, "*", 50, scanKeysAckContinuingWhile(continueScan));
+    const Reply::DataItem nextCursor { "17", 2 };
+    expectGetScanPage(nextCursor);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    expectDisarmTimer();
+    EXPECT_CALL(*this, scanKeysAck(std::error_code(), IsEmpty(), true))
+        .Times(1);
+    expectArmTimer(std::chrono::seconds(2));
+    expectScanContentsBuild("17", "{tag1},*", 50);
+    expectNextPageDispatchAsync();
+    savedCommandCb(std::error_code(), scanReplyMock);
+    EXPECT_CALL(*this, scanKeysAck(std::error_code(AsyncRedisStorage::ErrorCode::OPERATION_TIMEOUT), IsEmpty(), false))
+        .Times(1);
+    savedTimerCallback();
+}
+
+TEST_F(AsyncRedisStorageTest, RemoveAllAsyncSuccessfully)
+{
+    InSequence dummy;
+    expectScanContentsBuild("0", keyPrefix, AsyncRedisStorage::DEFAULT_REMOVE_BATCH_SIZE);
     expectDispatchAsync();
     sdlStorage->removeAllAsync(ns,
                                std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
-    EXPECT_CALL(replyMock, getArray())
-        .Times(1)
-        .WillOnce(Return(&empty));
+    const Reply::DataItem lastCursor { "0", 1 };
+    expectGetScanPage(lastCursor);
+    auto expectedDataItem1(Reply::DataItem { key1.c_str(), ReplyStringLength(key1.size()) });
+    auto expectedDataItem2(Reply::DataItem { key2.c_str(), ReplyStringLength(key2.size()) });
+    expectGetDataString(expectedDataItem1);
+    expectGetType(Reply::Type::NIL);
+    expectGetDataString(expectedDataItem2);
+    expectUnlinkContentsBuild(keys);
+    expectNextPageDispatchAsync();
+    savedCommandCb(std::error_code(), scanReplyMock);
+    expectContentsBuild("PUBLISH", ns, shareddatalayer::NO_PUBLISHER);
+    expectPublishDispatch();
+    savedNextPageCommandCb(std::error_code(), replyMock);
+    expectModifyAck(std::error_code());
+    savedPublishCommandCb(std::error_code(), replyMock);
+}
+
+TEST_F(AsyncRedisStorageTestNotificationsDisabled, RemoveAllAsyncSuccessfullyNoPublish)
+{
+    InSequence dummy;
+    expectScanContentsBuild("0", keyPrefix, AsyncRedisStorage::DEFAULT_REMOVE_BATCH_SIZE);
+    expectDispatchAsync();
+    sdlStorage->removeAllAsync(ns,
+                               std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    const Reply::DataItem lastCursor { "0", 1 };
+    expectGetScanPage(lastCursor);
+    auto expectedDataItem1(Reply::DataItem { key1.c_str(), ReplyStringLength(key1.size()) });
+    auto expectedDataItem2(Reply::DataItem { key2.c_str(), ReplyStringLength(key2.size()) });
+    expectGetDataString(expectedDataItem1);
+    expectGetType(Reply::Type::NIL);
+    expectGetDataString(expectedDataItem2);
+    expectUnlinkContentsBuild(keys);
+    expectNextPageDispatchAsync();
+    savedCommandCb(std::error_code(), scanReplyMock);
+    expectModifyAck(std::error_code());
+    savedNextPageCommandCb(std::error_code(), replyMock);
+}
+
+TEST_F(AsyncRedisStorageTest, NothingIsIssuedToBeRemovedIfNoKeysAreFoundUnderNamespace)
+{
+    InSequence dummy;
+    expectScanContentsBuild("0", keyPrefix, AsyncRedisStorage::DEFAULT_REMOVE_BATCH_SIZE);
+    expectDispatchAsync();
+    sdlStorage->removeAllAsync(ns,
+                               std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    const Reply::DataItem lastCursor { "0", 1 };
+    expectGetScanPage(lastCursor);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
     EXPECT_CALL(*dispatcherMock, dispatchAsync(_, ns, _))
         .Times(0);
     expectModifyAck(std::error_code());
-    savedCommandCb(std::error_code(), replyMock);
+    savedCommandCb(std::error_code(), scanReplyMock);
 }
 
 TEST_F(AsyncRedisStorageTest, RemoveAllAsyncErrorIsForwarded)
 {
     InSequence dummy;
-    expectContentsBuild("KEYS", keyPrefix);
+    expectScanContentsBuild("0", keyPrefix, AsyncRedisStorage::DEFAULT_REMOVE_BATCH_SIZE);
     expectDispatchAsync();
     sdlStorage->removeAllAsync(ns,
                                std::bind(&AsyncRedisStorageTest::modifyAck,
                                          this,
                                          std::placeholders::_1));
     expectModifyAck(getWellKnownErrorCode());
+    savedCommandCb(getWellKnownErrorCode(), scanReplyMock);
+}
+
+TEST_F(AsyncRedisStorageTestRemoveBatchSizeOne, RemoveAllAsyncScansAndRemovesKeysInBatches)
+{
+    InSequence dummy;
+    AsyncCommandDispatcher::CommandCb savedUnlinkCommandCb1;
+    AsyncCommandDispatcher::CommandCb savedUnlinkCommandCb2;
+    expectScanContentsBuild("0", keyPrefix, 1);
+    expectDispatchAsync();
+    sdlStorage->removeAllAsync(ns,
+                               std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    const Reply::DataItem nextCursor { "17", 2 };
+    expectGetScanPage(nextCursor);
+    auto expectedDataItem1(Reply::DataItem { key1.c_str(), ReplyStringLength(key1.size()) });
+    auto expectedDataItem2(Reply::DataItem { key2.c_str(), ReplyStringLength(key2.size()) });
+    expectGetDataString(expectedDataItem1);
+    expectGetType(Reply::Type::NIL);
+    expectGetDataString(expectedDataItem2);
+    expectUnlinkContentsBuild({ key1 });
+    EXPECT_CALL(*dispatcherMock, dispatchAsync(_, ns, contents))
+        .Times(1)
+        .WillOnce(SaveMovedArg<0>(&savedUnlinkCommandCb1));
+    expectUnlinkContentsBuild({ key2 });
+    EXPECT_CALL(*dispatcherMock, dispatchAsync(_, ns, contents))
+        .Times(1)
+        .WillOnce(SaveMovedArg<0>(&savedUnlinkCommandCb2));
+    expectScanContentsBuild("17", keyPrefix, 1);
+    expectNextPageDispatchAsync();
+    savedCommandCb(std::error_code(), scanReplyMock);
+    savedUnlinkCommandCb1(std::error_code(), replyMock);
+    const Reply::DataItem lastCursor { "0", 1 };
+    expectGetScanPage(lastCursor);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    savedNextPageCommandCb(std::error_code(), scanReplyMock);
+    expectModifyAck(std::error_code());
+    savedUnlinkCommandCb2(std::error_code(), replyMock);
+}
+
+TEST_F(AsyncRedisStorageTestRemoveBatchSizeOne, RemoveAllAsyncStopsScanningAfterRemoveError)
+{
+    InSequence dummy;
+    expectScanContentsBuild("0", keyPrefix, 1);
+    expectDispatchAsync();
+    sdlStorage->removeAllAsync(ns,
+                               std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    const Reply::DataItem nextCursor { "17", 2 };
+    expectGetScanPage(nextCursor);
+    auto expectedDataItem1(Reply::DataItem { key1.c_str(), ReplyStringLength(key1.size()) });
+    expectGetDataString(expectedDataItem1);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    expectUnlinkContentsBuild({ key1 });
+    expectNextPageDispatchAsync();
+    expectScanContentsBuild("17", keyPrefix, 1);
+    AsyncCommandDispatcher::CommandCb savedScanCommandCb;
+    EXPECT_CALL(*dispatcherMock, dispatchAsync(_, ns, contents))
+        .Times(1)
+        .WillOnce(SaveMovedArg<0>(&savedScanCommandCb));
+    savedCommandCb(std::error_code(), scanReplyMock);
+    savedNextPageCommandCb(getWellKnownErrorCode(), replyMock);
+    expectGetScanPage(nextCursor);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    expectModifyAck(getWellKnownErrorCode());
+    savedScanCommandCb(std::error_code(), scanReplyMock);
+}
+
+TEST_F(AsyncRedisStorageTestNotificationsDisabled, RemoveByPrefixAsyncSuccessfully)
+{
+    InSequence dummy;
+    expectScanContentsBuild("0", "{tag1},key\\[1*", AsyncRedisStorage::DEFAULT_REMOVE_BATCH_SIZE);
+    expectDispatchAsync();
+    sdlStorage->removeByPrefixAsync(ns,
+                                    "key[1",
+                                    std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    const Reply::DataItem lastCursor { "0", 1 };
+    expectGetScanPage(lastCursor);
+    auto expectedDataItem1(Reply::DataItem { key1.c_str(), ReplyStringLength(key1.size()) });
+    expectGetDataString(expectedDataItem1);
+    expectGetType(Reply::Type::NIL);
+    expectGetType(Reply::Type::NIL);
+    expectUnlinkContentsBuild({ key1 });
+    expectNextPageDispatchAsync();
+    savedCommandCb(std::error_code(), scanReplyMock);
+    expectModifyAck(std::error_code());
+    savedNextPageCommandCb(std::error_code(), replyMock);
+}
+
+TEST_F(AsyncRedisStorageSubscriberTest, SubscribeChannelAsyncSubscribesOnDedicatedConnection)
+{
+    subscribe({ "ch1", "ch2" }, { "{tag1},ch1", "{tag1},ch2" });
+}
+
+TEST_F(AsyncRedisStorageSubscriberTest, ModificationsChannelIsTheNamespaceIdentifier)
+{
+    subscribe({ AsyncStorage::MODIFICATIONS_CHANNEL }, { ns });
+}
+
+TEST_F(AsyncRedisStorageSubscriberTest, SubscribeChannelAsyncErrorIsForwarded)
+{
+    InSequence dummy;
+    expectSubscriberCreation();
+    sdlStorage->subscribeChannelAsync(ns,
+                                      { "ch1" },
+                                      getNotificationCb(),
+                                      std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    expectSubscriberCommand("SUBSCRIBE", { "{tag1},ch1" });
+    subscriberConnectAck();
+    expectModifyAck(getWellKnownErrorCode());
+    savedSubscribeCommandCb(getWellKnownErrorCode(), replyMock);
+}
+
+TEST_F(AsyncRedisStorageSubscriberTest, MessagesReceivedDuringOneEventLoopIterationAreDeliveredTogether)
+{
+    subscribe({ "ch1", "ch2" }, { "{tag1},ch1", "{tag1},ch2" });
+    InSequence dummy;
+    expectPostCallback();
+    savedSubscribeCommandCb(std::error_code(), pubSubReply("message", "{tag1},ch1", "msg1"));
+    savedSubscribeCommandCb(std::error_code(), pubSubReply("message", "{tag1},ch2", "msg2"));
+    savedSubscribeCommandCb(std::error_code(), pubSubReply("message", "{tag1},ch1", "msg3"));
+    EXPECT_CALL(*this, notificationCb("ch1", AsyncStorage::Messages({ "msg1", "msg3" })))
+        .Times(1);
+    EXPECT_CALL(*this, notificationCb("ch2", AsyncStorage::Messages({ "msg2" })))
+        .Times(1);
+    storedCallback();
+}
+
+TEST_F(AsyncRedisStorageSubscriberTest, MessagesAreNotDeliveredAfterUnsubscribe)
+{
+    subscribe({ "ch1" }, { "{tag1},ch1" });
+    InSequence dummy;
+    expectPostCallback();
+    savedSubscribeCommandCb(std::error_code(), pubSubReply("message", "{tag1},ch1", "msg1"));
+    Engine::Callback deliverCallback(std::move(storedCallback));
+    expectSubscriberCommand("UNSUBSCRIBE", { "{tag1},ch1" });
+    expectPostCallback();
+    sdlStorage->unsubscribeChannelAsync(ns,
+                                        { "ch1" },
+                                        std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    expectModifyAck(std::error_code());
+    storedCallback();
+    EXPECT_CALL(*this, notificationCb(_, _))
+        .Times(0);
+    deliverCallback();
+    savedSubscribeCommandCb(std::error_code(), pubSubReply("message", "{tag1},ch1", "msg2"));
+}
+
+TEST_F(AsyncRedisStorageSubscriberTest, SubscriptionsAreRenewedAfterReconnection)
+{
+    subscribe({ "ch1", "ch2" }, { "{tag1},ch1", "{tag1},ch2" });
+    InSequence dummy;
+    expectSubscriberWaitConnectedAsync();
+    subscriberDisconnectCb();
+    expectSubscriberCommand("SUBSCRIBE", { "{tag1},ch1", "{tag1},ch2" });
+    subscriberConnectAck();
+    savedSubscribeCommandCb(std::error_code(), pubSubReply("subscribe", "{tag1},ch1", ""));
+    savedSubscribeCommandCb(std::error_code(), pubSubReply("subscribe", "{tag1},ch2", ""));
+}
+
+TEST_F(AsyncRedisStorageNearCacheTest, GetAsyncIsServedFromNearCacheAfterSubscriptionIsConfirmed)
+{
+    fillNearCache();
+    InSequence dummy;
+    expectNoDispatchAsync();
+    expectGetFromNearCache(keys, dataMap);
+}
+
+TEST_F(AsyncRedisStorageNearCacheTest, OnlyKeysMissingFromNearCacheAreRead)
+{
+    fillNearCache();
+    InSequence dummy;
+    expectMgetDispatch({ "key3" });
+    getAsync({ key1, "key3" });
+    expectGetArray();
+    expectGetType(Reply::Type::NIL);
+    expectGetAck(std::error_code(), { { key1, data1 } });
+    savedCommandCb(std::error_code(), replyMock);
+}
+
+TEST_F(AsyncRedisStorageNearCacheTest, ModificationNotificationClearsNearCache)
+{
+    fillNearCache();
+    InSequence dummy;
+    savedSubscribeCommandCb(std::error_code(), pubSubReply("message", ns, "somePublisher"));
+    expectMgetDispatch(keys);
+    getAsync(keys);
+}
+
+TEST_F(AsyncRedisStorageNearCacheTest, LocalModificationInvalidatesModifiedKeys)
+{
+    fillNearCache();
+    InSequence dummy;
+    expectContentsBuild("DELPUB", { key1 }, ns, shareddatalayer::NO_PUBLISHER);
+    EXPECT_CALL(*dispatcherMock, dispatchAsync(_, ns, contents))
+        .Times(1);
+    sdlStorage->removeAsync(ns,
+                            { key1 },
+                            std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    expectGetFromNearCache({ key2 }, { { key2, data2 } });
+    expectMgetDispatch({ key1 });
+    getAsync({ key1 });
+}
+
+TEST_F(AsyncRedisStorageNearCacheTest, DataReadBeforeLocalModificationIsNotCached)
+{
+    createNearCache();
+    InSequence dummy;
+    replyToMget();
+    expectMgetDispatch(keys);
+    getAsync(keys);
+    expectContentsBuild("DELPUB", { key1 }, ns, shareddatalayer::NO_PUBLISHER);
+    EXPECT_CALL(*dispatcherMock, dispatchAsync(_, ns, contents))
+        .Times(1);
+    sdlStorage->removeAsync(ns,
+                            { key1 },
+                            std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    replyToMget();
+    expectMgetDispatch(keys);
+    getAsync(keys);
+}
+
+TEST_F(AsyncRedisStorageNearCacheTest, NearCacheIsNotUsedWhileSubscriberIsDisconnected)
+{
+    fillNearCache();
+    InSequence dummy;
+    expectSubscriberWaitConnectedAsync();
+    subscriberDisconnectCb();
+    expectMgetDispatch(keys);
+    getAsync(keys);
+    replyToMget();
+    expectMgetDispatch(keys);
+    getAsync(keys);
+    expectSubscriberCommand("SUBSCRIBE", { ns });
+    subscriberConnectAck();
+    savedSubscribeCommandCb(std::error_code(), pubSubReply("subscribe", ns, ""));
+    replyToMget();
+    expectMgetDispatch(keys);
+    getAsync(keys);
+}
+
+TEST_F(AsyncRedisStorageNearCacheTest, UnsubscribingModificationsChannelDoesNotEndNearCacheSubscription)
+{
+    fillNearCache();
+    InSequence dummy;
+    expectSubscriberCommand("SUBSCRIBE", { ns });
+    sdlStorage->subscribeChannelAsync(ns,
+                                      { AsyncStorage::MODIFICATIONS_CHANNEL },
+                                      getNotificationCb(),
+                                      std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    expectModifyAck(std::error_code());
+    savedSubscribeCommandCb(std::error_code(), pubSubReply("subscribe", ns, ""));
+    expectPostCallback();
+    sdlStorage->unsubscribeChannelAsync(ns,
+                                        { AsyncStorage::MODIFICATIONS_CHANNEL },
+                                        std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    expectModifyAck(std::error_code());
+    storedCallback();
+    expectGetFromNearCache(keys, dataMap);
+}
+
+TEST_F(AsyncRedisStorageTest, GetBatchAsyncReadsAllNamespacesBeforeAnyReplyAndCombinesResults)
+{
+    InSequence dummy;
+    const AsyncStorage::Namespace ns2("tag2");
+    AsyncCommandDispatcher::CommandCb savedCommandCb2;
+    EXPECT_CALL(*dispatcherMock, cork())
+        .Times(1);
+    expectContentsBuild("MGET", keys);
+    expectDispatchAsync();
+    EXPECT_CALL(*contentsBuilderMock, build("MGET", ns2, AsyncStorage::Keys({ key1 })))
+        .Times(1)
+        .WillOnce(Return(contents));
+    EXPECT_CALL(*dispatcherMock, dispatchAsync(_, ns2, contents))
+        .Times(1)
+        .WillOnce(SaveMovedArg<0>(&savedCommandCb2));
+    EXPECT_CALL(*dispatcherMock, uncork())
+        .Times(1);
+    sdlStorage->getBatchAsync({ { ns, keys }, { ns2, { key1 } } },
+                              std::bind(&AsyncRedisStorageTest::getBatchAck,
+                                        this,
+                                        std::placeholders::_1,
+                                        std::placeholders::_2));
+    const auto dataItem1(Reply::DataItem { reinterpret_cast<const char*>(data1.data()), ReplyStringLength(data1.size()) });
+    const auto dataItem2(Reply::DataItem { reinterpret_cast<const char*>(data2.data()), ReplyStringLength(data2.size()) });
+    expectGetArray();
+    expectGetDataString(dataItem1);
+    savedCommandCb2(std::error_code(), replyMock);
+    expectGetArray();
+    expectGetDataString(dataItem1);
+    expectGetDataString(dataItem2);
+    EXPECT_CALL(*this, getBatchAck(std::error_code(),
+                                   AsyncStorage::NamespaceDataMaps({ { ns, dataMap }, { ns2, { { key1, data1 } } } })))
+        .Times(1);
+    savedCommandCb(std::error_code(), replyMock);
+}
+
+TEST_F(AsyncRedisStorageTest, GetBatchAsyncErrorIsForwardedWithoutData)
+{
+    InSequence dummy;
+    const AsyncStorage::Namespace ns2("tag2");
+    AsyncCommandDispatcher::CommandCb savedCommandCb2;
+    EXPECT_CALL(*dispatcherMock, cork())
+        .Times(1);
+    expectContentsBuild("MGET", keys);
+    expectDispatchAsync();
+    EXPECT_CALL(*contentsBuilderMock, build("MGET", ns2, keys))
+        .Times(1)
+        .WillOnce(Return(contents));
+    EXPECT_CALL(*dispatcherMock, dispatchAsync(_, ns2, contents))
+        .Times(1)
+        .WillOnce(SaveMovedArg<0>(&savedCommandCb2));
+    EXPECT_CALL(*dispatcherMock, uncork())
+        .Times(1);
+    sdlStorage->getBatchAsync({ { ns, keys }, { ns2, keys } },
+                              std::bind(&AsyncRedisStorageTest::getBatchAck,
+                                        this,
+                                        std::placeholders::_1,
+                                        std::placeholders::_2));
+    savedCommandCb2(getWellKnownErrorCode(), replyMock);
+    EXPECT_CALL(*this, getBatchAck(getWellKnownErrorCode(), IsEmpty()))
+        .Times(1);
+    savedCommandCb(getWellKnownErrorCode(), replyMock);
+}
+
+TEST_F(AsyncRedisStorageTest, SetBatchAsyncWritesAllNamespacesAndFirstErrorIsForwarded)
+{
+    InSequence dummy;
+    const AsyncStorage::Namespace ns2("tag2");
+    AsyncCommandDispatcher::CommandCb savedCommandCb2;
+    EXPECT_CALL(*dispatcherMock, cork())
+        .Times(1);
+    expectContentsBuild("MSETPUB", dataMap, ns, shareddatalayer::NO_PUBLISHER);
+    expectDispatchAsync();
+    EXPECT_CALL(*contentsBuilderMock, build("MSETPUB", ns2, dataMap, ns2, shareddatalayer::NO_PUBLISHER))
+        .Times(1)
+        .WillOnce(Return(contents));
+    EXPECT_CALL(*dispatcherMock, dispatchAsync(_, ns2, contents))
+        .Times(1)
+        .WillOnce(SaveMovedArg<0>(&savedCommandCb2));
+    EXPECT_CALL(*dispatcherMock, uncork())
+        .Times(1);
+    sdlStorage->setBatchAsync({ { ns, dataMap }, { ns2, dataMap } },
+                              std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    savedCommandCb(getWellKnownErrorCode(), replyMock);
+    expectModifyAck(getWellKnownErrorCode());
+    savedCommandCb2(std::error_code(), replyMock);
+}
+
+TEST_F(AsyncRedisStorageTest, EmptyBatchIsAckedThroughEngine)
+{
+    InSequence dummy;
+    expectNoDispatchAsync();
+    expectPostCallback();
+    sdlStorage->getBatchAsync({ },
+                              std::bind(&AsyncRedisStorageTest::getBatchAck,
+                                        this,
+                                        std::placeholders::_1,
+                                        std::placeholders::_2));
+    EXPECT_CALL(*this, getBatchAck(std::error_code(), IsEmpty()))
+        .Times(1);
+    storedCallback();
+}
+
+TEST_F(AsyncRedisStorageTest, WriteBatchAsyncExecutesAllOperationsWithOneScriptAndForwardsStatuses)
+{
+    InSequence dummy;
+    const std::string str1(data1.begin(), data1.end());
+    const std::string str2(data2.begin(), data2.end());
+    expectWriteBatchContentsBuild({ key1, key2, key1 },
+                                  { ns, shareddatalayer::NO_PUBLISHER,
+                                    "set", "1", str1,
+                                    "setie", str1, str2,
+                                    "delie", str2 });
+    expectDispatchAsync();
+    writeBatch(WriteBatch().set({ { key1, data1 } }).setIf(key2, data1, data2).removeIf(key1, data2));
+    expectGetType(Reply::Type::ARRAY);
+    expectGetArray();
+    EXPECT_CALL(replyMock, getInteger())
+        .Times(3)
+        .WillOnce(Return(1))
+        .WillOnce(Return(0))
+        .WillOnce(Return(1));
+    EXPECT_CALL(*this, writeBatchAck(std::error_code(), std::vector<bool>({ true, false, true })))
+        .Times(1);
+    savedCommandCb(std::error_code(), replyMock);
+}
+
+TEST_F(AsyncRedisStorageTestNotificationsDisabled, WriteBatchAsyncDoesNotPublish)
+{
+    InSequence dummy;
+    const std::string str1(data1.begin(), data1.end());
+    expectWriteBatchContentsBuild({ key1, key2, key1 },
+                                  { "", shareddatalayer::NO_PUBLISHER,
+                                    "del", "2",
+                                    "setnx", str1 });
+    expectDispatchAsync();
+    writeBatch(WriteBatch().remove(keys).setIfNotExists(key1, data1));
+}
+
+TEST_F(AsyncRedisStorageTest, WriteBatchAsyncErrorIsForwardedWithoutStatuses)
+{
+    InSequence dummy;
+    const std::string str1(data1.begin(), data1.end());
+    const std::string str2(data2.begin(), data2.end());
+    expectWriteBatchContentsBuild({ key1, key2 }, { ns, shareddatalayer::NO_PUBLISHER, "set", "2", str1, str2 });
+    expectDispatchAsync();
+    writeBatch(WriteBatch().set(dataMap));
+    EXPECT_CALL(*this, writeBatchAck(getWellKnownErrorCode(), IsEmpty()))
+        .Times(1);
     savedCommandCb(getWellKnownErrorCode(), replyMock);
 }
 
+TEST_F(AsyncRedisStorageTest, WriteBatchAsyncUnexpectedReplyIsForwardedAsError)
+{
+    InSequence dummy;
+    const std::string str1(data1.begin(), data1.end());
+    const std::string str2(data2.begin(), data2.end());
+    expectWriteBatchContentsBuild({ key1, key2 }, { ns, shareddatalayer::NO_PUBLISHER, "set", "2", str1, str2 });
+    expectDispatchAsync();
+    writeBatch(WriteBatch().set(dataMap));
+    expectGetType(Reply::Type::NIL);
+    EXPECT_CALL(*this, writeBatchAck(std::error_code(AsyncRedisCommandDispatcherErrorCode::UNKNOWN_ERROR), IsEmpty()))
+        .Times(1);
+    savedCommandCb(std::error_code(), replyMock);
+}
+
+TEST_F(AsyncRedisStorageTest, EmptyWriteBatchIsAckedThroughEngine)
+{
+    InSequence dummy;
+    expectNoDispatchAsync();
+    expectPostCallback();
+    writeBatch(WriteBatch());
+    EXPECT_CALL(*this, writeBatchAck(std::error_code(), IsEmpty()))
+        .Times(1);
+    storedCallback();
+}
+
+TEST_F(AsyncRedisStorageTest, PublishAsyncSuccessfullyAndErrorIsForwarded)
+{
+    InSequence dummy;
+    expectContentsBuild("PUBLISH", "{tag1},ch1", "msg");
+    expectDispatchAsync();
+    sdlStorage->publishAsync(ns,
+                             "ch1",
+                             "msg",
+                             std::bind(&AsyncRedisStorageTest::modifyAck, this, std::placeholders::_1));
+    expectModifyAck(std::error_code());
+    savedCommandCb(std::error_code(), replyMock);
+    expectModifyAck(getWellKnownErrorCode());
+    savedCommandCb(getWellKnownErrorCode(), replyMock);
+}
+
+TEST_F(AsyncRedisStorageRemoveBatchSizeTest, DefaultIsUsedIfEnvironmentVariableIsNotSet)
+{
+    expectGetenv(nullptr);
+    EXPECT_EQ(AsyncRedisStorage::DEFAULT_REMOVE_BATCH_SIZE, AsyncRedisStorage::getRemoveBatchSize(systemMock));
+}
+
+TEST_F(AsyncRedisStorageRemoveBatchSizeTest, BatchSizeCanBeSetWithEnvironmentVariable)
+{
+    expectGetenv("200");
+    EXPECT_EQ(200U, AsyncRedisStorage::getRemoveBatchSize(systemMock));
+}
+
+TEST_F(AsyncRedisStorageRemoveBatchSizeTest, InvalidBatchSizeIsIgnored)
+{
+    expectGetenv("many");
+    EXPECT_EQ(AsyncRedisStorage::DEFAULT_REMOVE_BATCH_SIZE, AsyncRedisStorage::getRemoveBatchSize(systemMock));
+    expectGetenv("0");
+    EXPECT_EQ(AsyncRedisStorage::DEFAULT_REMOVE_BATCH_SIZE, AsyncRedisStorage::getRemoveBatchSize(systemMock));
+}
+
 TEST_F(AsyncRedisStorageTest, SetIfNotExistsAsyncSuccess)
 {
     InSequence dummy;
@@ -30,6 +30,7 @@
 #include "private/tst/asynccommanddispatchermock.hpp"
 #include "private/tst/contentsbuildermock.hpp"
 #include "private/tst/enginemock.hpp"
+#include "private/tst/moveargaction.hpp"
 #include "private/tst/replymock.hpp"
 #include "private/tst/wellknownerrorcode.hpp"
 
@@ -58,6 +59,7 @@ namespace
         ReplyMock masterInquiryReplyMock;
         std::string someHost;
         uint16_t somePort;
+        std::string somePortString;
         std::string someOtherHost;
         uint16_t someOtherPort;
         Reply::DataItem hostDataItem;
@@ -93,10 +95,11 @@ namespace
             contents({{"aaa","bbb"},{3,3}}),
             someHost("somehost"),
             somePort(1234),
+            somePortString(std::to_string(somePort)),
             someOtherHost("someotherhost"),
             someOtherPort(5678),
-            hostDataItem({someHost,ReplyStringLength(someHost.length())}),
-            portDataItem({std::to_string(somePort),ReplyStringLength(std::to_string(somePort).length())}),
+            hostDataItem({someHost.c_str(),ReplyStringLength(someHost.length())}),
+            portDataItem({somePortString.c_str(),ReplyStringLength(somePortString.length())}),
             masterInquiryReplyHost(std::make_shared<ReplyMock>()),
             masterInquiryReplyPort(std::make_shared<ReplyMock>()),
             expectedMasterInquiryRetryTimerDuration(std::chrono::seconds(1)),
@@ -109,17 +112,17 @@ namespace
             notificationReplyArrayElement2(std::make_shared<ReplyMock>()),
             notificationDataItem({"message",7}),
             notificationMessage("mymaster " + someHost + " " + std::to_string(somePort) + " " + someOtherHost + " " + std::to_string(someOtherPort)),
-            notificationMessageDataItem({notificationMessage, ReplyStringLength(notificationMessage.length())}),
+            notificationMessageDataItem({notificationMessage.c_str(), ReplyStringLength(notificationMessage.length())}),
             expectedSubscribeRetryTimerDuration(std::chrono::seconds(1))
         {
-            masterInquiryReply.push_back(masterInquiryReplyHost);
-            masterInquiryReply.push_back(masterInquiryReplyPort);
-            subscribeReplyVector.push_back(subscribeReplyArrayElement0);
-            subscribeReplyVector.push_back(subscribeReplyArrayElement1);
-            subscribeReplyVector.push_back(subscribeReplyArrayElement2);
-            notificationReplyVector.push_back(notificationReplyArrayElement0);
-            notificationReplyVector.push_back(notificationReplyArrayElement1);
-            notificationReplyVector.push_back(notificationReplyArrayElement2);
+            masterInquiryReply.push_back(masterInquiryReplyHost.get());
+            masterInquiryReply.push_back(masterInquiryReplyPort.get());
+            subscribeReplyVector.push_back(subscribeReplyArrayElement0.get());
+            subscribeReplyVector.push_back(subscribeReplyArrayElement1.get());
+            subscribeReplyVector.push_back(subscribeReplyArrayElement2.get());
+            notificationReplyVector.push_back(notificationReplyArrayElement0.get());
+            notificationReplyVector.push_back(notificationReplyArrayElement1.get());
+            notificationReplyVector.push_back(notificationReplyArrayElement2.get());
         }
 
         virtual ~AsyncSentinelDatabaseDiscoveryBaseTest()
@@ -203,14 +206,14 @@ namespace
         {
             EXPECT_CALL(*subscriberMock, dispatchAsync(_, _, contents))
                 .Times(1)
-                .WillOnce(SaveArg<0>(&savedSubscriberCommandCb));
+                .WillOnce(SaveMovedArg<0>(&savedSubscriberCommandCb));
         }
 
         void expectDispatcherDispatchAsync()
         {
             EXPECT_CALL(*dispatcherMock, dispatchAsync(_, _, contents))
                 .Times(1)
-                .WillOnce(SaveArg<0>(&savedDispatcherCommandCb));
+                .WillOnce(SaveMovedArg<0>(&savedDispatcherCommandCb));
         }
 
         void expectSubscribeNotifications()
@@ -480,7 +483,7 @@ TEST_F(AsyncSentinelDatabaseDiscoveryDeathTest, MasterInquiryParsingErrorAborts_
     dispatcherConnectAck();
     setDefaultResponsesForMasterInquiryReplyParsing();
     std::string invalidPort("invalidPort");
-    Reply::DataItem invalidPortDataItem({invalidPort,ReplyStringLength(invalidPort.length())});
+    Reply::DataItem invalidPortDataItem({invalidPort.c_str(),ReplyStringLength(invalidPort.length())});
     ON_CALL(*masterInquiryReplyPort, getString())
         .WillByDefault(Return(&invalidPortDataItem));
     EXPECT_EXIT(savedDispatcherCommandCb(std::error_code(), masterInquiryReplyMock), KilledBySignal(SIGABRT), ".*Master inquiry reply parsing error");
@@ -546,7 +549,7 @@ TEST_F(AsyncSentinelDatabaseDiscoveryInListeningModeDeathTest, SubscribeReplyPar
     InSequence dummy;
     setDefaultResponsesForNotificationReplyParsing();
     std::string invalidKind("invalidKind");
-    Reply::DataItem invalidKindDataItem({invalidKind,ReplyStringLength(invalidKind.length())});
+    Reply::DataItem invalidKindDataItem({invalidKind.c_str(),ReplyStringLength(invalidKind.length())});
     ON_CALL(*notificationReplyArrayElement0, getString())
         .WillByDefault(Return(&invalidKindDataItem));
     EXPECT_EXIT(savedSubscriberCommandCb(std::error_code(), notificationReplyMock), KilledBySignal(SIGABRT), ".*SUBSCRIBE command reply parsing error");
@@ -566,7 +569,7 @@ TEST_F(AsyncSentinelDatabaseDiscoveryInListeningModeDeathTest, SubscribeReplyPar
     InSequence dummy;
     setDefaultResponsesForNotificationReplyParsing();
     std::string invalidMessage("mymaster oldHost 1234 5678");
-    auto invalidMessageDataItem(Reply::DataItem({invalidMessage, ReplyStringLength(invalidMessage.length())}));
+    auto invalidMessageDataItem(Reply::DataItem({invalidMessage.c_str(), ReplyStringLength(invalidMessage.length())}));
     ON_CALL(*notificationReplyArrayElement2, getString())
         .WillByDefault(Return(&invalidMessageDataItem));
     EXPECT_EXIT(savedSubscriberCommandCb(std::error_code(), notificationReplyMock), KilledBySignal(SIGABRT), ".*Notification message parsing error");
@@ -577,7 +580,7 @@ TEST_F(AsyncSentinelDatabaseDiscoveryInListeningModeDeathTest, SubscribeReplyPar
     InSequence dummy;
     setDefaultResponsesForNotificationReplyParsing();
     std::string invalidMessage("mymaster oldHost 1234 newHost invalidPort");
-    auto invalidMessageDataItem(Reply::DataItem({invalidMessage, ReplyStringLength(invalidMessage.length())}));
+    auto invalidMessageDataItem(Reply::DataItem({invalidMessage.c_str(), ReplyStringLength(invalidMessage.length())}));
     ON_CALL(*notificationReplyArrayElement2, getString())
         .WillByDefault(Return(&invalidMessageDataItem));
     EXPECT_EXIT(savedSubscriberCommandCb(std::error_code(), notificationReplyMock), KilledBySignal(SIGABRT), ".*Notification message parsing error");
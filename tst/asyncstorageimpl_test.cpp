@@ -30,6 +30,7 @@
 #include "private/tst/enginemock.hpp"
 #include "private/tst/asyncdatabasediscoverymock.hpp"
 #include "private/tst/databaseconfigurationmock.hpp"
+#include "private/tst/moveargaction.hpp"
 #include "private/tst/namespaceconfigurationsmock.hpp"
 
 using namespace shareddatalayer;
@@ -50,6 +51,7 @@ namespace
         Engine::Callback storedCallback;
         std::unique_ptr<AsyncStorageImpl> asyncStorageImpl;
         std::shared_ptr<Logger> logger;
+        StatisticsConfiguration statisticsConfiguration;
 
         AsyncStorageImplTest():
             engineMock(std::make_shared<StrictMock<EngineMock>>()),
@@ -62,6 +64,14 @@ namespace
         {
             dummyDatabaseConfiguration->checkAndApplyDbType("redis-standalone");
             dummyDatabaseConfiguration->checkAndApplyServerAddress("dummydatabaseaddress.local");
+            statisticsConfiguration.enabled = true;
+            EXPECT_CALL(*namespaceConfigurationsMock, isNearCacheUsed())
+                .WillRepeatedly(Return(false));
+            createAsyncStorageImpl();
+        }
+
+        void createAsyncStorageImpl()
+        {
             asyncStorageImpl.reset(new AsyncStorageImpl(engineMock,
                                                         boost::none,
                                                         dummyDatabaseConfiguration,
@@ -73,7 +83,19 @@ namespace
                                                                   std::placeholders::_2,
                                                                   std::placeholders::_3,
                                                                   std::placeholders::_4,
-                                                                  std::placeholders::_5)));
+                                                                  std::placeholders::_5),
+                                                        statisticsConfiguration));
+        }
+
+        Statistics getStatistics()
+        {
+            Engine::Callback callback;
+            EXPECT_CALL(*engineMock, postCallback(_))
+                .WillOnce(SaveMovedArg<0>(&callback));
+            Statistics statistics;
+            asyncStorageImpl->getStatisticsAsync([&statistics](const Statistics& snapshot) { statistics = snapshot; });
+            callback();
+            return statistics;
         }
 
         std::shared_ptr<redis::AsyncDatabaseDiscovery> asyncDatabaseDiscoveryCreator(std::shared_ptr<Engine>,
@@ -145,6 +167,96 @@ TEST_F(AsyncStorageImplTest, CorrectHandlerIsUsedBasedOnConfiguration)
     EXPECT_EQ(typeid(AsyncDummyStorage&), typeid(returnedHandler2));
 }
 
+TEST_F(AsyncStorageImplTest, CompletedOperationsAreIncludedInStatistics)
+{
+    std::vector<Engine::Callback> callbacks;
+    EXPECT_CALL(*engineMock, postCallback(_))
+        .WillRepeatedly(AppendMovedArg<0>(&callbacks));
+    EXPECT_CALL(*namespaceConfigurationsMock, isDbBackendUseEnabled(ns))
+        .WillRepeatedly(Return(false));
+    int acks(0);
+    asyncStorageImpl->setAsync(ns, { { "key", { 1, 2, 3 } } }, [&acks](const std::error_code&) { ++acks; });
+    asyncStorageImpl->getAsync(ns, { "key" }, [&acks](const std::error_code&, const AsyncStorage::DataMap&) { ++acks; });
+    for (const auto& callback : callbacks)
+        callback();
+    callbacks.clear();
+    EXPECT_EQ(2, acks);
+
+    Statistics statistics;
+    asyncStorageImpl->getStatisticsAsync([&statistics](const Statistics& snapshot) { statistics = snapshot; });
+    ASSERT_EQ(1U, callbacks.size());
+    callbacks.front()();
+    ASSERT_EQ(1U, statistics.getNamespaces().count(ns));
+    const auto& operations(statistics.getNamespaces().at(ns));
+    ASSERT_EQ(2U, operations.size());
+    EXPECT_EQ(1U, operations.at(Statistics::OperationType::SET).count);
+    EXPECT_EQ(6U, operations.at(Statistics::OperationType::SET).bytesSent);
+    EXPECT_EQ(1U, operations.at(Statistics::OperationType::GET).count);
+    EXPECT_EQ(3U, operations.at(Statistics::OperationType::GET).bytesSent);
+}
+
+TEST_F(AsyncStorageImplTest, BatchIsCountedAsOperationOfEachNamespace)
+{
+    const AsyncStorage::Namespace anotherNs("anotherKnownNamespace");
+    std::vector<Engine::Callback> callbacks;
+    EXPECT_CALL(*engineMock, postCallback(_))
+        .WillRepeatedly(AppendMovedArg<0>(&callbacks));
+    EXPECT_CALL(*namespaceConfigurationsMock, isDbBackendUseEnabled(_))
+        .WillRepeatedly(Return(false));
+    asyncStorageImpl->setBatchAsync({ { ns, { { "key", { 1 } } } }, { anotherNs, { { "k", { 1, 2 } } } } },
+                                    [](const std::error_code&) { });
+    for (const auto& callback : callbacks)
+        callback();
+    callbacks.clear();
+
+    Statistics statistics;
+    asyncStorageImpl->getStatisticsAsync([&statistics](const Statistics& snapshot) { statistics = snapshot; });
+    ASSERT_EQ(1U, callbacks.size());
+    callbacks.front()();
+    ASSERT_EQ(2U, statistics.getNamespaces().size());
+    EXPECT_EQ(1U, statistics.getNamespaces().at(ns).at(Statistics::OperationType::SET_BATCH).count);
+    EXPECT_EQ(4U, statistics.getNamespaces().at(ns).at(Statistics::OperationType::SET_BATCH).bytesSent);
+    EXPECT_EQ(1U, statistics.getNamespaces().at(anotherNs).at(Statistics::OperationType::SET_BATCH).count);
+    EXPECT_EQ(3U, statistics.getNamespaces().at(anotherNs).at(Statistics::OperationType::SET_BATCH).bytesSent);
+}
+
+TEST_F(AsyncStorageImplTest, OperationsAreNotCountedWhenStatisticsAreDisabled)
+{
+    statisticsConfiguration.enabled = false;
+    createAsyncStorageImpl();
+    std::vector<Engine::Callback> callbacks;
+    EXPECT_CALL(*engineMock, postCallback(_))
+        .WillRepeatedly(AppendMovedArg<0>(&callbacks));
+    EXPECT_CALL(*namespaceConfigurationsMock, isDbBackendUseEnabled(ns))
+        .WillRepeatedly(Return(false));
+    int acks(0);
+    asyncStorageImpl->setAsync(ns, { { "key", { 1, 2, 3 } } }, [&acks](const std::error_code&) { ++acks; });
+    for (const auto& callback : callbacks)
+        callback();
+    EXPECT_EQ(1, acks);
+    Mock::VerifyAndClearExpectations(engineMock.get());
+    EXPECT_TRUE(getStatistics().getNamespaces().empty());
+}
+
+TEST_F(AsyncStorageImplTest, OperationsWithInvalidNamespaceAreNotCounted)
+{
+    const AsyncStorage::Namespace invalidNs("invalid{namespace}");
+    EXPECT_CALL(*namespaceConfigurationsMock, isDbBackendUseEnabled(invalidNs))
+        .WillOnce(Return(false));
+    EXPECT_CALL(*engineMock, postCallback(_))
+        .Times(1);
+    asyncStorageImpl->setAsync(invalidNs, { { "key", { 1, 2, 3 } } }, [](const std::error_code&) { });
+    Mock::VerifyAndClearExpectations(engineMock.get());
+    EXPECT_TRUE(getStatistics().getNamespaces().empty());
+}
+
+TEST_F(AsyncStorageImplTest, DummyHandlerUsesEngineOfItsOwnInstance)
+{
+    expectNamespaceConfigurationIsDbBackendUseEnabled_returnFalse();
+    expectPostCallback();
+    asyncStorageImpl->waitReadyAsync(ns, [](const std::error_code&) { });
+}
+
 TEST_F(AsyncStorageImplTest, CorrectSdlClusterHandlerIsUsedBasedOnConfiguration)
 {
     expectNamespaceConfigurationIsDbBackendUseEnabled_returnTrue();
@@ -152,3 +264,50 @@ TEST_F(AsyncStorageImplTest, CorrectSdlClusterHandlerIsUsedBasedOnConfiguration)
     AsyncStorage& returnedHandler = asyncStorageImpl->getOperationHandler(ns);
     EXPECT_EQ(typeid(AsyncRedisStorage&), typeid(returnedHandler));
 }
+
+TEST_F(AsyncStorageImplTest, EmptyBatchesAreAckedThroughEngine)
+{
+    InSequence dummy;
+    int acks(0);
+    EXPECT_CALL(*engineMock, postCallback(_))
+        .Times(1)
+        .WillOnce(SaveMovedArg<0>(&storedCallback));
+    asyncStorageImpl->getBatchAsync({ }, [&acks](const std::error_code& error, const AsyncStorage::NamespaceDataMaps& namespaceDataMaps)
+                                         {
+                                             EXPECT_FALSE(error);
+                                             EXPECT_TRUE(namespaceDataMaps.empty());
+                                             ++acks;
+                                         });
+    storedCallback();
+    EXPECT_CALL(*engineMock, postCallback(_))
+        .Times(1)
+        .WillOnce(SaveMovedArg<0>(&storedCallback));
+    asyncStorageImpl->setBatchAsync({ }, [&acks](const std::error_code& error)
+                                         {
+                                             EXPECT_FALSE(error);
+                                             ++acks;
+                                         });
+    storedCallback();
+    EXPECT_EQ(2, acks);
+}
+
+TEST_F(AsyncStorageImplTest, BatchOfNamespacesServedBySameHandlerIsGivenToItAsOneBatch)
+{
+    const AsyncStorage::Namespace anotherNs("anotherKnownNamespace");
+    EXPECT_CALL(*namespaceConfigurationsMock, isDbBackendUseEnabled(_))
+        .WillRepeatedly(Return(true));
+    std::vector<Engine::Callback> callbacks;
+    EXPECT_CALL(*engineMock, postCallback(_))
+        .Times(2)
+        .WillRepeatedly(AppendMovedArg<0>(&callbacks));
+    std::vector<std::error_code> errors;
+    asyncStorageImpl->getBatchAsync({ { ns, { "key" } }, { anotherNs, { "key" } } },
+                                    [&errors](const std::error_code& error, const AsyncStorage::NamespaceDataMaps&)
+                                    {
+                                        errors.push_back(error);
+                                    });
+    for (const auto& callback : callbacks)
+        callback();
+    ASSERT_EQ(1U, errors.size());
+    EXPECT_EQ(std::error_code(AsyncRedisStorage::ErrorCode::REDIS_NOT_YET_DISCOVERED), errors.front());
+}
@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <gtest/gtest.h>
+#include "private/redis/commandcbslab.hpp"
+#include "private/redis/asyncredisreply.hpp"
+
+using namespace shareddatalayer;
+using namespace shareddatalayer::redis;
+using namespace testing;
+
+namespace
+{
+    class CommandCbSlabTest: public testing::Test
+    {
+    public:
+        CommandCbSlab slab;
+        int calls;
+
+        CommandCbSlabTest():
+            calls(0)
+        {
+        }
+
+        CommandCbSlab::CommandCb getCommandCb()
+        {
+            return [this](const std::error_code&, const Reply&) { ++calls; };
+        }
+    };
+}
+
+TEST_F(CommandCbSlabTest, IsEmptyAfterCreation)
+{
+    EXPECT_EQ(0U, slab.size());
+    EXPECT_EQ(nullptr, slab.find(nullptr));
+}
+
+TEST_F(CommandCbSlabTest, AddedCallbackCanBeFound)
+{
+    auto handle(slab.add(getCommandCb()));
+    EXPECT_NE(nullptr, handle);
+    EXPECT_EQ(1U, slab.size());
+    auto commandCb(slab.find(handle));
+    ASSERT_NE(nullptr, commandCb);
+    (*commandCb)(std::error_code(), AsyncRedisReply());
+    EXPECT_EQ(1, calls);
+}
+
+TEST_F(CommandCbSlabTest, RemovedCallbackCannotBeFound)
+{
+    auto handle(slab.add(getCommandCb()));
+    slab.remove(handle);
+    EXPECT_EQ(0U, slab.size());
+    EXPECT_EQ(nullptr, slab.find(handle));
+}
+
+TEST_F(CommandCbSlabTest, RemovingRemovedCallbackDoesNothing)
+{
+    auto handle(slab.add(getCommandCb()));
+    auto handle2(slab.add(getCommandCb()));
+    slab.remove(handle);
+    slab.remove(handle);
+    EXPECT_EQ(1U, slab.size());
+    EXPECT_NE(nullptr, slab.find(handle2));
+}
+
+TEST_F(CommandCbSlabTest, SlotIsReusedWithNewGeneration)
+{
+    auto handle(slab.add(getCommandCb()));
+    slab.remove(handle);
+    auto handle2(slab.add(getCommandCb()));
+    EXPECT_NE(handle, handle2);
+    EXPECT_EQ(nullptr, slab.find(handle));
+    EXPECT_NE(nullptr, slab.find(handle2));
+}
+
+TEST_F(CommandCbSlabTest, UnknownHandleIsNotFound)
+{
+    auto handle(slab.add(getCommandCb()));
+    auto unknown(reinterpret_cast<CommandCbSlab::Handle>(reinterpret_cast<uintptr_t>(handle) << 4));
+    EXPECT_EQ(nullptr, slab.find(unknown));
+}
+
+TEST_F(CommandCbSlabTest, CallbackReferencesRemainValidWhenCallbacksAreAdded)
+{
+    auto handle(slab.add(getCommandCb()));
+    auto commandCb(slab.find(handle));
+    for (int i(0); i < 1000; ++i)
+        slab.add(getCommandCb());
+    EXPECT_EQ(commandCb, slab.find(handle));
+    (*commandCb)(std::error_code(), AsyncRedisReply());
+    EXPECT_EQ(1, calls);
+}
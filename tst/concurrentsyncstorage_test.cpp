@@ -0,0 +1,267 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "private/concurrentsyncstorage.hpp"
+#include "private/error.hpp"
+#include "private/redis/asyncredisstorage.hpp"
+#include "private/tst/asyncstoragemock.hpp"
+#include "private/tst/systemmock.hpp"
+#include <sdl/backenderror.hpp>
+#include <sdl/rejectedbysdl.hpp>
+
+using namespace shareddatalayer;
+using namespace shareddatalayer::redis;
+using namespace shareddatalayer::tst;
+using namespace testing;
+
+namespace
+{
+    class ConcurrentSyncStorageTest: public testing::Test
+    {
+    public:
+        std::unique_ptr<ConcurrentSyncStorage> syncStorage;
+        /* AsyncStorageMock ownership is passed to the implementation, raw pointer is kept for
+         * setting expectations. The implementation keeps the mock alive until the test ends.
+         */
+        std::unique_ptr<StrictMock<AsyncStorageMock>> asyncStorageMockPassedToImplementation;
+        StrictMock<AsyncStorageMock>* asyncStorageMockRawPtr;
+        StrictMock<SystemMock> systemMock;
+        AsyncStorage::ReadyAck savedReadyAck;
+        AsyncStorage::ModifyAck savedModifyAck;
+        AsyncStorage::ModifyIfAck savedModifyIfAck;
+        AsyncStorage::GetAck savedGetAck;
+        AsyncStorage::FindKeysAck savedFindKeysAck;
+        int pFd;
+        SyncStorage::DataMap dataMap;
+        SyncStorage::Keys keys;
+        const SyncStorage::Namespace ns;
+
+        ConcurrentSyncStorageTest():
+            asyncStorageMockPassedToImplementation(new StrictMock<AsyncStorageMock>()),
+            asyncStorageMockRawPtr(asyncStorageMockPassedToImplementation.get()),
+            pFd(10),
+            dataMap({{ "key1", { 0x0a, 0x0b, 0x0c } }, { "key2", { 0x0d, 0x0e, 0x0f, 0xff } }}),
+            keys({ "key1", "key2" }),
+            ns("someKnownNamespace")
+        {
+            EXPECT_CALL(*asyncStorageMockRawPtr, fd())
+                .WillRepeatedly(Return(pFd));
+            syncStorage.reset(new ConcurrentSyncStorage(std::move(asyncStorageMockPassedToImplementation), systemMock));
+        }
+
+        void expectPollWait(int timeout)
+        {
+            EXPECT_CALL(systemMock, poll(_, 1, timeout))
+                .Times(1)
+                .WillOnce(Invoke([this](struct pollfd* fds, nfds_t, int)
+                                 {
+                                     EXPECT_EQ(pFd, fds->fd);
+                                     fds->revents = POLLIN;
+                                     return 1;
+                                 }));
+        }
+
+        void expectWaitReadyAsync()
+        {
+            EXPECT_CALL(*asyncStorageMockRawPtr, waitReadyAsync(ns, _))
+                .Times(1)
+                .WillOnce(SaveArg<1>(&savedReadyAck));
+        }
+
+        void expectSdlReadinessCheck()
+        {
+            expectWaitReadyAsync();
+            expectPollWait(ConcurrentSyncStorage::NO_TIMEOUT);
+            expectHandleEvents([this]() { savedReadyAck(std::error_code()); });
+        }
+
+        void expectHandleEvents(const std::function<void()>& action)
+        {
+            EXPECT_CALL(*asyncStorageMockRawPtr, handleEvents())
+                .Times(1)
+                .WillOnce(Invoke(action));
+        }
+    };
+}
+
+TEST_F(ConcurrentSyncStorageTest, IsNotCopyable)
+{
+    EXPECT_FALSE(std::is_copy_constructible<ConcurrentSyncStorage>::value);
+    EXPECT_FALSE(std::is_copy_assignable<ConcurrentSyncStorage>::value);
+}
+
+TEST_F(ConcurrentSyncStorageTest, ImplementsSyncStorage)
+{
+    EXPECT_TRUE((std::is_base_of<SyncStorage, ConcurrentSyncStorage>::value));
+}
+
+TEST_F(ConcurrentSyncStorageTest, SetSuccessfully)
+{
+    InSequence dummy;
+    expectSdlReadinessCheck();
+    EXPECT_CALL(*asyncStorageMockRawPtr, setAsync(ns, dataMap, _))
+        .Times(1)
+        .WillOnce(SaveArg<2>(&savedModifyAck));
+    expectPollWait(ConcurrentSyncStorage::NO_TIMEOUT);
+    expectHandleEvents([this]() { savedModifyAck(std::error_code()); });
+    syncStorage->set(ns, dataMap);
+}
+
+TEST_F(ConcurrentSyncStorageTest, SetCanThrowBackendError)
+{
+    InSequence dummy;
+    expectSdlReadinessCheck();
+    EXPECT_CALL(*asyncStorageMockRawPtr, setAsync(ns, dataMap, _))
+        .Times(1)
+        .WillOnce(SaveArg<2>(&savedModifyAck));
+    expectPollWait(ConcurrentSyncStorage::NO_TIMEOUT);
+    expectHandleEvents([this]() { savedModifyAck(AsyncRedisCommandDispatcherErrorCode::OUT_OF_MEMORY); });
+    EXPECT_THROW(syncStorage->set(ns, dataMap), BackendError);
+}
+
+TEST_F(ConcurrentSyncStorageTest, SetIfReturnsStatus)
+{
+    InSequence dummy;
+    expectSdlReadinessCheck();
+    EXPECT_CALL(*asyncStorageMockRawPtr, setIfAsync(ns, "key1", SyncStorage::Data({ 0x0a }), SyncStorage::Data({ 0x0b }), _))
+        .Times(1)
+        .WillOnce(SaveArg<4>(&savedModifyIfAck));
+    expectPollWait(ConcurrentSyncStorage::NO_TIMEOUT);
+    expectHandleEvents([this]() { savedModifyIfAck(std::error_code(), true); });
+    EXPECT_TRUE(syncStorage->setIf(ns, "key1", { 0x0a }, { 0x0b }));
+}
+
+TEST_F(ConcurrentSyncStorageTest, GetReturnsDataMap)
+{
+    InSequence dummy;
+    expectSdlReadinessCheck();
+    EXPECT_CALL(*asyncStorageMockRawPtr, getAsync(ns, keys, _))
+        .Times(1)
+        .WillOnce(SaveArg<2>(&savedGetAck));
+    expectPollWait(ConcurrentSyncStorage::NO_TIMEOUT);
+    expectHandleEvents([this]() { savedGetAck(std::error_code(), dataMap); });
+    EXPECT_EQ(dataMap, syncStorage->get(ns, keys));
+}
+
+TEST_F(ConcurrentSyncStorageTest, FindKeysReturnsKeys)
+{
+    InSequence dummy;
+    expectSdlReadinessCheck();
+    EXPECT_CALL(*asyncStorageMockRawPtr, findKeysAsync(ns, "key", _))
+        .Times(1)
+        .WillOnce(SaveArg<2>(&savedFindKeysAck));
+    expectPollWait(ConcurrentSyncStorage::NO_TIMEOUT);
+    expectHandleEvents([this]() { savedFindKeysAck(std::error_code(), keys); });
+    EXPECT_EQ(keys, syncStorage->findKeys(ns, "key"));
+}
+
+TEST_F(ConcurrentSyncStorageTest, WriteBatchReturnsStatuses)
+{
+    InSequence dummy;
+    AsyncStorage::WriteBatchAck savedWriteBatchAck;
+    expectSdlReadinessCheck();
+    EXPECT_CALL(*asyncStorageMockRawPtr, writeBatchAsync(ns, _, _))
+        .Times(1)
+        .WillOnce(SaveArg<2>(&savedWriteBatchAck));
+    expectPollWait(ConcurrentSyncStorage::NO_TIMEOUT);
+    expectHandleEvents([&savedWriteBatchAck]() { savedWriteBatchAck(std::error_code(), { true, false }); });
+    EXPECT_EQ(std::vector<bool>({ true, false }),
+              syncStorage->writeBatch(ns, WriteBatch().set(dataMap).setIfNotExists("key1", { 0x0a })));
+}
+
+TEST_F(ConcurrentSyncStorageTest, EventsAreHandledUntilOwnOperationCompletes)
+{
+    InSequence dummy;
+    expectSdlReadinessCheck();
+    EXPECT_CALL(*asyncStorageMockRawPtr, removeAsync(ns, keys, _))
+        .Times(1)
+        .WillOnce(SaveArg<2>(&savedModifyAck));
+    expectPollWait(ConcurrentSyncStorage::NO_TIMEOUT);
+    expectHandleEvents([]() { });
+    expectPollWait(ConcurrentSyncStorage::NO_TIMEOUT);
+    expectHandleEvents([this]() { savedModifyAck(std::error_code()); });
+    syncStorage->remove(ns, keys);
+}
+
+TEST_F(ConcurrentSyncStorageTest, WaitReadyThrowsRejectedBySdlWhenTimeoutExpires)
+{
+    expectWaitReadyAsync();
+    EXPECT_CALL(systemMock, poll(_, 1, _))
+        .WillRepeatedly(Return(0));
+    EXPECT_THROW(syncStorage->waitReady(ns, std::chrono::milliseconds(1)), RejectedBySdl);
+}
+
+TEST_F(ConcurrentSyncStorageTest, SetOperationTimeoutIsForwardedToAsyncStorage)
+{
+    EXPECT_CALL(*asyncStorageMockRawPtr, setOperationTimeout(std::chrono::steady_clock::duration(std::chrono::seconds(1))))
+        .Times(1);
+    syncStorage->setOperationTimeout(std::chrono::seconds(1));
+}
+
+TEST_F(ConcurrentSyncStorageTest, OperationsOfSeveralThreadsArePendingAtTheSameTime)
+{
+    const int threadCount(4);
+    std::atomic<int> issued(0);
+    std::vector<AsyncStorage::ModifyAck> pendingAcks;
+    EXPECT_CALL(*asyncStorageMockRawPtr, waitReadyAsync(ns, _))
+        .Times(threadCount)
+        .WillRepeatedly(Invoke([](const AsyncStorage::Namespace&, const AsyncStorage::ReadyAck& readyAck)
+                               {
+                                   readyAck(std::error_code());
+                               }));
+    EXPECT_CALL(*asyncStorageMockRawPtr, setAsync(ns, dataMap, _))
+        .Times(threadCount)
+        .WillRepeatedly(Invoke([&issued, &pendingAcks](const AsyncStorage::Namespace&,
+                                                       const AsyncStorage::DataMap&,
+                                                       const AsyncStorage::ModifyAck& modifyAck)
+                               {
+                                   pendingAcks.push_back(modifyAck);
+                                   ++issued;
+                               }));
+    /* Events become available only after all threads have issued their operation, thus the
+     * test passes only if no thread blocks the others while waiting for its own reply.
+     */
+    EXPECT_CALL(systemMock, poll(_, 1, ConcurrentSyncStorage::NO_TIMEOUT))
+        .WillRepeatedly(Invoke([&issued, threadCount](struct pollfd* fds, nfds_t, int)
+                               {
+                                   while (issued < threadCount)
+                                       std::this_thread::yield();
+                                   fds->revents = POLLIN;
+                                   return 1;
+                               }));
+    EXPECT_CALL(*asyncStorageMockRawPtr, handleEvents())
+        .WillRepeatedly(Invoke([&pendingAcks]()
+                               {
+                                   for (const auto& ack : pendingAcks)
+                                       ack(std::error_code());
+                                   pendingAcks.clear();
+                               }));
+    std::vector<std::thread> threads;
+    for (int i(0); i < threadCount; ++i)
+        threads.emplace_back([this]() { syncStorage->set(ns, dataMap); });
+    for (auto& thread : threads)
+        thread.join();
+    EXPECT_EQ(threadCount, issued);
+}
@@ -25,6 +25,8 @@
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
 #include "private/configurationreader.hpp"
+#include "private/slowoperationlog.hpp"
+#include "private/statisticscollector.hpp"
 #include "private/createlogger.hpp"
 #include "private/logger.hpp"
 #include "private/tst/databaseconfigurationmock.hpp"
@@ -108,11 +110,12 @@ namespace
         }
 
         void expectAddNamespaceConfiguration(const std::string&  namespacePrefix, bool useDbBackend,
-                                             bool enableNotifications)
+                                             bool enableNotifications, std::size_t nearCacheSize = 0)
         {
             NamespaceConfiguration expectedNamespaceConfiguration{namespacePrefix, useDbBackend,
                                                                   enableNotifications,
-                                                                  someKnownInputSource};
+                                                                  someKnownInputSource,
+                                                                  nearCacheSize};
             EXPECT_CALL(namespaceConfigurationsMock, addNamespaceConfiguration(expectedNamespaceConfiguration));
         }
 
@@ -122,6 +125,18 @@ namespace
                 .WillOnce(Return(returnValue));
         }
 
+        void expectGetSlowOperationThresholdEnvironmentString(const char* returnValue)
+        {
+            EXPECT_CALL(systemMock, getenv(StrEq(SLOW_OPERATION_THRESHOLD_ENV_VAR_NAME)))
+                .WillOnce(Return(returnValue));
+        }
+
+        void expectGetStatisticsEnabledEnvironmentString(const char* returnValue)
+        {
+            EXPECT_CALL(systemMock, getenv(StrEq(STATISTICS_ENABLED_ENV_VAR_NAME)))
+                .WillOnce(Return(returnValue));
+        }
+
         void initializeReaderWithoutDirectories()
         {
             configurationReader.reset(new ConfigurationReader(noDirectories, systemMock, logger));
@@ -306,6 +321,27 @@ namespace
             }, Exception);
         }
 
+        void readConfigurationAndExpectNearCacheSizeValidationException(const std::istringstream& is,
+                                                                        const std::string& error)
+        {
+            std::ostringstream os;
+            os << "Configuration error in " << someKnownInputSource << ": "
+               << "\"nearCacheSize\" " << error;
+
+            EXPECT_THROW( {
+                try
+                {
+                    configurationReader->readConfigurationFromInputStream(is);
+                    configurationReader->readNamespaceConfigurations(namespaceConfigurationsMock);
+                }
+                catch (const std::exception& e)
+                {
+                    EXPECT_EQ(os.str(), e.what() );
+                    throw;
+                }
+            }, Exception);
+        }
+
     };
 }
 
@@ -727,6 +763,289 @@ TEST_F(ConfigurationReaderInputStreamTest, CanThrowValidationErrorForEnableNotif
     readConfigurationAndExpectEnableNotificationsValidationException(is);
 }
 
+TEST_F(ConfigurationReaderInputStreamTest, CanReadJSONNearCacheSize)
+{
+    InSequence dummy;
+    std::istringstream is(R"JSON(
+        {
+            "sharedDataLayer":
+            [
+                {
+                    "namespacePrefix": "someKnownNamespacePrefix",
+                    "useDbBackend": true,
+                    "enableNotifications": true,
+                    "nearCacheSize": 1000
+                }
+            ]
+        })JSON");
+
+    expectAddNamespaceConfiguration("someKnownNamespacePrefix", true, true, 1000);
+    configurationReader->readConfigurationFromInputStream(is);
+    configurationReader->readNamespaceConfigurations(namespaceConfigurationsMock);
+}
+
+TEST_F(ConfigurationReaderInputStreamTest, CanCatchAndThrowParameterNearCacheSizeBadValue)
+{
+    InSequence dummy;
+    std::istringstream is(R"JSON(
+        {
+            "sharedDataLayer":
+            [
+                {
+                    "namespacePrefix": "someKnownNamespacePrefix",
+                    "useDbBackend": true,
+                    "enableNotifications": true,
+                    "nearCacheSize": "bad-value"
+                }
+            ]
+        })JSON");
+
+    readConfigurationAndExpectBadValueException(is, "nearCacheSize");
+}
+
+TEST_F(ConfigurationReaderInputStreamTest, CanThrowValidationErrorForNearCacheSizeWithNoNotifications)
+{
+    InSequence dummy;
+    std::istringstream is(R"JSON(
+        {
+            "sharedDataLayer":
+            [
+                {
+                    "namespacePrefix": "someKnownNamespacePrefix",
+                    "useDbBackend": true,
+                    "enableNotifications": false,
+                    "nearCacheSize": 1000
+                }
+            ]
+        })JSON");
+
+    readConfigurationAndExpectNearCacheSizeValidationException(is, "cannot be set, when \"enableNotifications\" is false");
+}
+
+TEST_F(ConfigurationReaderInputStreamTest, CanThrowValidationErrorForNegativeNearCacheSize)
+{
+    InSequence dummy;
+    std::istringstream is(R"JSON(
+        {
+            "sharedDataLayer":
+            [
+                {
+                    "namespacePrefix": "someKnownNamespacePrefix",
+                    "useDbBackend": true,
+                    "enableNotifications": true,
+                    "nearCacheSize": -1
+                }
+            ]
+        })JSON");
+
+    readConfigurationAndExpectNearCacheSizeValidationException(is, "cannot be negative");
+}
+
+TEST_F(ConfigurationReaderInputStreamTest, SlowOperationLogIsNotEnabledByDefault)
+{
+    InSequence dummy;
+    std::istringstream is(R"JSON(
+        {
+        })JSON");
+
+    expectGetSlowOperationThresholdEnvironmentString(nullptr);
+    configurationReader->readConfigurationFromInputStream(is);
+    SlowOperationLogConfiguration slowOperationLogConfiguration;
+    configurationReader->readSlowOperationLogConfiguration(slowOperationLogConfiguration);
+    EXPECT_EQ(std::chrono::milliseconds::zero(), slowOperationLogConfiguration.threshold);
+    EXPECT_EQ(SlowOperationLogConfiguration().size, slowOperationLogConfiguration.size);
+}
+
+TEST_F(ConfigurationReaderInputStreamTest, CanReadJSONSlowOperationLogConfiguration)
+{
+    InSequence dummy;
+    std::istringstream is(R"JSON(
+        {
+            "slowOperationLog":
+            {
+                "thresholdMs": 50,
+                "size": 64
+            }
+        })JSON");
+
+    expectGetSlowOperationThresholdEnvironmentString(nullptr);
+    configurationReader->readConfigurationFromInputStream(is);
+    SlowOperationLogConfiguration slowOperationLogConfiguration;
+    configurationReader->readSlowOperationLogConfiguration(slowOperationLogConfiguration);
+    EXPECT_EQ(std::chrono::milliseconds(50), slowOperationLogConfiguration.threshold);
+    EXPECT_EQ(64U, slowOperationLogConfiguration.size);
+}
+
+TEST_F(ConfigurationReaderInputStreamTest, EnvironmentVariableOverridesJSONSlowOperationThreshold)
+{
+    InSequence dummy;
+    std::istringstream is(R"JSON(
+        {
+            "slowOperationLog":
+            {
+                "thresholdMs": 50,
+                "size": 64
+            }
+        })JSON");
+
+    expectGetSlowOperationThresholdEnvironmentString("20");
+    configurationReader->readConfigurationFromInputStream(is);
+    SlowOperationLogConfiguration slowOperationLogConfiguration;
+    configurationReader->readSlowOperationLogConfiguration(slowOperationLogConfiguration);
+    EXPECT_EQ(std::chrono::milliseconds(20), slowOperationLogConfiguration.threshold);
+    EXPECT_EQ(64U, slowOperationLogConfiguration.size);
+}
+
+TEST_F(ConfigurationReaderInputStreamTest, CanCatchAndThrowParameterSlowOperationThresholdBadValue)
+{
+    InSequence dummy;
+    std::istringstream is(R"JSON(
+        {
+            "slowOperationLog":
+            {
+                "thresholdMs": "bad-value"
+            }
+        })JSON");
+
+    configurationReader->readConfigurationFromInputStream(is);
+    SlowOperationLogConfiguration slowOperationLogConfiguration;
+    EXPECT_THROW(configurationReader->readSlowOperationLogConfiguration(slowOperationLogConfiguration), Exception);
+}
+
+TEST_F(ConfigurationReaderInputStreamTest, CanThrowValidationErrorForZeroSlowOperationLogSize)
+{
+    InSequence dummy;
+    std::istringstream is(R"JSON(
+        {
+            "slowOperationLog":
+            {
+                "thresholdMs": 50,
+                "size": 0
+            }
+        })JSON");
+
+    configurationReader->readConfigurationFromInputStream(is);
+    SlowOperationLogConfiguration slowOperationLogConfiguration;
+    EXPECT_THROW( {
+        try
+        {
+            configurationReader->readSlowOperationLogConfiguration(slowOperationLogConfiguration);
+        }
+        catch (const std::exception& e)
+        {
+            EXPECT_EQ("Configuration error in <istream>: \"size\" must be greater than 0", std::string(e.what()));
+            throw;
+        }
+    }, Exception);
+}
+
+TEST_F(ConfigurationReaderInputStreamTest, CanCatchAndThrowSlowOperationThresholdEnvironmentVariableBadValue)
+{
+    InSequence dummy;
+    expectGetSlowOperationThresholdEnvironmentString("-1");
+    SlowOperationLogConfiguration slowOperationLogConfiguration;
+    EXPECT_THROW( {
+        try
+        {
+            configurationReader->readSlowOperationLogConfiguration(slowOperationLogConfiguration);
+        }
+        catch (const std::exception& e)
+        {
+            EXPECT_EQ("Configuration error in " SLOW_OPERATION_THRESHOLD_ENV_VAR_NAME ": invalid threshold: \"-1\"",
+                      std::string(e.what()));
+            throw;
+        }
+    }, Exception);
+}
+
+TEST_F(ConfigurationReaderInputStreamTest, StatisticsAreNotEnabledByDefault)
+{
+    InSequence dummy;
+    std::istringstream is(R"JSON(
+        {
+        })JSON");
+
+    expectGetStatisticsEnabledEnvironmentString(nullptr);
+    configurationReader->readConfigurationFromInputStream(is);
+    StatisticsConfiguration statisticsConfiguration;
+    configurationReader->readStatisticsConfiguration(statisticsConfiguration);
+    EXPECT_FALSE(statisticsConfiguration.enabled);
+    EXPECT_EQ(StatisticsConfiguration().maxNamespaces, statisticsConfiguration.maxNamespaces);
+}
+
+TEST_F(ConfigurationReaderInputStreamTest, CanReadJSONStatisticsConfiguration)
+{
+    InSequence dummy;
+    std::istringstream is(R"JSON(
+        {
+            "statistics":
+            {
+                "enabled": true,
+                "maxNamespaces": 16
+            }
+        })JSON");
+
+    expectGetStatisticsEnabledEnvironmentString(nullptr);
+    configurationReader->readConfigurationFromInputStream(is);
+    StatisticsConfiguration statisticsConfiguration;
+    configurationReader->readStatisticsConfiguration(statisticsConfiguration);
+    EXPECT_TRUE(statisticsConfiguration.enabled);
+    EXPECT_EQ(16U, statisticsConfiguration.maxNamespaces);
+}
+
+TEST_F(ConfigurationReaderInputStreamTest, EnvironmentVariableOverridesJSONStatisticsEnabling)
+{
+    InSequence dummy;
+    std::istringstream is(R"JSON(
+        {
+            "statistics":
+            {
+                "enabled": true
+            }
+        })JSON");
+
+    expectGetStatisticsEnabledEnvironmentString("false");
+    configurationReader->readConfigurationFromInputStream(is);
+    StatisticsConfiguration statisticsConfiguration;
+    configurationReader->readStatisticsConfiguration(statisticsConfiguration);
+    EXPECT_FALSE(statisticsConfiguration.enabled);
+}
+
+TEST_F(ConfigurationReaderInputStreamTest, CanThrowValidationErrorForZeroMaxNamespaces)
+{
+    InSequence dummy;
+    std::istringstream is(R"JSON(
+        {
+            "statistics":
+            {
+                "enabled": true,
+                "maxNamespaces": 0
+            }
+        })JSON");
+
+    configurationReader->readConfigurationFromInputStream(is);
+    StatisticsConfiguration statisticsConfiguration;
+    EXPECT_THROW( {
+        try
+        {
+            configurationReader->readStatisticsConfiguration(statisticsConfiguration);
+        }
+        catch (const std::exception& e)
+        {
+            EXPECT_EQ("Configuration error in <istream>: \"maxNamespaces\" must be greater than 0", std::string(e.what()));
+            throw;
+        }
+    }, Exception);
+}
+
+TEST_F(ConfigurationReaderInputStreamTest, CanCatchAndThrowStatisticsEnabledEnvironmentVariableBadValue)
+{
+    InSequence dummy;
+    expectGetStatisticsEnabledEnvironmentString("yes");
+    StatisticsConfiguration statisticsConfiguration;
+    EXPECT_THROW(configurationReader->readStatisticsConfiguration(statisticsConfiguration), Exception);
+}
+
 TEST_F(ConfigurationReaderInputStreamTest, WillNotReadDatabaseConfigurationToNonEmptyContainer)
 {
     EXPECT_EXIT(tryToReadDatabaseConfigurationToNonEmptyContainer(),
@@ -20,6 +20,7 @@
 */
 
 #include <gtest/gtest.h>
+#include <string>
 #include "private/redis/contents.hpp"
 
 using namespace shareddatalayer::redis;
@@ -35,3 +36,10 @@ TEST(ContentsTest, CanCompareNotEqual)
     EXPECT_TRUE((Contents { { "a", "b" }, { 1, 2 } }) != (Contents { { "a", "bb" }, { 1, 2 } }));
     EXPECT_TRUE((Contents { { "a", "bb" }, { 1, 3 } }) != (Contents { { "a", "bb" }, { 1, 2 } }));
 }
+
+TEST(ContentsTest, ComparesArgumentBytesInsteadOfPointers)
+{
+    const std::string a("a");
+    const std::string bb("bb");
+    EXPECT_TRUE((Contents { { "a", "bb" }, { 1, 2 } }) == (Contents { { a.c_str(), bb.c_str() }, { 1, 2 } }));
+}
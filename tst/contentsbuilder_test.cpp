@@ -22,6 +22,7 @@
 #include <gtest/gtest.h>
 #include "private/redis/contentsbuilder.hpp"
 #include "private/redis/contents.hpp"
+#include "private/redis/script.hpp"
 
 using namespace shareddatalayer;
 using namespace shareddatalayer::redis;
@@ -61,9 +62,14 @@ namespace
             contentsBuilder.reset(new ContentsBuilder(nsKeySeparator));
         }
 
+        std::string argument(const Contents& contents, int pos)
+        {
+            return std::string(contents.stack[pos], contents.sizes[pos]);
+        }
+
         void expectStringInContents(Contents& contents, std::string& string, int pos)
         {
-            EXPECT_EQ(string, contents.stack[pos]);
+            EXPECT_EQ(string, argument(contents, pos));
             EXPECT_EQ(string.size(), contents.sizes[pos]);
         }
 
@@ -78,7 +84,7 @@ namespace
         void expectKeyInContents(Contents& contents, AsyncConnection::Key& key, int pos)
         {
             AsyncConnection::Key keyWithPrefix('{' + ns + '}' + nsKeySeparator + key);
-            EXPECT_EQ(keyWithPrefix, contents.stack[pos]);
+            EXPECT_EQ(keyWithPrefix, argument(contents, pos));
             EXPECT_EQ(keyWithPrefix.size(), contents.sizes[pos]);
         }
 
@@ -86,12 +92,12 @@ namespace
         {
             EXPECT_EQ(data.size(), contents.sizes[pos]);
             std::string dataAsString(data.begin(), data.end());
-            EXPECT_EQ(dataAsString, contents.stack[pos]);
+            EXPECT_EQ(dataAsString, argument(contents, pos));
         }
 
         void expectMessageInContents(Contents& contents, int pos)
         {
-            EXPECT_EQ(string2, contents.stack[pos]);
+            EXPECT_EQ(string2, argument(contents, pos));
             EXPECT_EQ(string2.size(), contents.sizes[pos]);
         }
 
@@ -130,6 +136,32 @@ TEST_F(ContentsBuilderTest, BuildWithStringString2AndString3)
     expectStringInContents(contents, string3, 2);
 }
 
+TEST_F(ContentsBuilderTest, BuildWithSixStrings)
+{
+    std::string string4("string4");
+    std::string string5("string5");
+    std::string string6("string6");
+    auto contents(contentsBuilder->build(string, string2, string3, string4, string5, string6));
+    EXPECT_EQ(size_t(6), contents.stack.size());
+    EXPECT_EQ(size_t(6), contents.sizes.size());
+    expectStringInContents(contents, string, 0);
+    expectStringInContents(contents, string2, 1);
+    expectStringInContents(contents, string3, 2);
+    expectStringInContents(contents, string4, 3);
+    expectStringInContents(contents, string5, 4);
+    expectStringInContents(contents, string6, 5);
+}
+
+TEST_F(ContentsBuilderTest, BuildWithStringAndStrings)
+{
+    auto contents(contentsBuilder->build(string, std::vector<std::string>({ string2, string3 })));
+    EXPECT_EQ(size_t(3), contents.stack.size());
+    EXPECT_EQ(size_t(3), contents.sizes.size());
+    expectStringInContents(contents, string, 0);
+    expectStringInContents(contents, string2, 1);
+    expectStringInContents(contents, string3, 2);
+}
+
 TEST_F(ContentsBuilderTest, BuildWithStringAndDataMap)
 {
     auto contents(contentsBuilder->build(string, ns, dataMap));
@@ -215,3 +247,85 @@ TEST_F(ContentsBuilderTest, BuildWithStringKeysAndTwoStrings)
     expectStringInContents(contents, string2, 3);
     expectStringInContents(contents, string3, 4);
 }
+
+TEST_F(ContentsBuilderTest, DataIsNotCopied)
+{
+    auto contents(contentsBuilder->build(string, ns, key, data, data2));
+    EXPECT_EQ(reinterpret_cast<const char*>(data.data()), contents.stack[2]);
+    EXPECT_EQ(reinterpret_cast<const char*>(data2.data()), contents.stack[3]);
+}
+
+TEST_F(ContentsBuilderTest, EmptyDataHasValidPointer)
+{
+    AsyncConnection::Data emptyData;
+    auto contents(contentsBuilder->build(string, ns, key, emptyData));
+    EXPECT_NE(nullptr, contents.stack[2]);
+    EXPECT_EQ(size_t(0), contents.sizes[2]);
+}
+
+TEST_F(ContentsBuilderTest, ArgumentsStayValidWhenStorageGrows)
+{
+    AsyncConnection::Keys manyKeys;
+    for (int i(0); i < 100; ++i)
+        manyKeys.insert("key" + std::to_string(i));
+    const std::string longString(1000, 'x');
+    auto contents(contentsBuilder->build(string, ns, manyKeys, longString, string3));
+    ASSERT_EQ(size_t(103), contents.stack.size());
+    expectStringInContents(contents, string, 0);
+    int pos(1);
+    for (auto i : manyKeys)
+        expectKeyInContents(contents, i, pos++);
+    EXPECT_EQ(longString, argument(contents, 101));
+    expectStringInContents(contents, string3, 102);
+}
+
+TEST_F(ContentsBuilderTest, CopiedContentsRemainValid)
+{
+    Contents copy;
+    {
+        auto contents(contentsBuilder->build(string, ns, keys));
+        copy = contents;
+    }
+    expectStringInContents(copy, string, 0);
+    expectKeysInContents(copy, 1);
+}
+
+TEST_F(ContentsBuilderTest, BuildScriptWithKeysAndArguments)
+{
+    const Script script("return 1");
+    std::string evalSha("EVALSHA");
+    std::string sha1(script.getSha1());
+    std::string numKeys("3");
+    auto contents(contentsBuilder->build(script, ns, { key, key2, key }, { string2, string3 }));
+    ASSERT_EQ(size_t(8), contents.stack.size());
+    expectStringInContents(contents, evalSha, 0);
+    expectStringInContents(contents, sha1, 1);
+    expectStringInContents(contents, numKeys, 2);
+    expectKeyInContents(contents, key, 3);
+    expectKeyInContents(contents, key2, 4);
+    expectKeyInContents(contents, key, 5);
+    expectStringInContents(contents, string2, 6);
+    expectStringInContents(contents, string3, 7);
+}
+
+TEST_F(ContentsBuilderTest, KeyArgumentsAreRecorded)
+{
+    auto contents(contentsBuilder->build(string, ns, dataMap, string2, string3));
+    EXPECT_EQ(size_t(1), contents.keyArguments.first);
+    EXPECT_EQ(size_t(2), contents.keyArguments.count);
+    EXPECT_EQ(size_t(2), contents.keyArguments.step);
+    contents = contentsBuilder->build(string, ns, keys, string2, string3);
+    EXPECT_EQ(size_t(1), contents.keyArguments.first);
+    EXPECT_EQ(size_t(2), contents.keyArguments.count);
+    EXPECT_EQ(size_t(1), contents.keyArguments.step);
+    contents = contentsBuilder->build(Script("return 1"), ns, { key, key2, key }, { string2 });
+    EXPECT_EQ(size_t(3), contents.keyArguments.first);
+    EXPECT_EQ(size_t(3), contents.keyArguments.count);
+    EXPECT_EQ(size_t(1), contents.keyArguments.step);
+}
+
+TEST_F(ContentsBuilderTest, StringsAreNotRecordedAsKeyArguments)
+{
+    auto contents(contentsBuilder->build(string, '{' + ns + '}' + nsKeySeparator + key));
+    EXPECT_EQ(size_t(0), contents.keyArguments.count);
+}
@@ -238,3 +238,39 @@ TEST_F(EngineImplTest, PendingEventsOfDeletedFileDescriptorAreForgotten)
                          }));
     services->handleEvents();
 }
+
+TEST_F(EngineImplTest, CallbackPostedWhileHandlingEventsIsExecutedInTheSameRoundWithoutWritingToEventFD)
+{
+    const int efd(400);
+    bool executed(false);
+    ON_CALL(systemMock, eventfd(_, _))
+        .WillByDefault(Return(efd));
+    services->postCallback([] () { });
+    addMonitoredFD(fd1, Engine::EVENT_IN, eventHandlerMock1);
+    EXPECT_CALL(systemMock, epoll_wait(epfd, NotNull(), 2, 0))
+        .WillOnce(Invoke([efd] (int, epoll_event* events, int, int) -> int
+                         {
+                             events[0].events = EPOLLIN;
+                             events[0].data.fd = efd;
+                             return 1;
+                         }))
+        .WillOnce(Invoke([this] (int, epoll_event* events, int, int) -> int
+                         {
+                             events[0].events = EPOLLIN;
+                             events[0].data.fd = fd1;
+                             return 1;
+                         }));
+    services->handleEvents();
+    EXPECT_CALL(eventHandlerMock1, handleEvents(Engine::EVENT_IN))
+        .Times(1)
+        .WillOnce(Invoke([this, &executed] (unsigned int)
+                         {
+                             services->postCallback([&executed] () { executed = true; });
+                         }));
+    EXPECT_CALL(systemMock, write(_, _, _))
+        .Times(0);
+    services->handleEvents();
+    EXPECT_TRUE(executed);
+    EXPECT_CALL(systemMock, close(efd))
+        .Times(1);
+}
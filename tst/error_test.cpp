@@ -96,6 +96,10 @@ TEST_F(ErrorCodesTest, AllAsyncRedisCommandDispatcherErrorCodesHaveCorrectDescri
                 ec = aec;
                 EXPECT_EQ("writing to slave", getErrorCodeMessage(ec));
                 break;
+            case AsyncRedisCommandDispatcherErrorCode::NO_SCRIPT:
+                ec = aec;
+                EXPECT_EQ("redis script not found from script cache", getErrorCodeMessage(ec));
+                break;
             case AsyncRedisCommandDispatcherErrorCode::END_MARKER:
                 ec = aec;
                 EXPECT_EQ("unsupported error code for message()", getErrorCodeMessage(ec));
@@ -154,6 +158,10 @@ TEST_F(ErrorCodesTest, AllAsyncRedisCommandDispatcherErrorCodesAreMappedToCorrec
                 ec = aec;
                 EXPECT_TRUE(ec == InternalError::BACKEND_ERROR);
                 break;
+            case AsyncRedisCommandDispatcherErrorCode::NO_SCRIPT:
+                ec = aec;
+                EXPECT_TRUE(ec == InternalError::BACKEND_ERROR);
+                break;
             case AsyncRedisCommandDispatcherErrorCode::END_MARKER:
                 ec = aec;
                 EXPECT_TRUE(ec == InternalError::SDL_ERROR_CODE_LOGIC_ERROR);
@@ -197,6 +205,8 @@ TEST_F(ErrorCodesTest, AllErrorCodeEnumsAreMappedToCorrectClientErrorCode)
     EXPECT_TRUE(ec == shareddatalayer::Error::NOT_CONNECTED);
     ec = AsyncRedisCommandDispatcherErrorCode::IO_ERROR;
     EXPECT_TRUE(ec == shareddatalayer::Error::BACKEND_FAILURE);
+    ec = AsyncRedisCommandDispatcherErrorCode::NO_SCRIPT;
+    EXPECT_TRUE(ec == shareddatalayer::Error::BACKEND_FAILURE);
     ec = AsyncRedisCommandDispatcherErrorCode::END_MARKER;
     EXPECT_TRUE(ec == shareddatalayer::Error::BACKEND_FAILURE);
 }
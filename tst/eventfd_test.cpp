@@ -22,6 +22,8 @@
 #include <type_traits>
 #include <memory>
 #include <cstdint>
+#include <thread>
+#include <vector>
 #include <sys/eventfd.h>
 #include <gmock/gmock.h>
 #include "private/eventfd.hpp"
@@ -80,9 +82,9 @@ namespace
                 .WillOnce(Return(sizeof(uint64_t)));
         }
 
-        void post(const EventFD::Callback& callback)
+        void post(EventFD::Callback callback)
         {
-            eventFD->post(callback);
+            eventFD->post(std::move(callback));
         }
 
         void post(int i)
@@ -108,6 +110,123 @@ TEST_F(EventFDTest, PostWritesToEventFD)
     post(1);
 }
 
+TEST_F(EventFDTest, BurstOfPostsWritesToEventFDOnlyOnce)
+{
+    expectWrite();
+    post(1);
+    post(2);
+    post(3);
+}
+
+TEST_F(EventFDTest, PostAfterHandleEventsWritesToEventFDAgain)
+{
+    expectWrite();
+    post(1);
+    expectRead();
+    EXPECT_CALL(*this, callback(1))
+        .Times(1);
+    savedEventHandler(Engine::EVENT_IN);
+    Mock::VerifyAndClear(&systemMock);
+    expectWrite();
+    post(2);
+}
+
+TEST_F(EventFDTest, PostsFromExecutedCallbacksWriteToEventFDOnceAfterAllCallbacksAreExecuted)
+{
+    int executed(0);
+    post([this, &executed] () { post(1); post(2); ++executed; });
+    post([this, &executed] () { post(3); ++executed; });
+    expectRead();
+    EXPECT_CALL(systemMock, write(efd, NotNull(), sizeof(uint64_t)))
+        .Times(1)
+        .WillOnce(Invoke([&executed] (int, const void*, size_t) -> ssize_t
+                         {
+                             EXPECT_EQ(2, executed);
+                             return sizeof(uint64_t);
+                         }));
+    EXPECT_CALL(*this, callback(_))
+        .Times(0);
+    savedEventHandler(Engine::EVENT_IN);
+}
+
+TEST_F(EventFDTest, PostsWhileHandlingEventsAreExecutedAtTheEndWithoutWritingToEventFD)
+{
+    EXPECT_CALL(systemMock, write(_, _, _))
+        .Times(0);
+    eventFD->beginEventHandling();
+    post([this] () { post(2); });
+    post(1);
+    InSequence dummy;
+    EXPECT_CALL(*this, callback(1))
+        .Times(1);
+    EXPECT_CALL(*this, callback(2))
+        .Times(1);
+    eventFD->endEventHandling();
+}
+
+TEST_F(EventFDTest, CallbacksPostingCallbacksEndlesslyWriteToEventFDAfterBoundedRounds)
+{
+    int executed(0);
+    std::function<void()> repost;
+    repost = [this, &executed, &repost] () { ++executed; post(repost); };
+    eventFD->beginEventHandling();
+    post(repost);
+    expectWrite();
+    eventFD->endEventHandling();
+    EXPECT_EQ(16, executed);
+}
+
+TEST_F(EventFDTest, CallbacksPostedFromOtherThreadsAreExecuted)
+{
+    const int callbacksPerThread(100);
+    std::vector<std::thread> threads;
+    for (int i(0); i < 4; ++i)
+        threads.emplace_back([this, callbacksPerThread] ()
+                             {
+                                 for (int j(0); j < callbacksPerThread; ++j)
+                                     post(j);
+                             });
+    for (auto& thread : threads)
+        thread.join();
+    for (int j(0); j < callbacksPerThread; ++j)
+        EXPECT_CALL(*this, callback(j))
+            .Times(4);
+    savedEventHandler(Engine::EVENT_IN);
+}
+
+TEST_F(EventFDTest, CallbacksPostedFromOtherThreadsDuringHandleEventsAreExecuted)
+{
+    const int callbacksPerThread(1000);
+    int executed(0);
+    std::vector<std::thread> threads;
+    for (int i(0); i < 4; ++i)
+        threads.emplace_back([this, callbacksPerThread, &executed] ()
+                             {
+                                 for (int j(0); j < callbacksPerThread; ++j)
+                                     post([&executed] () { ++executed; });
+                             });
+    while (executed < 4 * callbacksPerThread)
+        savedEventHandler(Engine::EVENT_IN);
+    for (auto& thread : threads)
+        thread.join();
+    EXPECT_EQ(4 * callbacksPerThread, executed);
+}
+
+TEST_F(EventFDTest, CallbacksExceedingInitialPoolAreExecutedInFIFOOrderInEachRound)
+{
+    for (int round(0); round < 2; ++round)
+    {
+        for (int i(0); i < 200; ++i)
+            post(i);
+        InSequence dummy;
+        for (int i(0); i < 200; ++i)
+            EXPECT_CALL(*this, callback(i))
+                .Times(1);
+        savedEventHandler(Engine::EVENT_IN);
+        Mock::VerifyAndClearExpectations(this);
+    }
+}
+
 TEST_F(EventFDTest, HandleEventsExecutesAllCallbacksInFIFOOrder)
 {
     post(1);
@@ -71,6 +71,14 @@ namespace
             EXPECT_CALL(engineMock, deleteMonitoredFD(fd))
                 .Times(1);
         }
+
+        void expectRedisBufferWrite(int ret, int done)
+        {
+            EXPECT_CALL(hiredisSystemMock, redisBufferWrite(&ac.c, _))
+                .Times(1)
+                .WillOnce(DoAll(SetArgPointee<1>(done),
+                                Return(ret)));
+        }
     };
 
     class HiredisEpollAdapterAttachedTest: public HiredisEpollAdapterTest
@@ -184,6 +192,74 @@ TEST_F(HiredisEpollAdapterAttachedTest, OutputEventIsSetOnce)
     ac.ev.addWrite(ac.ev.data);
 }
 
+TEST_F(HiredisEpollAdapterAttachedTest, OutputBufferIsFlushedDirectlyWhenConnected)
+{
+    InSequence dummy;
+    ac.c.flags |= REDIS_CONNECTED;
+    expectRedisBufferWrite(REDIS_OK, 1);
+    expectModifyMonitoredFD(ac.c.fd, EngineMock::EVENT_IN);
+    ac.ev.addWrite(ac.ev.data);
+    expectRedisBufferWrite(REDIS_OK, 1);
+    ac.ev.addWrite(ac.ev.data);
+    EXPECT_CALL(hiredisSystemMock, redisAsyncHandleWrite(&ac))
+        .Times(0);
+    savedEventHandler(EngineMock::EVENT_OUT);
+}
+
+TEST_F(HiredisEpollAdapterAttachedTest, OutputEventIsMonitoredIfOutputBufferCannotBeFullyFlushed)
+{
+    InSequence dummy;
+    ac.c.flags |= REDIS_CONNECTED;
+    expectRedisBufferWrite(REDIS_OK, 0);
+    expectModifyMonitoredFD(ac.c.fd, EngineMock::EVENT_OUT);
+    ac.ev.addWrite(ac.ev.data);
+    ac.ev.addWrite(ac.ev.data);
+    EXPECT_CALL(hiredisSystemMock, redisAsyncHandleWrite(&ac))
+        .Times(1);
+    savedEventHandler(EngineMock::EVENT_OUT);
+}
+
+TEST_F(HiredisEpollAdapterAttachedTest, OutputEventIsMonitoredIfFlushingOutputBufferFails)
+{
+    InSequence dummy;
+    ac.c.flags |= REDIS_CONNECTED;
+    expectRedisBufferWrite(REDIS_ERR, 0);
+    expectModifyMonitoredFD(ac.c.fd, EngineMock::EVENT_OUT);
+    ac.ev.addWrite(ac.ev.data);
+}
+
+TEST_F(HiredisEpollAdapterAttachedTest, CorkedOutputBufferIsFlushedOnceAtUncork)
+{
+    InSequence dummy;
+    ac.c.flags |= REDIS_CONNECTED;
+    adapter->cork();
+    adapter->cork();
+    ac.ev.addWrite(ac.ev.data);
+    ac.ev.addWrite(ac.ev.data);
+    adapter->uncork();
+    ac.ev.addWrite(ac.ev.data);
+    expectRedisBufferWrite(REDIS_OK, 1);
+    expectModifyMonitoredFD(ac.c.fd, EngineMock::EVENT_IN);
+    adapter->uncork();
+}
+
+TEST_F(HiredisEpollAdapterAttachedTest, UncorkWithoutCommandsDoesNotWrite)
+{
+    ac.c.flags |= REDIS_CONNECTED;
+    adapter->cork();
+    adapter->uncork();
+}
+
+TEST_F(HiredisEpollAdapterAttachedTest, UnchangedEventStateIsNotModified)
+{
+    InSequence dummy;
+    ac.ev.delWrite(ac.ev.data);
+    ac.ev.delRead(ac.ev.data);
+    expectModifyMonitoredFD(ac.c.fd, EngineMock::EVENT_IN);
+    ac.ev.addRead(ac.ev.data);
+    ac.ev.delWrite(ac.ev.data);
+}
+
 TEST_F(HiredisEpollAdapterAttachedTest, MakesCleanupIfDestructedWhileAttahced)
 {
     InSequence dummy;
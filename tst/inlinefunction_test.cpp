@@ -0,0 +1,225 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <gmock/gmock.h>
+#include "private/inlinefunction.hpp"
+
+using namespace shareddatalayer;
+using namespace testing;
+
+namespace
+{
+    using Function = InlineFunction<int(int), 64>;
+
+    class InstanceCounter
+    {
+    public:
+        explicit InstanceCounter(int& instances):
+            instances(instances)
+        {
+            ++instances;
+        }
+
+        InstanceCounter(const InstanceCounter& other):
+            instances(other.instances)
+        {
+            ++instances;
+        }
+
+        InstanceCounter(InstanceCounter&& other) noexcept:
+            instances(other.instances)
+        {
+            ++instances;
+        }
+
+        ~InstanceCounter()
+        {
+            --instances;
+        }
+
+        int operator () (int value) const
+        {
+            return value;
+        }
+
+        InstanceCounter& operator = (const InstanceCounter&) = delete;
+
+    private:
+        int& instances;
+    };
+
+    class BigCallable
+    {
+    public:
+        BigCallable():
+            data()
+        {
+        }
+
+        int operator () (int value) const
+        {
+            return value + static_cast<int>(data.size());
+        }
+
+    private:
+        std::array<char, 256> data;
+    };
+
+    class ThrowingMoveCallable
+    {
+    public:
+        ThrowingMoveCallable() = default;
+
+        ThrowingMoveCallable(ThrowingMoveCallable&&)
+        {
+        }
+
+        int operator () (int value) const
+        {
+            return value;
+        }
+    };
+
+    int twice(int value)
+    {
+        return 2 * value;
+    }
+}
+
+TEST(InlineFunctionTest, DefaultConstructedFunctionIsEmpty)
+{
+    Function function;
+    EXPECT_FALSE(function);
+    EXPECT_FALSE(Function(nullptr));
+    EXPECT_TRUE(function == nullptr);
+    EXPECT_FALSE(function != nullptr);
+}
+
+TEST(InlineFunctionTest, CallingEmptyFunctionThrows)
+{
+    Function function;
+    EXPECT_THROW(function(1), std::bad_function_call);
+}
+
+TEST(InlineFunctionTest, CanCallLambda)
+{
+    const int offset(3);
+    Function function([offset] (int value) { return value + offset; });
+    EXPECT_TRUE(function);
+    EXPECT_EQ(5, function(2));
+}
+
+TEST(InlineFunctionTest, CanCallFunctionPointer)
+{
+    Function function(&twice);
+    EXPECT_EQ(4, function(2));
+}
+
+TEST(InlineFunctionTest, CanCallBindExpression)
+{
+    Function function(std::bind(std::plus<int>(), std::placeholders::_1, 10));
+    EXPECT_EQ(12, function(2));
+}
+
+TEST(InlineFunctionTest, CanCallCallableWhichDoesNotFitInline)
+{
+    Function function((BigCallable()));
+    EXPECT_EQ(258, function(2));
+    Function moved(std::move(function));
+    EXPECT_FALSE(function);
+    EXPECT_EQ(258, moved(2));
+}
+
+TEST(InlineFunctionTest, TellsWhichCallablesAreStoredInline)
+{
+    EXPECT_TRUE(Function::isStoredInline<int (*)(int)>());
+    EXPECT_TRUE(Function::isStoredInline<InstanceCounter>());
+    EXPECT_FALSE(Function::isStoredInline<BigCallable>());
+    EXPECT_FALSE(Function::isStoredInline<ThrowingMoveCallable>());
+}
+
+TEST(InlineFunctionTest, NullFunctionPointerAndEmptyStdFunctionCreateEmptyFunction)
+{
+    int (*pointer)(int)(nullptr);
+    EXPECT_FALSE(Function(pointer));
+    EXPECT_FALSE(Function(std::function<int(int)>()));
+}
+
+TEST(InlineFunctionTest, IsNotCopyable)
+{
+    EXPECT_FALSE(std::is_copy_constructible<Function>::value);
+    EXPECT_FALSE(std::is_copy_assignable<Function>::value);
+}
+
+TEST(InlineFunctionTest, CanStoreMoveOnlyCallable)
+{
+    std::unique_ptr<int> pointer(new int(10));
+    Function function(std::bind([](const std::unique_ptr<int>& p, int value) { return *p + value; },
+                                std::move(pointer),
+                                std::placeholders::_1));
+    EXPECT_EQ(12, function(2));
+    Function moved(std::move(function));
+    EXPECT_EQ(13, moved(3));
+}
+
+TEST(InlineFunctionTest, MoveLeavesSourceEmpty)
+{
+    int instances(0);
+    Function function((InstanceCounter(instances)));
+    Function moved(std::move(function));
+    EXPECT_EQ(1, instances);
+    EXPECT_FALSE(function);
+    EXPECT_EQ(1, moved(1));
+}
+
+TEST(InlineFunctionTest, AssignmentDestroysPreviousCallable)
+{
+    int instances(0);
+    Function function((InstanceCounter(instances)));
+    function = &twice;
+    EXPECT_EQ(0, instances);
+    EXPECT_EQ(4, function(2));
+    function = nullptr;
+    EXPECT_FALSE(function);
+}
+
+TEST(InlineFunctionTest, DestructorDestroysCallable)
+{
+    int instances(0);
+    {
+        Function function((InstanceCounter(instances)));
+        EXPECT_EQ(1, instances);
+    }
+    EXPECT_EQ(0, instances);
+}
+
+TEST(InlineFunctionTest, ArgumentsArePassedByReference)
+{
+    InlineFunction<void(std::string&)> function([] (std::string& s) { s = "changed"; });
+    std::string s("original");
+    function(s);
+    EXPECT_EQ("changed", s);
+}
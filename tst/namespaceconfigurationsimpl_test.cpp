@@ -85,6 +85,24 @@ TEST_F(NamespaceConfigurationsImplTest, CanShowReadConfigurationDescription)
               namespaceConfigurationsImpl->getDescription(someKnownNamespace));
 }
 
+TEST_F(NamespaceConfigurationsImplTest, CanReturnNearCacheSize)
+{
+    namespaceConfigurationsImpl->addNamespaceConfiguration({"someKnownPrefix", true, true, someKnownInputSource, 100});
+    EXPECT_EQ(100U, namespaceConfigurationsImpl->getNearCacheSize(someKnownNamespace));
+    EXPECT_EQ(0U, namespaceConfigurationsImpl->getNearCacheSize("unknownNamespace"));
+    EXPECT_EQ("someKnownInputSource prefix: someKnownPrefix, useDbBackend: true, enableNotifications: true, nearCacheSize: 100",
+              namespaceConfigurationsImpl->getDescription(someKnownNamespace));
+}
+
+TEST_F(NamespaceConfigurationsImplTest, IsNearCacheUsedReturnsCorrectInformation)
+{
+    EXPECT_FALSE(namespaceConfigurationsImpl->isNearCacheUsed());
+    namespaceConfigurationsImpl->addNamespaceConfiguration({"someKnownPrefix", true, true, someKnownInputSource});
+    EXPECT_FALSE(namespaceConfigurationsImpl->isNearCacheUsed());
+    namespaceConfigurationsImpl->addNamespaceConfiguration({"anotherKnownPrefix", true, true, someKnownInputSource, 100});
+    EXPECT_TRUE(namespaceConfigurationsImpl->isNearCacheUsed());
+}
+
 TEST_F(NamespaceConfigurationsImplTest, CanShowDefaultValuesDescription)
 {
     EXPECT_EQ("<default>, useDbBackend: true, enableNotifications: false",
@@ -0,0 +1,133 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <gtest/gtest.h>
+#include "private/nearcache.hpp"
+
+using namespace shareddatalayer;
+using namespace testing;
+
+namespace
+{
+    class NearCacheTest: public testing::Test
+    {
+    public:
+        NearCache nearCache;
+        const NearCache::Data data1;
+        const NearCache::Data data2;
+
+        NearCacheTest():
+            nearCache(2),
+            data1({ 1, 2 }),
+            data2({ 3 })
+        {
+            nearCache.enable();
+        }
+
+        void insert(const NearCache::Key& key, const NearCache::Data& data)
+        {
+            nearCache.insert(key, data, nearCache.getGeneration());
+        }
+    };
+}
+
+TEST_F(NearCacheTest, InsertedDataIsFound)
+{
+    insert("key1", data1);
+    ASSERT_NE(nullptr, nearCache.find("key1"));
+    EXPECT_EQ(data1, *nearCache.find("key1"));
+    EXPECT_EQ(nullptr, nearCache.find("key2"));
+}
+
+TEST_F(NearCacheTest, InsertReplacesCachedData)
+{
+    insert("key1", data1);
+    insert("key1", data2);
+    EXPECT_EQ(data2, *nearCache.find("key1"));
+    EXPECT_EQ(1U, nearCache.size());
+}
+
+TEST_F(NearCacheTest, LeastRecentlyUsedEntryIsEvictedWhenFull)
+{
+    insert("key1", data1);
+    insert("key2", data1);
+    nearCache.find("key1");
+    insert("key3", data1);
+    EXPECT_EQ(2U, nearCache.size());
+    EXPECT_NE(nullptr, nearCache.find("key1"));
+    EXPECT_EQ(nullptr, nearCache.find("key2"));
+    EXPECT_NE(nullptr, nearCache.find("key3"));
+}
+
+TEST_F(NearCacheTest, InvalidatedKeysAreRemoved)
+{
+    insert("key1", data1);
+    insert("key2", data1);
+    nearCache.invalidate({ "key1", "unknown" });
+    EXPECT_EQ(nullptr, nearCache.find("key1"));
+    EXPECT_NE(nullptr, nearCache.find("key2"));
+}
+
+TEST_F(NearCacheTest, ClearRemovesAllKeys)
+{
+    insert("key1", data1);
+    insert("key2", data1);
+    nearCache.clear();
+    EXPECT_EQ(0U, nearCache.size());
+    EXPECT_EQ(nullptr, nearCache.find("key1"));
+}
+
+TEST_F(NearCacheTest, DataReadBeforeInvalidationIsNotInserted)
+{
+    const auto generation(nearCache.getGeneration());
+    nearCache.invalidate({ "key2" });
+    nearCache.insert("key1", data1, generation);
+    EXPECT_EQ(nullptr, nearCache.find("key1"));
+    nearCache.insert("key1", data1, nearCache.getGeneration());
+    EXPECT_NE(nullptr, nearCache.find("key1"));
+}
+
+TEST_F(NearCacheTest, DataReadBeforeEnablingIsNotInserted)
+{
+    nearCache.disable();
+    const auto generation(nearCache.getGeneration());
+    nearCache.enable();
+    nearCache.insert("key1", data1, generation);
+    EXPECT_EQ(nullptr, nearCache.find("key1"));
+}
+
+TEST_F(NearCacheTest, DisabledCacheIsClearedAndDoesNotCacheData)
+{
+    insert("key1", data1);
+    nearCache.disable();
+    EXPECT_FALSE(nearCache.isEnabled());
+    EXPECT_EQ(nullptr, nearCache.find("key1"));
+    insert("key1", data1);
+    EXPECT_EQ(0U, nearCache.size());
+}
+
+TEST(NearCacheWithoutEntriesTest, NothingIsCachedWithZeroSize)
+{
+    NearCache nearCache(0);
+    nearCache.enable();
+    nearCache.insert("key1", { 1 }, nearCache.getGeneration());
+    EXPECT_EQ(nullptr, nearCache.find("key1"));
+}
@@ -0,0 +1,131 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <functional>
+#include <string>
+#include <gmock/gmock.h>
+#include "private/operationdeadline.hpp"
+#include "private/tst/enginemock.hpp"
+
+using namespace shareddatalayer;
+using namespace shareddatalayer::tst;
+using namespace testing;
+
+namespace
+{
+    class OperationDeadlineTest: public testing::Test
+    {
+    public:
+        using Ack = std::function<void(const std::error_code&, const std::string&)>;
+        using Visitor = std::function<void(int)>;
+
+        StrictMock<EngineMock> engineMock;
+        Timer::Duration timeout;
+        Timer::Callback savedTimerCallback;
+        Ack ack;
+
+        OperationDeadlineTest():
+            timeout(std::chrono::seconds(5))
+        {
+            ack = std::bind(&OperationDeadlineTest::ackCallback, this, std::placeholders::_1, std::placeholders::_2);
+        }
+
+        Ack wrapWithDeadline()
+        {
+            EXPECT_CALL(engineMock, armTimer(_, timeout, _))
+                .Times(1)
+                .WillOnce(SaveArg<2>(&savedTimerCallback));
+            return OperationDeadline::create(engineMock, timeout)->wrap(ack,
+                                                                        std::error_code(ETIMEDOUT, std::generic_category()),
+                                                                        std::string("timeout"));
+        }
+
+        MOCK_METHOD2(ackCallback, void(const std::error_code& error, const std::string& value));
+
+        MOCK_METHOD1(visitorCallback, void(int value));
+    };
+}
+
+TEST_F(OperationDeadlineTest, AckIsCalledAndTimerIsDisarmedWhenOperationCompletesBeforeDeadline)
+{
+    const auto wrappedAck(wrapWithDeadline());
+    InSequence dummy;
+    EXPECT_CALL(engineMock, disarmTimer(_))
+        .Times(1);
+    EXPECT_CALL(*this, ackCallback(std::error_code(), "value"))
+        .Times(1);
+    wrappedAck(std::error_code(), "value");
+}
+
+TEST_F(OperationDeadlineTest, AckIsCalledOnlyOnceWhenOperationCompletesTwice)
+{
+    const auto wrappedAck(wrapWithDeadline());
+    EXPECT_CALL(engineMock, disarmTimer(_))
+        .Times(1);
+    EXPECT_CALL(*this, ackCallback(_, _))
+        .Times(1);
+    wrappedAck(std::error_code(), "value");
+    wrappedAck(std::error_code(), "value");
+}
+
+TEST_F(OperationDeadlineTest, AckIsCalledWithTimeoutArgumentsWhenDeadlineExpires)
+{
+    const auto wrappedAck(wrapWithDeadline());
+    EXPECT_CALL(*this, ackCallback(std::error_code(ETIMEDOUT, std::generic_category()), "timeout"))
+        .Times(1);
+    savedTimerCallback();
+    Mock::VerifyAndClearExpectations(this);
+    EXPECT_CALL(*this, ackCallback(_, _))
+        .Times(0);
+    wrappedAck(std::error_code(), "late reply");
+}
+
+TEST_F(OperationDeadlineTest, DestroyingDeadlineDisarmsTimer)
+{
+    /* The timer callback refers to the timer, so the timer must not expire after the deadline is gone. */
+    EXPECT_CALL(*this, ackCallback(_, _))
+        .Times(0);
+    {
+        const auto wrappedAck(wrapWithDeadline());
+        EXPECT_CALL(engineMock, disarmTimer(_))
+            .Times(1);
+    }
+    Mock::VerifyAndClearExpectations(&engineMock);
+}
+
+TEST_F(OperationDeadlineTest, GuardedFunctionIsCalledOnlyBeforeDeadlineExpires)
+{
+    EXPECT_CALL(engineMock, armTimer(_, timeout, _))
+        .Times(1)
+        .WillOnce(SaveArg<2>(&savedTimerCallback));
+    const auto deadline(OperationDeadline::create(engineMock, timeout));
+    const Visitor visitor(deadline->guard(Visitor(std::bind(&OperationDeadlineTest::visitorCallback, this, std::placeholders::_1))));
+    const auto wrappedAck(deadline->wrap(ack, std::error_code(ETIMEDOUT, std::generic_category()), std::string("timeout")));
+    EXPECT_CALL(*this, visitorCallback(1))
+        .Times(1);
+    visitor(1);
+    EXPECT_CALL(*this, ackCallback(_, "timeout"))
+        .Times(1);
+    savedTimerCallback();
+    EXPECT_CALL(*this, visitorCallback(_))
+        .Times(0);
+    visitor(2);
+}
@@ -0,0 +1,61 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <gtest/gtest.h>
+#include "private/redis/script.hpp"
+
+using namespace shareddatalayer::redis;
+
+TEST(ScriptTest, Sha1IsCalculatedFromSource)
+{
+    EXPECT_EQ("da39a3ee5e6b4b0d3255bfef95601890afd80709", Script::calculateSha1(""));
+    EXPECT_EQ("a9993e364706816aba3e25717850c26c9cd0d89d", Script::calculateSha1("abc"));
+    EXPECT_EQ("84983e441c3bd26ebaae4aa1f95129e5e54670f1",
+              Script::calculateSha1("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"));
+}
+
+TEST(ScriptTest, Sha1OfSourceLongerThanOneBlockIsCalculated)
+{
+    EXPECT_EQ("34aa973cd4c4daa4f61eeb2bdbad27316534016f", Script::calculateSha1(std::string(1000000, 'a')));
+}
+
+TEST(ScriptTest, Sha1IsCalculatedAtPaddingBoundaries)
+{
+    EXPECT_EQ("c1c8bbdc22796e28c0e15163d20899b65621d65a", Script::calculateSha1(std::string(55, 'a')));
+    EXPECT_EQ("c2db330f6083854c99d4b5bfb6e8f29f201be699", Script::calculateSha1(std::string(56, 'a')));
+    EXPECT_EQ("03f09f5b158a7a8cdad920bddc29b81c18a551f5", Script::calculateSha1(std::string(63, 'a')));
+    EXPECT_EQ("0098ba824b5c16427bd7a1122a5a442a25ec644d", Script::calculateSha1(std::string(64, 'a')));
+    EXPECT_EQ("11655326c708d70319be2610e8a57d9a5b959d3b", Script::calculateSha1(std::string(65, 'a')));
+}
+
+TEST(ScriptTest, SourceAndSha1CanBeQueried)
+{
+    const Script script("return 1");
+    EXPECT_EQ("return 1", script.getSource());
+    EXPECT_EQ("e0e1f9fabfc9d4800c877a703b823ac0578ff8db", script.getSha1());
+}
+
+TEST(ScriptTest, CopiesShareSource)
+{
+    const Script script("return 1");
+    const Script copy(script);
+    EXPECT_EQ(&script.getSource(), &copy.getSource());
+}
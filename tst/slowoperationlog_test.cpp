@@ -0,0 +1,149 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include "private/slowoperationlog.hpp"
+
+using namespace shareddatalayer;
+using namespace testing;
+
+namespace
+{
+    class StringStreamLogger: public Logger
+    {
+    public:
+        std::ostringstream os;
+
+        std::ostream& emerg() override { return os; }
+        std::ostream& alert() override { return os; }
+        std::ostream& crit() override { return os; }
+        std::ostream& error() override { return os; }
+        std::ostream& warning() override { return os; }
+        std::ostream& notice() override { return os; }
+        std::ostream& info() override { return os; }
+        std::ostream& debug() override { return os; }
+    };
+
+    class SlowOperationLogTest: public testing::Test
+    {
+    public:
+        std::shared_ptr<StringStreamLogger> logger;
+        SlowOperationLogConfiguration configuration;
+        std::unique_ptr<SlowOperationLog> slowOperationLog;
+        std::chrono::steady_clock::time_point now;
+
+        SlowOperationLogTest():
+            logger(std::make_shared<StringStreamLogger>()),
+            now(std::chrono::steady_clock::now())
+        {
+            configuration.threshold = std::chrono::milliseconds(10);
+            configuration.size = 3;
+            slowOperationLog.reset(new SlowOperationLog(configuration,
+                                                        [](const std::string& ns) { return "connection-of-" + ns; },
+                                                        logger));
+        }
+
+        void add(const std::string& ns, const std::chrono::steady_clock::duration& latency)
+        {
+            slowOperationLog->add(ns, Statistics::OperationType::GET, 2, 100, latency, now);
+        }
+
+        std::vector<std::string> getLoggedLines() const
+        {
+            std::vector<std::string> lines;
+            std::istringstream is(logger->os.str());
+            std::string line;
+            while (std::getline(is, line))
+                lines.push_back(line);
+            return lines;
+        }
+    };
+}
+
+TEST_F(SlowOperationLogTest, IsNotCopyable)
+{
+    EXPECT_FALSE(std::is_copy_constructible<SlowOperationLog>::value);
+    EXPECT_FALSE(std::is_copy_assignable<SlowOperationLog>::value);
+}
+
+TEST_F(SlowOperationLogTest, OperationIsSlowIfLatencyIsAtLeastThreshold)
+{
+    EXPECT_FALSE(slowOperationLog->isSlow(std::chrono::microseconds(9999)));
+    EXPECT_TRUE(slowOperationLog->isSlow(std::chrono::milliseconds(10)));
+    EXPECT_TRUE(slowOperationLog->isSlow(std::chrono::seconds(1)));
+}
+
+TEST_F(SlowOperationLogTest, SlowOperationIsRecordedWithItsDetails)
+{
+    const auto before(std::chrono::system_clock::now());
+    add("ns", std::chrono::milliseconds(15));
+    const auto slowOperations(slowOperationLog->getSlowOperations());
+    ASSERT_EQ(1U, slowOperations.size());
+    const auto& slowOperation(slowOperations.front());
+    EXPECT_LE(before, slowOperation.time);
+    EXPECT_GE(std::chrono::system_clock::now(), slowOperation.time);
+    EXPECT_EQ("ns", slowOperation.ns);
+    EXPECT_EQ(Statistics::OperationType::GET, slowOperation.type);
+    EXPECT_EQ(2U, slowOperation.keyCount);
+    EXPECT_EQ(100U, slowOperation.bytes);
+    EXPECT_EQ("connection-of-ns", slowOperation.connection);
+    EXPECT_EQ(std::chrono::milliseconds(15), slowOperation.latency);
+}
+
+TEST_F(SlowOperationLogTest, OldestSlowOperationIsOverwrittenWhenRingIsFull)
+{
+    add("ns1", std::chrono::milliseconds(11));
+    add("ns2", std::chrono::milliseconds(12));
+    add("ns3", std::chrono::milliseconds(13));
+    add("ns4", std::chrono::milliseconds(14));
+    add("ns5", std::chrono::milliseconds(15));
+    const auto slowOperations(slowOperationLog->getSlowOperations());
+    ASSERT_EQ(3U, slowOperations.size());
+    EXPECT_EQ("ns3", slowOperations[0].ns);
+    EXPECT_EQ("ns4", slowOperations[1].ns);
+    EXPECT_EQ("ns5", slowOperations[2].ns);
+}
+
+TEST_F(SlowOperationLogTest, SlowOperationIsLoggedAsWarning)
+{
+    add("ns", std::chrono::milliseconds(15));
+    const auto lines(getLoggedLines());
+    ASSERT_EQ(1U, lines.size());
+    EXPECT_EQ("Slow operation: namespace: ns, operation: get, keys: 2, bytes: 100, "
+              "connection: connection-of-ns, latency: 15000 us", lines.front());
+}
+
+TEST_F(SlowOperationLogTest, AtMostOneWarningIsLoggedPerLogInterval)
+{
+    add("ns1", std::chrono::milliseconds(15));
+    now += SlowOperationLog::LOG_INTERVAL - std::chrono::nanoseconds(1);
+    add("ns2", std::chrono::milliseconds(15));
+    add("ns3", std::chrono::milliseconds(15));
+    EXPECT_EQ(1U, getLoggedLines().size());
+    now += std::chrono::nanoseconds(1);
+    add("ns4", std::chrono::milliseconds(15));
+    const auto lines(getLoggedLines());
+    ASSERT_EQ(2U, lines.size());
+    EXPECT_NE(std::string::npos, lines[1].find("namespace: ns4"));
+    EXPECT_NE(std::string::npos, lines[1].find("(2 slow operation(s) not logged)"));
+    EXPECT_EQ(3U, slowOperationLog->getSlowOperations().size());
+}
@@ -0,0 +1,118 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <gtest/gtest.h>
+#include <sdl/statistics.hpp>
+
+using namespace shareddatalayer;
+using namespace testing;
+
+namespace
+{
+    Statistics::OperationStatistics buildOperationStatistics()
+    {
+        Statistics::OperationStatistics operationStatistics;
+        operationStatistics.count = 3;
+        operationStatistics.errors = 1;
+        operationStatistics.bytesSent = 100;
+        operationStatistics.bytesReceived = 200;
+        operationStatistics.latencySum = std::chrono::microseconds(1500);
+        operationStatistics.latencyBuckets[0] = 1;
+        operationStatistics.latencyBuckets[2] = 1;
+        operationStatistics.latencyBuckets[Statistics::LATENCY_BUCKETS - 1] = 1;
+        return operationStatistics;
+    }
+}
+
+TEST(StatisticsTest, IsEmptyWhenCreated)
+{
+    EXPECT_TRUE(Statistics().getNamespaces().empty());
+    EXPECT_TRUE(Statistics().toPrometheusText().find("{") == std::string::npos);
+}
+
+TEST(StatisticsTest, OperationStatisticsAreZeroWhenCreated)
+{
+    const Statistics::OperationStatistics operationStatistics;
+    EXPECT_EQ(0U, operationStatistics.count);
+    EXPECT_EQ(0U, operationStatistics.errors);
+    EXPECT_EQ(0U, operationStatistics.bytesSent);
+    EXPECT_EQ(0U, operationStatistics.bytesReceived);
+    EXPECT_EQ(std::chrono::nanoseconds::zero(), operationStatistics.latencySum);
+    for (const auto count : operationStatistics.latencyBuckets)
+        EXPECT_EQ(0U, count);
+}
+
+TEST(StatisticsTest, LatencyBucketBoundsArePowersOfTwoMicroseconds)
+{
+    EXPECT_EQ(std::chrono::microseconds(1), Statistics::getLatencyBucketBound(0));
+    EXPECT_EQ(std::chrono::microseconds(2), Statistics::getLatencyBucketBound(1));
+    EXPECT_EQ(std::chrono::microseconds(1024), Statistics::getLatencyBucketBound(10));
+    EXPECT_EQ(std::chrono::microseconds(1 << 24), Statistics::getLatencyBucketBound(Statistics::LATENCY_BUCKETS - 2));
+    EXPECT_EQ(std::chrono::microseconds::max(), Statistics::getLatencyBucketBound(Statistics::LATENCY_BUCKETS - 1));
+}
+
+TEST(StatisticsTest, AllOperationTypesHaveName)
+{
+    EXPECT_STREQ("set", Statistics::getOperationName(Statistics::OperationType::SET));
+    EXPECT_STREQ("write_batch", Statistics::getOperationName(Statistics::OperationType::WRITE_BATCH));
+    for (int i(0); i < static_cast<int>(Statistics::OperationType::END_MARKER); ++i)
+        EXPECT_NE(nullptr, Statistics::getOperationName(static_cast<Statistics::OperationType>(i)));
+}
+
+TEST(StatisticsTest, NamespacesAreGiven)
+{
+    const Statistics statistics({ { "ns", { { Statistics::OperationType::GET, buildOperationStatistics() } } } });
+    ASSERT_EQ(1U, statistics.getNamespaces().size());
+    const auto& operations(statistics.getNamespaces().at("ns"));
+    ASSERT_EQ(1U, operations.size());
+    EXPECT_EQ(3U, operations.at(Statistics::OperationType::GET).count);
+}
+
+TEST(StatisticsTest, CountersAreExportedInPrometheusFormat)
+{
+    const Statistics statistics({ { "ns", { { Statistics::OperationType::GET, buildOperationStatistics() } } } });
+    const auto text(statistics.toPrometheusText());
+    EXPECT_NE(std::string::npos, text.find("# TYPE sdl_operations_total counter\n"
+                                           "sdl_operations_total{namespace=\"ns\",operation=\"get\"} 3\n"));
+    EXPECT_NE(std::string::npos, text.find("sdl_operation_errors_total{namespace=\"ns\",operation=\"get\"} 1\n"));
+    EXPECT_NE(std::string::npos, text.find("sdl_operation_sent_bytes_total{namespace=\"ns\",operation=\"get\"} 100\n"));
+    EXPECT_NE(std::string::npos, text.find("sdl_operation_received_bytes_total{namespace=\"ns\",operation=\"get\"} 200\n"));
+}
+
+TEST(StatisticsTest, LatencyIsExportedAsCumulativePrometheusHistogram)
+{
+    const Statistics statistics({ { "ns", { { Statistics::OperationType::SET, buildOperationStatistics() } } } });
+    const auto text(statistics.toPrometheusText());
+    EXPECT_NE(std::string::npos, text.find("# TYPE sdl_operation_duration_seconds histogram\n"));
+    EXPECT_NE(std::string::npos, text.find("sdl_operation_duration_seconds_bucket{namespace=\"ns\",operation=\"set\",le=\"1e-06\"} 1\n"
+                                           "sdl_operation_duration_seconds_bucket{namespace=\"ns\",operation=\"set\",le=\"2e-06\"} 1\n"
+                                           "sdl_operation_duration_seconds_bucket{namespace=\"ns\",operation=\"set\",le=\"4e-06\"} 2\n"));
+    EXPECT_NE(std::string::npos, text.find("sdl_operation_duration_seconds_bucket{namespace=\"ns\",operation=\"set\",le=\"16.777216\"} 2\n"
+                                           "sdl_operation_duration_seconds_bucket{namespace=\"ns\",operation=\"set\",le=\"+Inf\"} 3\n"
+                                           "sdl_operation_duration_seconds_sum{namespace=\"ns\",operation=\"set\"} 0.0015\n"
+                                           "sdl_operation_duration_seconds_count{namespace=\"ns\",operation=\"set\"} 3\n"));
+}
+
+TEST(StatisticsTest, NamespaceLabelIsEscapedInPrometheusFormat)
+{
+    const Statistics statistics({ { "n\"s\\\n", { { Statistics::OperationType::GET, buildOperationStatistics() } } } });
+    EXPECT_NE(std::string::npos, statistics.toPrometheusText().find("{namespace=\"n\\\"s\\\\\\n\",operation=\"get\"}"));
+}
@@ -0,0 +1,186 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "private/createlogger.hpp"
+#include "private/statisticscollector.hpp"
+#include "private/tst/wellknownerrorcode.hpp"
+
+using namespace shareddatalayer;
+using namespace shareddatalayer::tst;
+using namespace testing;
+
+namespace
+{
+    class StatisticsCollectorTest: public testing::Test
+    {
+    public:
+        StatisticsCollector collector;
+
+        StatisticsCollectorTest()
+        {
+            StatisticsConfiguration configuration;
+            configuration.enabled = true;
+            collector.setConfiguration(configuration);
+        }
+
+        void setSlowOperationLog()
+        {
+            SlowOperationLogConfiguration configuration;
+            configuration.threshold = std::chrono::milliseconds(1);
+            collector.setSlowOperationLog(std::make_shared<SlowOperationLog>(configuration,
+                                                                             [](const std::string&) { return "host:6379"; },
+                                                                             createLogger(SDL_LOG_PREFIX)));
+        }
+
+        const Statistics::OperationStatistics& getOperationStatistics(const Statistics& statistics,
+                                                                      const std::string& ns,
+                                                                      Statistics::OperationType type)
+        {
+            return statistics.getNamespaces().at(ns).at(type);
+        }
+    };
+}
+
+TEST_F(StatisticsCollectorTest, IsNotCopyable)
+{
+    EXPECT_FALSE(std::is_copy_constructible<StatisticsCollector>::value);
+    EXPECT_FALSE(std::is_copy_assignable<StatisticsCollector>::value);
+}
+
+TEST_F(StatisticsCollectorTest, IsEnabledIfCountingOrSlowOperationLogIsEnabled)
+{
+    EXPECT_TRUE(collector.isEnabled());
+    collector.setConfiguration(StatisticsConfiguration());
+    EXPECT_FALSE(collector.isEnabled());
+    setSlowOperationLog();
+    EXPECT_TRUE(collector.isEnabled());
+}
+
+TEST_F(StatisticsCollectorTest, OperationsAreNotCountedWhenCountingIsDisabled)
+{
+    collector.setConfiguration(StatisticsConfiguration());
+    setSlowOperationLog();
+    collector.start("ns", Statistics::OperationType::SET, 1, 10).done(std::error_code());
+    EXPECT_TRUE(collector.getStatistics().getNamespaces().empty());
+}
+
+TEST_F(StatisticsCollectorTest, NamespacesBeyondLimitAreCountedAsOtherNamespace)
+{
+    StatisticsConfiguration configuration;
+    configuration.enabled = true;
+    configuration.maxNamespaces = 2;
+    collector.setConfiguration(configuration);
+    collector.start("ns1", Statistics::OperationType::SET, 1, 10).done(std::error_code());
+    collector.start("ns2", Statistics::OperationType::SET, 1, 10).done(std::error_code());
+    collector.start("ns3", Statistics::OperationType::SET, 1, 10).done(std::error_code());
+    collector.start("ns4", Statistics::OperationType::GET, 1, 10).done(std::error_code());
+    collector.start("ns1", Statistics::OperationType::SET, 1, 10).done(std::error_code());
+    const auto statistics(collector.getStatistics());
+
+    ASSERT_EQ(3U, statistics.getNamespaces().size());
+    EXPECT_EQ(2U, getOperationStatistics(statistics, "ns1", Statistics::OperationType::SET).count);
+    EXPECT_EQ(1U, getOperationStatistics(statistics, "ns2", Statistics::OperationType::SET).count);
+    EXPECT_EQ(1U, getOperationStatistics(statistics, StatisticsCollector::OTHER_NAMESPACE, Statistics::OperationType::SET).count);
+    EXPECT_EQ(1U, getOperationStatistics(statistics, StatisticsCollector::OTHER_NAMESPACE, Statistics::OperationType::GET).count);
+}
+
+TEST_F(StatisticsCollectorTest, OperationIsNotIncludedBeforeItIsDone)
+{
+    const auto measurement(collector.start("ns", Statistics::OperationType::SET, 1, 10));
+    EXPECT_TRUE(collector.getStatistics().getNamespaces().empty());
+    measurement.done(std::error_code());
+    EXPECT_EQ(1U, getOperationStatistics(collector.getStatistics(), "ns", Statistics::OperationType::SET).count);
+}
+
+TEST_F(StatisticsCollectorTest, OperationsAreCountedPerNamespaceAndType)
+{
+    collector.start("ns1", Statistics::OperationType::SET, 1, 10).done(std::error_code());
+    collector.start("ns1", Statistics::OperationType::SET, 1, 20).done(getWellKnownErrorCode());
+    collector.start("ns1", Statistics::OperationType::GET, 1, 5).done(std::error_code(), 30);
+    collector.start("ns2", Statistics::OperationType::GET, 1, 1).done(std::error_code(), 2);
+    const auto statistics(collector.getStatistics());
+
+    ASSERT_EQ(2U, statistics.getNamespaces().size());
+    EXPECT_EQ(2U, statistics.getNamespaces().at("ns1").size());
+    EXPECT_EQ(1U, statistics.getNamespaces().at("ns2").size());
+    const auto& set(getOperationStatistics(statistics, "ns1", Statistics::OperationType::SET));
+    EXPECT_EQ(2U, set.count);
+    EXPECT_EQ(1U, set.errors);
+    EXPECT_EQ(30U, set.bytesSent);
+    EXPECT_EQ(0U, set.bytesReceived);
+    const auto& get(getOperationStatistics(statistics, "ns1", Statistics::OperationType::GET));
+    EXPECT_EQ(1U, get.count);
+    EXPECT_EQ(0U, get.errors);
+    EXPECT_EQ(5U, get.bytesSent);
+    EXPECT_EQ(30U, get.bytesReceived);
+    EXPECT_EQ(2U, getOperationStatistics(statistics, "ns2", Statistics::OperationType::GET).bytesReceived);
+}
+
+TEST_F(StatisticsCollectorTest, LatencyIsAddedToSumAndHistogram)
+{
+    collector.start("ns", Statistics::OperationType::SET, 1, 0).done(std::error_code());
+    collector.start("ns", Statistics::OperationType::SET, 1, 0).done(std::error_code());
+    const auto& set(getOperationStatistics(collector.getStatistics(), "ns", Statistics::OperationType::SET));
+    std::uint64_t count(0);
+    for (const auto bucketCount : set.latencyBuckets)
+        count += bucketCount;
+    EXPECT_EQ(2U, count);
+    EXPECT_LE(std::chrono::nanoseconds::zero(), set.latencySum);
+}
+
+TEST_F(StatisticsCollectorTest, LatencyBucketIsTheSmallestBucketWhoseBoundIsNotExceeded)
+{
+    EXPECT_EQ(0U, StatisticsCollector::getLatencyBucket(std::chrono::nanoseconds(0)));
+    EXPECT_EQ(0U, StatisticsCollector::getLatencyBucket(std::chrono::microseconds(1)));
+    EXPECT_EQ(1U, StatisticsCollector::getLatencyBucket(std::chrono::nanoseconds(1001)));
+    EXPECT_EQ(1U, StatisticsCollector::getLatencyBucket(std::chrono::microseconds(2)));
+    EXPECT_EQ(2U, StatisticsCollector::getLatencyBucket(std::chrono::microseconds(3)));
+    EXPECT_EQ(10U, StatisticsCollector::getLatencyBucket(std::chrono::microseconds(1024)));
+    EXPECT_EQ(11U, StatisticsCollector::getLatencyBucket(std::chrono::microseconds(1025)));
+    EXPECT_EQ(Statistics::LATENCY_BUCKETS - 2, StatisticsCollector::getLatencyBucket(std::chrono::microseconds(1 << 24)));
+    EXPECT_EQ(Statistics::LATENCY_BUCKETS - 1, StatisticsCollector::getLatencyBucket(std::chrono::microseconds((1 << 24) + 1)));
+    EXPECT_EQ(Statistics::LATENCY_BUCKETS - 1, StatisticsCollector::getLatencyBucket(std::chrono::hours(24)));
+}
+
+TEST_F(StatisticsCollectorTest, SlowOperationsAreNotRecordedWithoutSlowOperationLog)
+{
+    collector.start("ns", Statistics::OperationType::SET, 1, 0).done(std::error_code());
+    EXPECT_TRUE(collector.getStatistics().getSlowOperations().empty());
+}
+
+TEST_F(StatisticsCollectorTest, OperationsExceedingThresholdAreRecordedAsSlowOperations)
+{
+    setSlowOperationLog();
+    const auto measurement(collector.start("ns", Statistics::OperationType::GET, 2, 10));
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    measurement.done(std::error_code(), 30);
+    const auto slowOperations(collector.getStatistics().getSlowOperations());
+
+    ASSERT_EQ(1U, slowOperations.size());
+    EXPECT_EQ("ns", slowOperations.front().ns);
+    EXPECT_EQ(Statistics::OperationType::GET, slowOperations.front().type);
+    EXPECT_EQ(2U, slowOperations.front().keyCount);
+    EXPECT_EQ(40U, slowOperations.front().bytes);
+    EXPECT_EQ("host:6379", slowOperations.front().connection);
+    EXPECT_LE(std::chrono::milliseconds(2), slowOperations.front().latency);
+}
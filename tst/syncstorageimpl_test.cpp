@@ -53,6 +53,7 @@ namespace
         StrictMock<SystemMock> systemMock;
         AsyncStorage::ModifyAck savedModifyAck;
         AsyncStorage::ModifyIfAck savedModifyIfAck;
+        AsyncStorage::WriteBatchAck savedWriteBatchAck;
         AsyncStorage::GetAck savedGetAck;
         AsyncStorage::FindKeysAck savedFindKeysAck;
         AsyncStorage::ReadyAck savedReadyAck;
@@ -77,6 +78,8 @@ namespace
             TEST_OPERATION_POLL_WAIT_TIMEOUT(std::chrono::duration_cast<std::chrono::milliseconds>(TEST_OPERATION_WAIT_TIMEOUT).count() / 10)
         {
             expectConstructorCalls();
+            EXPECT_CALL(*asyncStorageMockRawPtr, setOperationTimeout(_))
+                .Times(AnyNumber());
             syncStorage.reset(new SyncStorageImpl(std::move(asyncStorageMockPassedToImplementation), systemMock));
         }
 
@@ -208,6 +211,16 @@ namespace
                                  }));
         }
 
+        void expectWriteBatchAck(const std::error_code& error, const std::vector<bool>& statuses)
+        {
+            EXPECT_CALL(*asyncStorageMockRawPtr, handleEvents())
+                .Times(1)
+                .WillOnce(Invoke([this, error, statuses]()
+                                 {
+                                    savedWriteBatchAck(error, statuses);
+                                 }));
+        }
+
         void expectGetAckWithError()
         {
             EXPECT_CALL(*asyncStorageMockRawPtr, handleEvents())
@@ -304,12 +317,26 @@ namespace
                 .WillOnce(SaveArg<1>(&savedModifyAck));
         }
 
+        void expectRemoveByPrefixAsync(const std::string& keyPrefix)
+        {
+            EXPECT_CALL(*asyncStorageMockRawPtr, removeByPrefixAsync(ns, keyPrefix, _))
+                .Times(1)
+                .WillOnce(SaveArg<2>(&savedModifyAck));
+        }
+
         void expectSetIfNotExistsAsync(const SyncStorage::Key& key, const SyncStorage::Data& data)
         {
             EXPECT_CALL(*asyncStorageMockRawPtr, setIfNotExistsAsync(ns, key, data, _))
                 .Times(1)
                 .WillOnce(SaveArg<3>(&savedModifyIfAck));
         }
+
+        void expectWriteBatchAsync()
+        {
+            EXPECT_CALL(*asyncStorageMockRawPtr, writeBatchAsync(ns, _, _))
+                .Times(1)
+                .WillOnce(SaveArg<2>(&savedWriteBatchAck));
+        }
     };
 }
 
@@ -394,6 +421,29 @@ TEST_F(SyncStorageImplTest, SetWithReadinessTimeoutSuccessfully)
     syncStorage->set(ns, dataMap);
 }
 
+TEST_F(SyncStorageImplTest, SetOperationTimeoutIsForwardedToAsyncStorage)
+{
+    EXPECT_CALL(*asyncStorageMockRawPtr, setOperationTimeout(TEST_OPERATION_WAIT_TIMEOUT))
+        .Times(1);
+    syncStorage->setOperationTimeout(TEST_OPERATION_WAIT_TIMEOUT);
+}
+
+TEST_F(SyncStorageImplTest, SetCanThrowOperationInterruptedWhenOperationTimeoutExpires)
+{
+    InSequence dummy;
+    expectSdlReadinessCheck(TEST_OPERATION_POLL_WAIT_TIMEOUT);
+    expectSetAsync(dataMap);
+    expectPollWait(SyncStorageImpl::NO_TIMEOUT);
+    EXPECT_CALL(*asyncStorageMockRawPtr, handleEvents())
+        .Times(1)
+        .WillOnce(Invoke([this]()
+                         {
+                             savedModifyAck(AsyncRedisStorage::ErrorCode::OPERATION_TIMEOUT);
+                         }));
+    syncStorage->setOperationTimeout(TEST_OPERATION_WAIT_TIMEOUT);
+    EXPECT_THROW(syncStorage->set(ns, dataMap), OperationInterrupted);
+}
+
 TEST_F(SyncStorageImplTest, SetCanThrowBackendError)
 {
     InSequence dummy;
@@ -491,6 +541,27 @@ TEST_F(SyncStorageImplTest, SetIfNotExistsCanThrowBackendError)
     EXPECT_THROW(syncStorage->setIfNotExists(ns, "key1", { 0x0a, 0x0b, 0x0c }), BackendError);
 }
 
+TEST_F(SyncStorageImplTest, WriteBatchSuccessfully)
+{
+    InSequence dummy;
+    expectSdlReadinessCheck(SyncStorageImpl::NO_TIMEOUT);
+    expectWriteBatchAsync();
+    expectPollWait(SyncStorageImpl::NO_TIMEOUT);
+    expectWriteBatchAck(std::error_code(), { true, false });
+    EXPECT_EQ(std::vector<bool>({ true, false }),
+              syncStorage->writeBatch(ns, WriteBatch().set(dataMap).setIfNotExists("key1", { 0x0a })));
+}
+
+TEST_F(SyncStorageImplTest, WriteBatchCanThrowBackendError)
+{
+    InSequence dummy;
+    expectSdlReadinessCheck(SyncStorageImpl::NO_TIMEOUT);
+    expectWriteBatchAsync();
+    expectPollWait(SyncStorageImpl::NO_TIMEOUT);
+    expectWriteBatchAck(AsyncRedisCommandDispatcherErrorCode::OUT_OF_MEMORY, { });
+    EXPECT_THROW(syncStorage->writeBatch(ns, WriteBatch().set(dataMap)), BackendError);
+}
+
 TEST_F(SyncStorageImplTest, GetSuccessfully)
 {
     InSequence dummy;
@@ -671,6 +742,26 @@ TEST_F(SyncStorageImplTest, RemoveAllCanThrowBackendError)
     EXPECT_THROW(syncStorage->removeAll(ns), BackendError);
 }
 
+TEST_F(SyncStorageImplTest, RemoveByPrefixSuccessfully)
+{
+    InSequence dummy;
+    expectSdlReadinessCheck(SyncStorageImpl::NO_TIMEOUT);
+    expectRemoveByPrefixAsync("key");
+    expectPollWait(SyncStorageImpl::NO_TIMEOUT);
+    expectHandleEvents_callModifyAck();
+    syncStorage->removeByPrefix(ns, "key");
+}
+
+TEST_F(SyncStorageImplTest, RemoveByPrefixCanThrowBackendError)
+{
+    InSequence dummy;
+    expectSdlReadinessCheck(SyncStorageImpl::NO_TIMEOUT);
+    expectRemoveByPrefixAsync("key");
+    expectPollWait(SyncStorageImpl::NO_TIMEOUT);
+    expectModifyAckWithError();
+    EXPECT_THROW(syncStorage->removeByPrefix(ns, "key"), BackendError);
+}
+
 TEST_F(SyncStorageImplTest, AllAsyncRedisStorageErrorCodesThrowCorrectException)
 {
     InSequence dummy;
@@ -697,6 +788,10 @@ TEST_F(SyncStorageImplTest, AllAsyncRedisStorageErrorCodesThrowCorrectException)
                 expectModifyIfAck(arsec, false);
                 EXPECT_THROW(syncStorage->setIfNotExists(ns, "key1", { 0x0a, 0x0b, 0x0c }), NotConnected);
                 break;
+            case AsyncRedisStorage::ErrorCode::OPERATION_TIMEOUT:
+                expectModifyIfAck(arsec, false);
+                EXPECT_THROW(syncStorage->setIfNotExists(ns, "key1", { 0x0a, 0x0b, 0x0c }), OperationInterrupted);
+                break;
             default:
                 FAIL() << "No mapping for AsyncRedisStorage::ErrorCode value: " << arsec;
                 break;
@@ -754,6 +849,10 @@ TEST_F(SyncStorageImplTest, AllDispatcherErrorCodesThrowCorrectException)
                 expectModifyIfAck(aec, false);
                 EXPECT_THROW(syncStorage->setIfNotExists(ns, "key1", { 0x0a, 0x0b, 0x0c }), BackendError);
                 break;
+            case AsyncRedisCommandDispatcherErrorCode::NO_SCRIPT:
+                expectModifyIfAck(aec, false);
+                EXPECT_THROW(syncStorage->setIfNotExists(ns, "key1", { 0x0a, 0x0b, 0x0c }), BackendError);
+                break;
             default:
                 FAIL() << "No mapping for AsyncRedisCommandDispatcherErrorCode value: " << aec;
                 break;
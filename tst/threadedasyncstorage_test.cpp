@@ -0,0 +1,362 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <type_traits>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "private/error.hpp"
+#include "private/threadedasyncstorage.hpp"
+#include "private/tst/asyncstoragemock.hpp"
+#include "private/tst/enginemock.hpp"
+#include "private/tst/moveargaction.hpp"
+#include "private/tst/wellknownerrorcode.hpp"
+
+using namespace shareddatalayer;
+using namespace shareddatalayer::tst;
+using namespace testing;
+
+namespace
+{
+    class ThreadedAsyncStorageTest: public testing::Test
+    {
+    public:
+        std::shared_ptr<StrictMock<EngineMock>> engineMock;
+        std::unique_ptr<StrictMock<AsyncStorageMock>> asyncStorageMockPassedToImplementation;
+        StrictMock<AsyncStorageMock>* asyncStorageMockRawPtr;
+        std::unique_ptr<ThreadedAsyncStorage> threadedAsyncStorage;
+        std::vector<Engine::Callback> postedCallbacks;
+        std::vector<std::function<void()>> executedTasks;
+        const AsyncStorage::Namespace ns;
+        const AsyncStorage::Keys keys;
+        const AsyncStorage::DataMap dataMap;
+
+        ThreadedAsyncStorageTest():
+            engineMock(std::make_shared<StrictMock<EngineMock>>()),
+            asyncStorageMockPassedToImplementation(new StrictMock<AsyncStorageMock>()),
+            asyncStorageMockRawPtr(asyncStorageMockPassedToImplementation.get()),
+            ns("tag1"),
+            keys({ "key1", "key2" }),
+            dataMap({ { "key1", { 1, 2, 3 } }, { "key2", { 4, 5 } } })
+        {
+            EXPECT_CALL(*engineMock, postCallback(_))
+                .WillRepeatedly(AppendMovedArg<0>(&postedCallbacks));
+            EXPECT_CALL(*engineMock, run())
+                .Times(1);
+        }
+
+        ~ThreadedAsyncStorageTest()
+        {
+            if (threadedAsyncStorage)
+            {
+                EXPECT_CALL(*engineMock, stop())
+                    .Times(1);
+                threadedAsyncStorage.reset();
+            }
+        }
+
+        void create(bool useExecutor)
+        {
+            AsyncStorage::Executor executor;
+            if (useExecutor)
+                executor = std::bind(&ThreadedAsyncStorageTest::execute, this, std::placeholders::_1);
+            threadedAsyncStorage.reset(new ThreadedAsyncStorage(engineMock,
+                                                                std::move(asyncStorageMockPassedToImplementation),
+                                                                executor));
+            /* Posted by the constructor to create the callback queue. */
+            runPostedCallbacks();
+        }
+
+        void runPostedCallbacks()
+        {
+            auto callbacks(std::move(postedCallbacks));
+            postedCallbacks.clear();
+            for (const auto& callback : callbacks)
+                callback();
+        }
+
+        void execute(const std::function<void()>& task)
+        {
+            executedTasks.push_back(task);
+        }
+
+        MOCK_METHOD1(modifyAck, void(const std::error_code&));
+
+        MOCK_METHOD2(modifyIfAck, void(const std::error_code&, bool));
+
+        MOCK_METHOD2(getAck, void(const std::error_code&, const AsyncStorage::DataMap&));
+
+        MOCK_METHOD2(dataViewsAck, void(const std::error_code&, const AsyncStorage::DataMap&));
+
+        MOCK_METHOD2(visitor, void(const AsyncStorage::Key&, const AsyncStorage::Data&));
+
+        MOCK_METHOD1(getVisitAck, void(const std::error_code&));
+
+        MOCK_METHOD2(scanKeysAck, void(const std::error_code&, const AsyncStorage::Keys&));
+    };
+}
+
+TEST_F(ThreadedAsyncStorageTest, IsNotCopyable)
+{
+    create(false);
+    EXPECT_FALSE(std::is_copy_constructible<ThreadedAsyncStorage>::value);
+    EXPECT_FALSE(std::is_copy_assignable<ThreadedAsyncStorage>::value);
+}
+
+TEST_F(ThreadedAsyncStorageTest, ImplementsAsyncStorage)
+{
+    create(false);
+    EXPECT_TRUE((std::is_base_of<AsyncStorage, ThreadedAsyncStorage>::value));
+}
+
+TEST_F(ThreadedAsyncStorageTest, ApplicationDoesNotNeedToMonitorEvents)
+{
+    create(false);
+    EXPECT_EQ(-1, threadedAsyncStorage->fd());
+    threadedAsyncStorage->handleEvents();
+}
+
+TEST_F(ThreadedAsyncStorageTest, OperationIsStartedInIoThread)
+{
+    create(false);
+    AsyncStorage::ModifyAck savedModifyAck;
+    threadedAsyncStorage->setAsync(ns, dataMap, std::bind(&ThreadedAsyncStorageTest::modifyAck, this, std::placeholders::_1));
+    EXPECT_CALL(*asyncStorageMockRawPtr, setAsync(ns, dataMap, _))
+        .Times(1)
+        .WillOnce(SaveArg<2>(&savedModifyAck));
+    runPostedCallbacks();
+    EXPECT_CALL(*this, modifyAck(getWellKnownErrorCode()))
+        .Times(1);
+    savedModifyAck(getWellKnownErrorCode());
+}
+
+TEST_F(ThreadedAsyncStorageTest, AckIsPassedToExecutor)
+{
+    create(true);
+    AsyncStorage::ModifyIfAck savedModifyIfAck;
+    threadedAsyncStorage->setIfNotExistsAsync(ns, "key1", { 1 }, std::bind(&ThreadedAsyncStorageTest::modifyIfAck,
+                                                                          this,
+                                                                          std::placeholders::_1,
+                                                                          std::placeholders::_2));
+    EXPECT_CALL(*asyncStorageMockRawPtr, setIfNotExistsAsync(ns, "key1", AsyncStorage::Data({ 1 }), _))
+        .Times(1)
+        .WillOnce(SaveArg<3>(&savedModifyIfAck));
+    runPostedCallbacks();
+    savedModifyIfAck(std::error_code(), true);
+    ASSERT_EQ(1U, executedTasks.size());
+    EXPECT_CALL(*this, modifyIfAck(std::error_code(), true))
+        .Times(1);
+    executedTasks.front()();
+}
+
+TEST_F(ThreadedAsyncStorageTest, DataViewsGivenToExecutorOutliveTheOriginalViews)
+{
+    create(true);
+    AsyncStorage::GetViewsAck savedGetViewsAck;
+    threadedAsyncStorage->getViewsAsync(ns, keys, [this](const std::error_code& error, const AsyncStorage::DataViews& dataViews)
+                                                  {
+                                                      AsyncStorage::DataMap found;
+                                                      for (const auto& i : dataViews)
+                                                          found[*i.first] = AsyncStorage::Data(i.second.data, i.second.data + i.second.size);
+                                                      dataViewsAck(error, found);
+                                                  });
+    EXPECT_CALL(*asyncStorageMockRawPtr, getViewsAsync(ns, keys, _))
+        .Times(1)
+        .WillOnce(SaveArg<2>(&savedGetViewsAck));
+    runPostedCallbacks();
+    {
+        std::unique_ptr<AsyncStorage::Keys> replyKeys(new AsyncStorage::Keys(keys));
+        std::unique_ptr<AsyncStorage::DataMap> replyData(new AsyncStorage::DataMap(dataMap));
+        AsyncStorage::DataViews dataViews;
+        for (const auto& i : *replyKeys)
+            dataViews.push_back({ &i, { (*replyData)[i].data(), (*replyData)[i].size() } });
+        savedGetViewsAck(std::error_code(), dataViews);
+    }
+    ASSERT_EQ(1U, executedTasks.size());
+    EXPECT_CALL(*this, dataViewsAck(std::error_code(), dataMap))
+        .Times(1);
+    executedTasks.front()();
+}
+
+TEST_F(ThreadedAsyncStorageTest, VisitorIsCalledInExecutorBeforeAck)
+{
+    create(true);
+    AsyncStorage::DataVisitor savedVisitor;
+    AsyncStorage::GetVisitAck savedGetVisitAck;
+    threadedAsyncStorage->getViewsAsync(ns,
+                                        keys,
+                                        [this](const AsyncStorage::Key& key, const AsyncStorage::DataView& data)
+                                        {
+                                            visitor(key, AsyncStorage::Data(data.data, data.data + data.size));
+                                        },
+                                        std::bind(&ThreadedAsyncStorageTest::getVisitAck, this, std::placeholders::_1));
+    EXPECT_CALL(*asyncStorageMockRawPtr, getViewsAsync(ns, keys, _, _))
+        .Times(1)
+        .WillOnce(DoAll(SaveArg<2>(&savedVisitor), SaveArg<3>(&savedGetVisitAck)));
+    runPostedCallbacks();
+    {
+        const AsyncStorage::Data data({ 7, 8 });
+        savedVisitor("key1", { data.data(), data.size() });
+    }
+    savedGetVisitAck(std::error_code());
+    ASSERT_EQ(1U, executedTasks.size());
+    InSequence dummy;
+    EXPECT_CALL(*this, visitor("key1", AsyncStorage::Data({ 7, 8 })))
+        .Times(1);
+    EXPECT_CALL(*this, getVisitAck(std::error_code()))
+        .Times(1);
+    executedTasks.front()();
+}
+
+TEST_F(ThreadedAsyncStorageTest, StatisticsAreGotInIoThreadAndDeliveredWithExecutor)
+{
+    create(true);
+    AsyncStorage::GetStatisticsAck savedGetStatisticsAck;
+    bool statisticsAcked(false);
+    threadedAsyncStorage->getStatisticsAsync([&statisticsAcked](const Statistics&) { statisticsAcked = true; });
+    EXPECT_CALL(*asyncStorageMockRawPtr, getStatisticsAsync(_))
+        .Times(1)
+        .WillOnce(SaveArg<0>(&savedGetStatisticsAck));
+    runPostedCallbacks();
+    savedGetStatisticsAck(Statistics());
+    EXPECT_FALSE(statisticsAcked);
+    ASSERT_EQ(1U, executedTasks.size());
+    executedTasks.front()();
+    EXPECT_TRUE(statisticsAcked);
+}
+
+TEST_F(ThreadedAsyncStorageTest, OperationTimeoutIsSetInIoThread)
+{
+    create(false);
+    threadedAsyncStorage->setOperationTimeout(std::chrono::seconds(1));
+    EXPECT_CALL(*asyncStorageMockRawPtr, setOperationTimeout(std::chrono::steady_clock::duration(std::chrono::seconds(1))))
+        .Times(1);
+    runPostedCallbacks();
+}
+
+TEST_F(ThreadedAsyncStorageTest, NextScanPageIsRequestedInIoThread)
+{
+    create(true);
+    AsyncStorage::ScanKeysAck savedScanKeysAck;
+    AsyncStorage::ScanKeysNext nextFromExecutor;
+    bool nextCalled(false);
+    threadedAsyncStorage->scanKeysAsync(ns,
+                                        "*",
+                                        10,
+                                        [this, &nextFromExecutor](const std::error_code& error,
+                                                                  const AsyncStorage::Keys& keys,
+                                                                  const AsyncStorage::ScanKeysNext& next)
+                                        {
+                                            scanKeysAck(error, keys);
+                                            nextFromExecutor = next;
+                                        });
+    EXPECT_CALL(*asyncStorageMockRawPtr, scanKeysAsync(ns, "*", 10U, _))
+        .Times(1)
+        .WillOnce(SaveArg<3>(&savedScanKeysAck));
+    runPostedCallbacks();
+    savedScanKeysAck(std::error_code(), keys, [&nextCalled]() { nextCalled = true; });
+    ASSERT_EQ(1U, executedTasks.size());
+    EXPECT_CALL(*this, scanKeysAck(std::error_code(), keys))
+        .Times(1);
+    executedTasks.front()();
+    ASSERT_TRUE(static_cast<bool>(nextFromExecutor));
+    nextFromExecutor();
+    EXPECT_FALSE(nextCalled);
+    runPostedCallbacks();
+    EXPECT_TRUE(nextCalled);
+}
+
+TEST_F(ThreadedAsyncStorageTest, NextScanPageRequestedAfterDestructionIsAcknowledgedWithError)
+{
+    create(true);
+    AsyncStorage::ScanKeysAck savedScanKeysAck;
+    AsyncStorage::ScanKeysNext nextFromExecutor;
+    threadedAsyncStorage->scanKeysAsync(ns,
+                                        "*",
+                                        10,
+                                        [this, &nextFromExecutor](const std::error_code& error,
+                                                                  const AsyncStorage::Keys& keys,
+                                                                  const AsyncStorage::ScanKeysNext& next)
+                                        {
+                                            scanKeysAck(error, keys);
+                                            nextFromExecutor = next;
+                                        });
+    EXPECT_CALL(*asyncStorageMockRawPtr, scanKeysAsync(ns, "*", 10U, _))
+        .Times(1)
+        .WillOnce(SaveArg<3>(&savedScanKeysAck));
+    runPostedCallbacks();
+    savedScanKeysAck(std::error_code(), keys, []() { });
+    EXPECT_CALL(*this, scanKeysAck(std::error_code(), keys))
+        .Times(1);
+    executedTasks.front()();
+    executedTasks.clear();
+    EXPECT_CALL(*engineMock, stop())
+        .Times(1);
+    threadedAsyncStorage.reset();
+    ASSERT_TRUE(static_cast<bool>(nextFromExecutor));
+    nextFromExecutor();
+    EXPECT_TRUE(postedCallbacks.empty());
+    ASSERT_EQ(1U, executedTasks.size());
+    EXPECT_CALL(*this, scanKeysAck(std::error_code(redis::AsyncRedisCommandDispatcherErrorCode::NOT_CONNECTED), AsyncStorage::Keys()))
+        .Times(1);
+    executedTasks.front()();
+}
+
+TEST(ThreadedAsyncStorageDeathTest, DestroyingInAckCalledInIoThreadCallsSHAREDDATALAYER_ABORT)
+{
+    EXPECT_EXIT({
+                    const auto engineMock(std::make_shared<NiceMock<EngineMock>>());
+                    std::unique_ptr<NiceMock<AsyncStorageMock>> asyncStorageMock(new NiceMock<AsyncStorageMock>());
+                    std::unique_ptr<AsyncStorage> threadedAsyncStorage;
+                    std::vector<Engine::Callback> postedCallbacks;
+                    std::promise<void> started;
+                    auto startedFuture(started.get_future());
+                    ON_CALL(*engineMock, postCallback(_))
+                        .WillByDefault(AppendMovedArg<0>(&postedCallbacks));
+                    ON_CALL(*asyncStorageMock, setAsync(_, _, _))
+                        .WillByDefault(InvokeArgument<2>(std::error_code()));
+                    /* The I/O thread runs the posted operation, which calls the acknowledgement. */
+                    ON_CALL(*engineMock, run())
+                        .WillByDefault(Invoke([&postedCallbacks, &startedFuture] ()
+                                              {
+                                                  startedFuture.wait();
+                                                  for (const auto& callback : postedCallbacks)
+                                                      callback();
+                                              }));
+                    threadedAsyncStorage.reset(new ThreadedAsyncStorage(engineMock,
+                                                                        std::move(asyncStorageMock),
+                                                                        AsyncStorage::Executor()));
+                    threadedAsyncStorage->setAsync("tag1",
+                                                   { { "key1", { 1 } } },
+                                                   [&threadedAsyncStorage] (const std::error_code&)
+                                                   {
+                                                       threadedAsyncStorage.reset();
+                                                   });
+                    started.set_value();
+                    std::this_thread::sleep_for(std::chrono::seconds(10));
+                    exit(EXIT_SUCCESS);
+                },
+                KilledBySignal(SIGABRT), "ABORT.*threadedasyncstorage\\.cpp");
+}
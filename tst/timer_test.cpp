@@ -119,6 +119,15 @@ TEST_F(TimerTest, AfterTimerHasExpiredItIsNotArmedAnymore)
     EXPECT_FALSE(timer->isArmed());
 }
 
+TEST_F(TimerTest, DisarmingReleasesCallback)
+{
+    const auto data(std::make_shared<int>(0));
+    timer->arm(duration, [data] () { });
+    EXPECT_EQ(2, data.use_count());
+    timer->disarm();
+    EXPECT_EQ(1, data.use_count());
+}
+
 TEST_F(TimerTest, ArmingNullCallbackCallsSHAREDDATALAYER_ABORT)
 {
     EXPECT_EXIT(timer->arm(duration, Timer::Callback()),
@@ -20,7 +20,10 @@
 */
 
 #include <type_traits>
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <vector>
 #include <boost/optional.hpp>
 #include <sys/timerfd.h>
 #include <gmock/gmock.h>
@@ -154,7 +157,14 @@ TEST_F(TimerFDTest, IsNotCopyableAndIsNotMovable)
 
 TEST_F(TimerFDTest, ArmingTheFirstTimerCallsSetTimeWithProperValues)
 {
-    expectSetTime(3, 4000);
+    expectSetTime(3, 4000000);
+    arm(3, 4000000);
+    Mock::VerifyAndClear(&systemMock);
+}
+
+TEST_F(TimerFDTest, ExpirationTimeIsRoundedUpToMilliseconds)
+{
+    expectSetTime(3, 1000000);
     arm(3, 4000);
     Mock::VerifyAndClear(&systemMock);
 }
@@ -174,15 +184,30 @@ TEST_F(TimerFDTest, DisarminTheOnlyTimerCallsSetTimeWithZeroValues)
     disarm();
 }
 
-TEST_F(TimerFDTest, DisarminTheFirstTimerCallsSetTimeWithProperValues)
+TEST_F(TimerFDTest, DisarminTheFirstTimerDoesntCallSetTime)
 {
     arm(*timer1, 3, 0);
     arm(*timer2, 4, 0);
-    expectSetTime(4, 0);
+    EXPECT_CALL(systemMock, timerfd_settime(_, _, _, _))
+        .Times(0);
     disarm(*timer1);
     Mock::VerifyAndClear(&systemMock);
 }
 
+TEST_F(TimerFDTest, AfterExpirationOfDisarmedFirstTimerSetTimeIsCalledWithProperValues)
+{
+    InSequence dummy;
+    arm(*timer1, 3, 0, "first");
+    arm(*timer2, 4, 0, "second");
+    disarm(*timer1);
+    expectRead(1);
+    EXPECT_CALL(*this, callback(_))
+        .Times(0);
+    expectSetTime(4, 0);
+    savedEventHandler(Engine::EVENT_IN);
+    Mock::VerifyAndClear(&systemMock);
+}
+
 TEST_F(TimerFDTest, AfterExecutingTheFirstTimerSetTimeIsCalledWithProperValues)
 {
     InSequence dummy;
@@ -253,3 +278,80 @@ TEST_F(TimerFDTest, AllTimersThatHaveExpiredDuringTheEventLoopAreExecutedWithThe
         .Times(1);
     savedEventHandler(Engine::EVENT_IN);
 }
+
+TEST_F(TimerFDTest, TimersAreExecutedInExpirationOrderFromAllLevelsOfTheWheel)
+{
+    std::vector<std::unique_ptr<Timer>> timers;
+    const std::vector<int> milliseconds({ 50, 70000, 5, 20000000, 3000, 100, 300000, 1 });
+    for (auto i : milliseconds)
+    {
+        timers.emplace_back(new Timer(engineMock));
+        arm(*timers.back(), i / 1000, (i % 1000) * 1000000, std::to_string(i));
+    }
+    auto sorted(milliseconds);
+    std::sort(sorted.begin(), sorted.end());
+    InSequence dummy;
+    for (auto i : sorted)
+    {
+        expectRead(1);
+        expectTimeSinceEpoch(std::chrono::milliseconds(i));
+        EXPECT_CALL(*this, callback(std::to_string(i)))
+            .Times(1);
+        savedEventHandler(Engine::EVENT_IN);
+    }
+}
+
+TEST_F(TimerFDTest, TimerFDIsArmedToTheEarliestExpirationAfterCascading)
+{
+    InSequence dummy;
+    arm(*timer1, 0, 1000000, "first");
+    arm(*timer2, 70, 5000000, "second");
+    expectRead(1);
+    EXPECT_CALL(*this, callback("first"))
+        .Times(1);
+    expectSetTime(70, 5000000);
+    savedEventHandler(Engine::EVENT_IN);
+    Mock::VerifyAndClear(&systemMock);
+}
+
+TEST_F(TimerFDTest, TimerCanBeRearmedFromItsOwnCallback)
+{
+    InSequence dummy;
+    timer1->arm(std::chrono::milliseconds(1), [this] ()
+                                              {
+                                                  arm(1, 0, "rearmed");
+                                              });
+    expectRead(1);
+    expectSetTime(1, 0);
+    savedEventHandler(Engine::EVENT_IN);
+    EXPECT_TRUE(timer1->isArmed());
+    expectRead(1);
+    expectTimeSinceEpoch(std::chrono::seconds(1));
+    EXPECT_CALL(*this, callback("rearmed"))
+        .Times(1);
+    expectSetTime(0, 0);
+    savedEventHandler(Engine::EVENT_IN);
+    EXPECT_FALSE(timer1->isArmed());
+}
+
+TEST_F(TimerFDTest, TimerArmedWithZeroDurationFromCallbackIsCalledOnTheNextPass)
+{
+    InSequence dummy;
+    timer1->arm(std::chrono::milliseconds(1), [this] ()
+                                              {
+                                                  arm(*timer2, 0, 0, "rearmed");
+                                              });
+    expectRead(1);
+    EXPECT_CALL(*this, callback("rearmed"))
+        .Times(0);
+    expectSetTime(0, 1000000);
+    savedEventHandler(Engine::EVENT_IN);
+    EXPECT_TRUE(timer2->isArmed());
+    Mock::VerifyAndClear(this);
+    expectRead(1);
+    EXPECT_CALL(*this, callback("rearmed"))
+        .Times(1);
+    expectSetTime(0, 0);
+    savedEventHandler(Engine::EVENT_IN);
+    EXPECT_FALSE(timer2->isArmed());
+}
@@ -0,0 +1,59 @@
+/*
+   Copyright (c) 2018-2022 Nokia.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/*
+ * This source code is part of the near-RT RIC (RAN Intelligent Controller)
+ * platform project (RICP).
+*/
+
+#include <gtest/gtest.h>
+#include <sdl/writebatch.hpp>
+
+using namespace shareddatalayer;
+using namespace testing;
+
+TEST(WriteBatchTest, IsEmptyWhenCreated)
+{
+    const WriteBatch writeBatch;
+    EXPECT_TRUE(writeBatch.empty());
+    EXPECT_EQ(0U, writeBatch.size());
+}
+
+TEST(WriteBatchTest, OperationsAreStoredInOrder)
+{
+    WriteBatch writeBatch;
+    writeBatch.set({ { "key1", { 1 } } })
+              .remove({ "key2" })
+              .setIf("key3", { 2 }, { 3 })
+              .setIfNotExists("key4", { 4 })
+              .removeIf("key5", { 5 });
+    ASSERT_EQ(5U, writeBatch.size());
+    const auto& operations(writeBatch.getOperations());
+    EXPECT_EQ(WriteBatch::OperationType::SET, operations[0].type);
+    EXPECT_EQ(WriteBatch::DataMap({ { "key1", { 1 } } }), operations[0].dataMap);
+    EXPECT_EQ(WriteBatch::OperationType::REMOVE, operations[1].type);
+    EXPECT_EQ(WriteBatch::Keys({ "key2" }), operations[1].keys);
+    EXPECT_EQ(WriteBatch::OperationType::SET_IF, operations[2].type);
+    EXPECT_EQ("key3", operations[2].key);
+    EXPECT_EQ(WriteBatch::Data({ 2 }), operations[2].oldData);
+    EXPECT_EQ(WriteBatch::Data({ 3 }), operations[2].data);
+    EXPECT_EQ(WriteBatch::OperationType::SET_IF_NOT_EXISTS, operations[3].type);
+    EXPECT_EQ("key4", operations[3].key);
+    EXPECT_EQ(WriteBatch::Data({ 4 }), operations[3].data);
+    EXPECT_EQ(WriteBatch::OperationType::REMOVE_IF, operations[4].type);
+    EXPECT_EQ("key5", operations[4].key);
+    EXPECT_EQ(WriteBatch::Data({ 5 }), operations[4].data);
+}